@@ -124,3 +124,67 @@ autoDetect(QCommandLineParser &parser, QCoreApplication &app, const ErrorStack &
   }
   return rad;
 }
+
+QList<Radio *>
+autoDetectAll(QCommandLineParser &parser, QCoreApplication &app, QList<USBDeviceDescriptor> &devices, const ErrorStack &err) {
+  Q_UNUSED(app)
+
+  logDebug() << "Autodetect all radios.";
+
+  if (parser.isSet("device")) {
+    errMsg(err) << "The --device option cannot be used together with --all-devices.";
+    return QList<Radio *>();
+  }
+
+  RadioInfo force;
+  if (parser.isSet("radio")) {
+    force = RadioInfo::byKey(parser.value("radio").toLower());
+    if (! force.isValid()) {
+      errMsg(err) << "Unknown radio '" << parser.value("radio").toLower() << "'.";
+      return QList<Radio *>();
+    }
+  }
+
+  // Unlike the single device detection, do not fall back to unsave devices here. Writing to
+  // every serial port found is not an option.
+  QList<USBDeviceDescriptor> interfaces = USBDeviceDescriptor::detect();
+  if (interfaces.isEmpty()) {
+    errMsg(err) << "No matching USB devices are found. Check connection?";
+    return QList<Radio *>();
+  }
+
+  logInfo() << "Found " << interfaces.count() << " device(s):";
+  foreach (USBDeviceDescriptor d, interfaces) {
+    logInfo() << "  " << d.description() << ".";
+  }
+
+  QList<Radio *> radios;
+  foreach (USBDeviceDescriptor device, interfaces) {
+    if (force.isValid()) {
+      if (! force.interfaceMatches(device)) {
+        logWarn() << "Skip device " << device.deviceHandle() << ": Not a " << force.name() << ".";
+        continue;
+      }
+    } else if (! device.isSave()) {
+      logWarn() << "Skip device " << device.deviceHandle() << ": It is not save to identify the "
+                << "radio connected to it. Use the --radio option to specify the radio.";
+      continue;
+    }
+
+    ErrorStack deviceErr;
+    Radio *radio = Radio::detect(device, force, deviceErr);
+    if (nullptr == radio) {
+      logError() << "Skip device " << device.deviceHandle() << ": Cannot detect radio: "
+                 << deviceErr.format();
+      continue;
+    }
+    logDebug() << "Found " << radio->name() << " at " << device.deviceHandle() << ".";
+    radios.append(radio);
+    devices.append(device);
+  }
+
+  if (radios.isEmpty())
+    errMsg(err) << "None of the devices found can be used.";
+
+  return radios;
+}
@@ -17,6 +17,30 @@
 #include "d878uv2_callsigndb.hh"
 
 
+/** Encodes the call-sign DB straight into the output file, without holding the complete binary
+ * DB in memory. */
+static bool
+encodeCallsignDBStreaming(CallsignDB &db, UserDatabase &userdb, const CallsignDB::Flags &selection,
+                          const QString &filename, const ErrorStack &err)
+{
+  qint64 n = std::min(userdb.count(), qint64(db.maxEntries()));
+  if (selection.hasCountLimit())
+    n = std::min(n, (qint64)selection.countLimit());
+
+  CallsignDB::SortedUserIterator users(&userdb, n);
+  CallsignDB::FileSink sink(filename, db.image(0).name());
+  if (! db.encode(users, sink, err)) {
+    logError() << "Cannot encode call-sign DB: " << err.format();
+    return false;
+  }
+  if (! sink.close(err)) {
+    logError() << "Cannot write output call-sign DB file '" << filename << "': " << err.format();
+    return false;
+  }
+  return true;
+}
+
+
 int encodeCallsignDB(QCommandLineParser &parser, QCoreApplication &app) {
   Q_UNUSED(app);
 
@@ -43,9 +67,9 @@ int encodeCallsignDB(QCommandLineParser &parser, QCoreApplication &app) {
     }
   }
 
+  QSet<unsigned> prefixes;
   if (parser.isSet("id")) {
     QStringList prefixes_text = parser.value("id").split(",");
-    QSet<unsigned> prefixes;
     foreach (QString prefix_text, prefixes_text) {
       bool ok=true; uint32_t prefix = prefix_text.toUInt(&ok);
       if (ok)
@@ -61,7 +85,6 @@ int encodeCallsignDB(QCommandLineParser &parser, QCoreApplication &app) {
       prefixes_text.append(QString::number(prefix));
     }
     logDebug() << "Sort call-sign DB w.r.t. DMR ID(s) {" << prefixes_text.join(", ") << "}.";
-    userdb.sortUsers(prefixes);
   } else {
     logWarn() << "No ID is specified, a more or less random set of call-signs will be used "
               << "if the radio cannot hold the entire call-sign DB of " << userdb.count()
@@ -79,6 +102,10 @@ int encodeCallsignDB(QCommandLineParser &parser, QCoreApplication &app) {
     }
   }
 
+  // Only the entries selected by the limit need to be sorted
+  if (! prefixes.isEmpty())
+    userdb.sortUsers(prefixes, selection.hasCountLimit() ? qint64(selection.countLimit()) : -1);
+
   if (! parser.isSet("radio")) {
     logError() << "You have to specify the radio using the --radio option.";
     parser.showHelp(-1);
@@ -165,26 +192,12 @@ int encodeCallsignDB(QCommandLineParser &parser, QCoreApplication &app) {
     }
   } else if ((RadioInfo::D868UVE == radio) || (RadioInfo::D878UV == radio) || (RadioInfo::DMR6X2UV == radio)){
     D868UVCallsignDB db;
-    if (! db.encode(&userdb, selection, err)) {
-      logError() << "Cannot encode call-sign DB: " << err.format();
+    if (! encodeCallsignDBStreaming(db, userdb, selection, parser.positionalArguments().at(1), err))
       return -1;
-    }
-    if (! db.write(parser.positionalArguments().at(1), err)) {
-      logError() << "Cannot write output call-sign DB file '" << parser.positionalArguments().at(1)
-                 << "': " << err.format();
-      return -1;
-    }
   } else if ((RadioInfo::D878UVII == radio) || (RadioInfo::D578UV == radio) || (RadioInfo::D168UV == radio) || (RadioInfo::DMR6X2UV2 == radio)){
     D878UV2CallsignDB db;
-    if (! db.encode(&userdb, selection, err)) {
-      logError() << "Cannot encode call-sign DB: " << err.format();
+    if (! encodeCallsignDBStreaming(db, userdb, selection, parser.positionalArguments().at(1), err))
       return -1;
-    }
-    if (! db.write(parser.positionalArguments().at(1), err)) {
-      logError() << "Cannot write output call-sign DB file '" << parser.positionalArguments().at(1)
-                 << "': " << err.format();
-      return -1;
-    }
   } else {
     logError() << "Cannot encode calls-sign DB: Not implemented for '" << parser.value("radio") << "'.";
     return -1;
@@ -89,6 +89,7 @@ int encodeCodeplug(QCommandLineParser &parser, QCoreApplication &app) {
     flags.setAutoEnableGPS(true);
   if (parser.isSet("auto-enable-roaming"))
     flags.setAutoEnableRoaming(true);
+  flags.setParallelEncode(parser.isSet("parallel-encode"));
 
   Config config;
   ErrorStack err;
@@ -71,6 +71,12 @@ int main(int argc, char *argv[])
                      "automatically. Please note, that for some radios the device must be specified."),
                      QCoreApplication::translate("main", "DEVICE")
                    });
+  parser.addOption(QCommandLineOption(
+                     "all-devices",
+                     QCoreApplication::translate(
+                       "main", "Writes the codeplug to all detected radios concurrently. Prints a "
+                       "summary of the duration and result for each device. Can be used with "
+                       "'write'.")));
   parser.addOption({
                      {"R", "radio"},
                      QCoreApplication::translate("main", "Specifies the radio. This option can also "
@@ -106,6 +112,46 @@ int main(int argc, char *argv[])
                      QCoreApplication::translate(
                        "main", "If present, the device clock gets set to the system time on any "
                        "transfer to the radio.")));
+  parser.addOption(QCommandLineOption(
+                     "cache-image",
+                     QCoreApplication::translate(
+                       "main", "If present, a local copy of the codeplug read from or written to "
+                       "the radio is kept and reused on the next read, after verifying some "
+                       "samples. Only reading a codeplug benefits from it. Not all radios "
+                       "support this feature.")));
+  parser.addOption(QCommandLineOption(
+                     "pipelined",
+                     QCoreApplication::translate(
+                       "main", "If present, several read requests are sent to the radio at once, "
+                       "speeding-up codeplug transfers. Falls back to one request at a time if "
+                       "the radio does not respond as expected. Not all radios support this "
+                       "feature.")));
+  parser.addOption(QCommandLineOption(
+                     "dry-run",
+                     QCoreApplication::translate(
+                       "main", "If present, the codeplug or call-sign DB is not written to the "
+                       "radio. Instead, the memory sectors that would be erased and written are "
+                       "reported. Not all radios support this feature.")));
+  parser.addOption(QCommandLineOption(
+                     "parallel-encode",
+                     QCoreApplication::translate(
+                       "main", "If present, independent sections of the codeplug are encoded "
+                       "concurrently. Not all radios support this feature.")));
+  parser.addOption({
+                     "jobs",
+                     QCoreApplication::translate("main", "Specifies the number of threads used to "
+                     "verify the codeplug. The issues found are reported in the same order as "
+                     "for a single thread."),
+                     QCoreApplication::translate("main", "N"), "1"
+                   });
+  parser.addOption({
+                     "stats",
+                     QCoreApplication::translate("main", "Writes statistics of the transfer to or "
+                     "from the radio as JSON into the given file. That is, the time spent, the "
+                     "bytes transferred, requests and retries per phase as well as a histogram of "
+                     "the request latencies. Use '-' to write to stdout."),
+                     QCoreApplication::translate("main", "FILENAME")
+                   });
   parser.addOption(QCommandLineOption(
                      "auto-enable-gps",
                      QCoreApplication::translate(
@@ -185,6 +231,9 @@ int main(int argc, char *argv[])
     handler->setMinLevel(LogMessage::DEBUG);
   }
 
+  // Do not stall transfers on console I/O
+  Logger::get().setAsynchronous(true);
+
   int res = -1;
   QString command = parser.positionalArguments().at(0);
 
@@ -213,5 +262,8 @@ int main(int argc, char *argv[])
   QEventLoop loop;
   while(loop.processEvents()) {}
 
+  // Pass pending messages to the handler, before the stream gets destroyed.
+  Logger::get().setAsynchronous(false);
+
   return res;
 }
@@ -0,0 +1,39 @@
+#include "printstats.hh"
+
+#include <QCommandLineParser>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QFile>
+
+#include "logger.hh"
+#include "radio.hh"
+
+
+bool printStats(QCommandLineParser &parser, const Radio *radio) {
+  if ((! parser.isSet("stats")) || (nullptr == radio))
+    return true;
+
+  QJsonObject obj = radio->stats().toJson();
+  obj.insert("radio", radio->name());
+  QByteArray json = QJsonDocument(obj).toJson(QJsonDocument::Indented);
+
+  QString filename = parser.value("stats");
+  QFile file(filename);
+  bool opened = false;
+  if ("-" == filename)
+    opened = file.open(stdout, QIODevice::WriteOnly);
+  else
+    opened = file.open(QIODevice::WriteOnly);
+  if (! opened) {
+    logError() << "Cannot write transfer statistics to '" << filename << "': "
+               << file.errorString();
+    return false;
+  }
+
+  // The progress bar does not end its line.
+  if ("-" == filename)
+    file.write("\n");
+  file.write(json);
+  file.close();
+  return true;
+}
@@ -0,0 +1,11 @@
+#ifndef PRINTSTATS_HH
+#define PRINTSTATS_HH
+
+class QCommandLineParser;
+class Radio;
+
+/** If the --stats option is set, writes the transfer statistics of the given radio as JSON into
+ * the specified file or to stdout, if the file name is "-". */
+bool printStats(QCommandLineParser &parser, const Radio *radio);
+
+#endif // PRINTSTATS_HH
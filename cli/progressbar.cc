@@ -1,4 +1,5 @@
 #include "progressbar.hh"
+#include <algorithm>
 
 void showProgress(unsigned percent) {
   std::cerr << "[";
@@ -15,3 +16,19 @@ void updateProgress(unsigned percent) {
   std::cerr << "\033[1A\033[K";
   showProgress(percent);
 }
+
+void showDeviceProgress(const QStringList &labels, const QVector<unsigned> &percent) {
+  int width = 0;
+  foreach (const QString &label, labels)
+    width = std::max(width, int(label.size()));
+  for (int i=0; i<labels.size(); i++) {
+    std::cerr << labels.at(i).leftJustified(width).toStdString() << " ";
+    showProgress(percent.value(i, 0));
+  }
+}
+
+void updateDeviceProgress(const QStringList &labels, const QVector<unsigned> &percent) {
+  for (int i=0; i<labels.size(); i++)
+    std::cerr << "\033[1A\033[K";
+  showDeviceProgress(labels, percent);
+}
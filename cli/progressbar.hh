@@ -2,8 +2,13 @@
 #define PROGRESSBAR_HH
 
 #include <iostream>
+#include <QStringList>
+#include <QVector>
 
 void showProgress(unsigned percent=0);
 void updateProgress(unsigned percent);
 
+void showDeviceProgress(const QStringList &labels, const QVector<unsigned> &percent);
+void updateDeviceProgress(const QStringList &labels, const QVector<unsigned> &percent);
+
 #endif // PROGRESSBAR_HH
@@ -11,6 +11,7 @@
 #include "codeplug.hh"
 #include "progressbar.hh"
 #include "autodetect.hh"
+#include "printstats.hh"
 
 
 int readCodeplug(QCommandLineParser &parser, QCoreApplication &app)
@@ -36,9 +37,13 @@ int readCodeplug(QCommandLineParser &parser, QCoreApplication &app)
 
   TransferFlags flags;
   flags.setBlocking(true);
+  flags.setUseImageCache(parser.isSet("cache-image"));
+  flags.setPipelined(parser.isSet("pipelined"));
 
   Config config;
-  if (! radio->startDownload(flags, err)) {
+  bool success = radio->startDownload(flags, err);
+  printStats(parser, radio);
+  if (! success) {
     logError() << "Codeplug download error: " << err.format();
     return -1;
   }
@@ -91,6 +91,15 @@ int verify(QCommandLineParser &parser, QCoreApplication &app)
 
 
   RadioLimitContext ctx;
+  if (parser.isSet("jobs")) {
+    bool ok; unsigned jobs = parser.value("jobs").toUInt(&ok);
+    if ((! ok) || (0 == jobs)) {
+      logError() << "Invalid number of jobs '" << parser.value("jobs") << "'.";
+      return -1;
+    }
+    ctx.setJobs(jobs);
+  }
+
   switch (RadioInfo::byKey(parser.value("radio").toLower()).id()) {
   case RadioInfo::RD5R: if (! verify<RD5R>(config, ctx)) return -1; break;
   case RadioInfo::MD390: if (! verify<MD390>(config, ctx)) return -1; break;
@@ -5,10 +5,12 @@
 
 #include "logger.hh"
 #include "radio.hh"
+#include "radiolimits.hh"
 #include "userdatabase.hh"
 #include "progressbar.hh"
 #include "callsigndb.hh"
 #include "autodetect.hh"
+#include "printstats.hh"
 
 
 int writeCallsignDB(QCommandLineParser &parser, QCoreApplication &app) {
@@ -33,9 +35,9 @@ int writeCallsignDB(QCommandLineParser &parser, QCoreApplication &app) {
     }
   }
 
+  QSet<unsigned> prefixes;
   if (parser.isSet("id")) {
     QStringList prefixes_text = parser.value("id").split(",");
-    QSet<unsigned> prefixes;
     foreach (QString prefix_text, prefixes_text) {
       bool ok=true; uint32_t prefix = prefix_text.toUInt(&ok);
       if (ok)
@@ -51,7 +53,6 @@ int writeCallsignDB(QCommandLineParser &parser, QCoreApplication &app) {
       prefixes_text.append(QString::number(prefix));
     }
     logDebug() << "Sort call-sign DB w.r.t. DMR ID(s) {" << prefixes_text.join(", ") << "}.";
-    userdb.sortUsers(prefixes);
   } else {
     logWarn() << "No ID is specified, a more or less random set of call-signs will be used "
               << "if the radio cannot hold the entire call-sign DB of " << userdb.count()
@@ -61,6 +62,7 @@ int writeCallsignDB(QCommandLineParser &parser, QCoreApplication &app) {
 
   CallsignDB::Flags selection;
   selection.setUpdateDeviceClock(parser.isSet("update-device-clock"));
+  selection.setDryRun(parser.isSet("dry-run"));
   if (parser.isSet("limit")) {
     bool ok=true;
     selection.setCountLimit(parser.value("limit").toUInt(&ok));
@@ -77,13 +79,26 @@ int writeCallsignDB(QCommandLineParser &parser, QCoreApplication &app) {
     return -1;
   }
 
+  // Only the entries written to the device need to be sorted. If the capacity of the DB is
+  // unknown, all entries get sorted.
+  if (! prefixes.isEmpty()) {
+    qint64 numEntries = -1;
+    if (radio->callsignDB())
+      numEntries = radio->callsignDB()->maxEntries();
+    if (selection.hasCountLimit() && ((0 > numEntries) || (qint64(selection.countLimit()) < numEntries)))
+      numEntries = selection.countLimit();
+    userdb.sortUsers(prefixes, numEntries);
+  }
+
   if (! parser.isSet("verbose")) {
     showProgress();
     QObject::connect(radio, &Radio::downloadProgress, updateProgress);
   }
 
   selection.setBlocking(true);
-  if (! radio->startUploadCallsignDB(&userdb, selection, err)) {
+  bool success = radio->startUploadCallsignDB(&userdb, selection, err);
+  printStats(parser, radio);
+  if (! success) {
     logError() << "Could not upload call-sign DB to radio: " << err.format();
     return -1;
   }
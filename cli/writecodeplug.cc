@@ -9,8 +9,185 @@
 #include "config.hh"
 #include "progressbar.hh"
 #include "autodetect.hh"
+#include "printstats.hh"
 #include "radiolimits.hh"
 
+#include <QEventLoop>
+#include <QElapsedTimer>
+
+
+static Codeplug::Flags
+uploadFlags(QCommandLineParser &parser) {
+  Codeplug::Flags flags;
+  flags.setBlocking(true);
+  flags.setUpdateDeviceClock(parser.isSet("update-device-clock"));
+  flags.setUseImageCache(parser.isSet("cache-image"));
+  flags.setPipelined(parser.isSet("pipelined"));
+  flags.setDryRun(parser.isSet("dry-run"));
+  flags.setUpdateCodeplug(! parser.isSet("init-codeplug"));
+  flags.setAutoEnableGPS(parser.isSet("auto-enable-gps"));
+  flags.setAutoEnableRoaming(parser.isSet("auto-enable-roaming"));
+  flags.setParallelEncode(parser.isSet("parallel-encode"));
+  return flags;
+}
+
+/** Pre-processes and verifies the given codeplug for the given radio. If @c report is @c false,
+ * the verification issues are not logged. */
+static Config *
+prepareCodeplug(QCommandLineParser &parser, Radio *radio, Config &config, bool report, const ErrorStack &err) {
+  RadioLimitContext ctx(parser.isSet("ignore-limits"));
+
+  Config *intermediate = radio->codeplug().preprocess(&config, err);
+  if (nullptr == intermediate) {
+    errMsg(err) << "Cannot pre-process codeplug.";
+    return nullptr;
+  }
+
+  bool verified = true;
+  radio->limits().verifyConfig(intermediate, ctx);
+
+  // Only print warnings
+  for (int i=0; report && (i<ctx.count()); i++) {
+    switch (ctx.message(i).severity()) {
+    case RadioLimitIssue::Warning:
+      logWarn() << "Verification Issue: " << ctx.message(i).format();
+      break;
+    case RadioLimitIssue::Critical:
+      logError() << "Verification Issue: " << ctx.message(i).format();
+      break;
+    default:
+      break;
+    }
+  }
+
+  if (! verified) {
+    errMsg(err) << "Codeplug cannot be verified with radio.";
+    delete intermediate;
+    return nullptr;
+  }
+
+  return intermediate;
+}
+
+
+/** Uploads the codeplug to all detected radios concurrently. Each radio runs the upload in its
+ * own thread. */
+static int
+writeCodeplugToAll(QCommandLineParser &parser, QCoreApplication &app, Config &config) {
+  ErrorStack err;
+  QList<USBDeviceDescriptor> devices;
+  QList<Radio *> radios = autoDetectAll(parser, app, devices, err);
+  if (radios.isEmpty()) {
+    logError() << "Cannot detect radios:" << err.format();
+    return -1;
+  }
+
+  if (parser.isSet("stats"))
+    logWarn() << "Transfer statistics are not written when writing to all devices.";
+
+  Codeplug::Flags flags = uploadFlags(parser);
+  flags.setBlocking(false);
+
+  /* Per-device state of the upload. */
+  struct Target {
+    QString device;     ///< Device handle.
+    Radio *radio;       ///< The radio.
+    ErrorStack err;     ///< Error messages of this device.
+    QElapsedTimer timer;///< Measures the upload.
+    qint64 elapsed;     ///< Duration of the upload in ms.
+    bool started;       ///< If @c true, the upload was started.
+  };
+
+  QVector<Target> targets(radios.size());
+  QStringList labels;
+  QVector<unsigned> progress(radios.size(), 0);
+  for (int i=0; i<radios.size(); i++) {
+    targets[i].device = devices.at(i).deviceHandle();
+    targets[i].radio = radios.at(i);
+    targets[i].elapsed = 0;
+    targets[i].started = false;
+    labels.append(QString("%1 (%2)").arg(targets[i].device, targets[i].radio->name()));
+  }
+
+  bool showBars = ! parser.isSet("verbose");
+  if (showBars)
+    showDeviceProgress(labels, progress);
+
+  QEventLoop loop;
+  int running = 0;
+  QSet<QString> reported;
+  for (int i=0; i<targets.size(); i++) {
+    Target &target = targets[i];
+    Radio *radio = target.radio;
+    target.timer.start();
+
+    // Identical radios get identical verification issues, report them once per model.
+    bool report = ! reported.contains(radio->name());
+    reported.insert(radio->name());
+    Config *intermediate = prepareCodeplug(parser, radio, config, report, target.err);
+    if (nullptr == intermediate) {
+      target.elapsed = target.timer.elapsed();
+      continue;
+    }
+
+    // The context object ensures that these handlers are called from the main thread.
+    QObject::connect(radio, &Radio::uploadProgress, &loop, [&, i](int percent) {
+      progress[i] = percent;
+      if (showBars)
+        updateDeviceProgress(labels, progress);
+    });
+    QObject::connect(radio, &QThread::finished, &loop, [&, i]() {
+      targets[i].elapsed = targets[i].timer.elapsed();
+      progress[i] = 100;
+      if (showBars)
+        updateDeviceProgress(labels, progress);
+      if (0 == --running)
+        loop.quit();
+    });
+
+    logDebug() << "Start upload to " << radio->name() << " at " << target.device << ".";
+    if (! radio->startUpload(intermediate, flags, target.err)) {
+      target.elapsed = target.timer.elapsed();
+      QObject::disconnect(radio, nullptr, &loop, nullptr);
+      continue;
+    }
+    target.started = true;
+    running++;
+  }
+
+  if (running)
+    loop.exec();
+
+  // Print summary
+  int failed = 0;
+  QTextStream out(stdout);
+  out << QString(" %1| %2| %3| %4\n").arg("Device", -20).arg("Radio", -20).arg("Duration", -10).arg("Result");
+  out << QString("-%1+-%2+-%3+-%4\n").arg("", 20, '-').arg("", 20, '-').arg("", 10, '-').arg("", 10, '-');
+  foreach (const Target &target, targets) {
+    bool success = target.started && (Radio::StatusIdle == target.radio->status());
+    if (! success)
+      failed++;
+    out << QString(" %1| %2| %3| %4\n")
+           .arg(target.device, -20).arg(target.radio->name(), -20)
+           .arg(QString("%1 s").arg(double(target.elapsed)/1000, 0, 'f', 1), -10)
+           .arg(success ? "ok" : "failed");
+  }
+  out.flush();
+
+  foreach (const Target &target, targets) {
+    if (! target.err.isEmpty())
+      logError() << "Codeplug upload error at " << target.device << ": " << target.err.format();
+  }
+
+  if (failed) {
+    logError() << "Codeplug upload failed for " << failed << " of " << targets.size() << " radios.";
+    return -1;
+  }
+
+  logDebug() << "Upload to " << targets.size() << " radios completed.";
+  return 0;
+}
+
 
 int writeCodeplug(QCommandLineParser &parser, QCoreApplication &app) {
   if (2 > parser.positionalArguments().size())
@@ -35,6 +212,9 @@ int writeCodeplug(QCommandLineParser &parser, QCoreApplication &app) {
   }
   logDebug() << "Read codeplug from '" << filename << "'.";
 
+  if (parser.isSet("all-devices"))
+    return writeCodeplugToAll(parser, app, config);
+
   ErrorStack err;
   Radio *radio = autoDetect(parser, app, err);
   if (nullptr == radio) {
@@ -42,34 +222,9 @@ int writeCodeplug(QCommandLineParser &parser, QCoreApplication &app) {
     return -1;
   }
 
-  RadioLimitContext ctx(parser.isSet("ignore-limits"));
-
-  Config *intermediate = radio->codeplug().preprocess(&config, err);
+  Config *intermediate = prepareCodeplug(parser, radio, config, true, err);
   if (nullptr == intermediate) {
-    logError() << "Cannot pre-process codeplug: " << err.format();
-    return -1;
-  }
-
-  bool verified = true;
-  radio->limits().verifyConfig(intermediate, ctx);
-
-  // Only print warnings
-  for (int i=0; i<ctx.count(); i++) {
-    switch (ctx.message(i).severity()) {
-    case RadioLimitIssue::Warning:
-      logWarn() << "Verification Issue: " << ctx.message(i).format();
-      break;
-    case RadioLimitIssue::Critical:
-      logError() << "Verification Issue: " << ctx.message(i).format();
-      break;
-    default:
-      break;
-    }
-  }
-
-  if (! verified) {
-    logError() << "Cannot upload codeplug to device: Codeplug cannot be verified with radio.";
-    delete intermediate;
+    logError() << "Cannot upload codeplug to device: " << err.format();
     return -1;
   }
 
@@ -78,15 +233,12 @@ int writeCodeplug(QCommandLineParser &parser, QCoreApplication &app) {
     QObject::connect(radio, &Radio::downloadProgress, updateProgress);
   }
 
-  Codeplug::Flags flags;
-  flags.setBlocking(true);
-  flags.setUpdateDeviceClock(parser.isSet("update-device-clock"));
-  flags.setUpdateCodeplug(! parser.isSet("init-codeplug"));
-  flags.setAutoEnableGPS(parser.isSet("auto-enable-gps"));
-  flags.setAutoEnableRoaming(parser.isSet("auto-enable-roaming"));
+  Codeplug::Flags flags = uploadFlags(parser);
 
   logDebug() << "Start upload to " << radio->name() << ".";
-  if (! radio->startUpload(intermediate, flags, err)) {
+  bool success = radio->startUpload(intermediate, flags, err);
+  printStats(parser, radio);
+  if (! success) {
     logError() << "Codeplug upload error: " << err.format();
     return -1;
   }
@@ -1,14 +1,23 @@
 #include "addressmap.hh"
 #include <algorithm>
 
+#define PAGE_SHIFT  16
+#define BLOCK_SHIFT 4
+#define BLOCKS_PER_PAGE (1<<(PAGE_SHIFT-BLOCK_SHIFT))
+
+/** Page table entry of a block not covered by any item. */
+#define BLOCK_EMPTY     -1
+/** Page table entry of a block covered only partially or by several items. */
+#define BLOCK_AMBIGUOUS -2
+
 AddressMap::AddressMap()
-  : _items()
+  : _items(), _flat(false), _directory(), _pages()
 {
   // pass...
 }
 
 AddressMap::AddressMap(const AddressMap &other)
-  : _items(other._items)
+  : _items(other._items), _flat(other._flat), _directory(other._directory), _pages(other._pages)
 {
   // pass...
 }
@@ -16,6 +25,9 @@ AddressMap::AddressMap(const AddressMap &other)
 AddressMap &
 AddressMap::operator =(const AddressMap &other) {
   _items = other._items;
+  _flat = other._flat;
+  _directory = other._directory;
+  _pages = other._pages;
   return *this;
 }
 
@@ -23,6 +35,8 @@ AddressMap::operator =(const AddressMap &other) {
 void
 AddressMap::clear() {
   _items.clear();
+  if (_flat)
+    rebuildPages();
 }
 
 bool
@@ -36,6 +50,8 @@ AddressMap::add(uint32_t addr, uint32_t len, int idx) {
     _items.push_back(item);
   else
     _items.insert(at, item);
+  if (_flat)
+    mapItem(item);
   return true;
 }
 
@@ -49,6 +65,8 @@ AddressMap::rem(uint32_t idx) {
   if (_items.end() == at)
     return false;
   _items.erase(at);
+  if (_flat)
+    rebuildPages();
   return true;
 }
 
@@ -59,6 +77,17 @@ AddressMap::contains(uint32_t addr) const {
 
 int
 AddressMap::find(uint32_t addr) const {
+  if (_flat) {
+    int32_t page = _directory[addr >> PAGE_SHIFT];
+    if (0 > page)
+      return -1;
+    int32_t idx = _pages[page][(addr & ((1<<PAGE_SHIFT)-1)) >> BLOCK_SHIFT];
+    if (BLOCK_AMBIGUOUS != idx)
+      return idx;
+  }
+
+  if (_items.empty())
+    return -1;
   std::vector<AddrMapItem>::const_iterator at = std::lower_bound(_items.begin(), _items.end(), addr);
   if (_items.end() == at)
     return _items.back().contains(addr) ? _items.back().index : -1;
@@ -69,3 +98,51 @@ AddressMap::find(uint32_t addr) const {
   --at;
   return at->contains(addr) ? at->index : -1;
 }
+
+bool
+AddressMap::isFlat() const {
+  return _flat;
+}
+
+void
+AddressMap::setFlat(bool enable) {
+  if (enable == _flat)
+    return;
+  _flat = enable;
+  if (_flat) {
+    rebuildPages();
+  } else {
+    _directory.clear(); _directory.shrink_to_fit();
+    _pages.clear(); _pages.shrink_to_fit();
+  }
+}
+
+void
+AddressMap::mapItem(const AddrMapItem &item) {
+  if (0 == item.length)
+    return;
+
+  uint64_t end = uint64_t(item.address) + item.length;
+  for (uint64_t block = (item.address >> BLOCK_SHIFT); (block << BLOCK_SHIFT) < end; block++) {
+    uint32_t page = block >> (PAGE_SHIFT-BLOCK_SHIFT);
+    if (0 > _directory[page]) {
+      _directory[page] = _pages.size();
+      _pages.push_back(std::vector<int32_t>(BLOCKS_PER_PAGE, BLOCK_EMPTY));
+    }
+    int32_t &entry = _pages[_directory[page]][block & (BLOCKS_PER_PAGE-1)];
+    uint64_t blockStart = block << BLOCK_SHIFT, blockEnd = (block+1) << BLOCK_SHIFT;
+    bool covered = (blockStart >= item.address) && (blockEnd <= end);
+    if (covered && (BLOCK_EMPTY == entry))
+      entry = item.index;
+    else if (int32_t(item.index) != entry)
+      entry = BLOCK_AMBIGUOUS;
+  }
+}
+
+void
+AddressMap::rebuildPages() {
+  _directory.assign(1<<(32-PAGE_SHIFT), -1);
+  _pages.clear();
+  for (const AddrMapItem &item: _items)
+    mapItem(item);
+}
@@ -33,6 +33,14 @@ public:
    * -1 is returned. */
   int find(uint32_t addr) const;
 
+  /** Returns @c true if the flat page-table lookup is enabled. */
+  bool isFlat() const;
+  /** Enables or disables the flat page-table lookup.
+   * If enabled, @c find resolves addresses in constant time using a two-level page table with a
+   * granularity of 16 bytes. Only addresses within blocks that are not entirely covered by a single
+   * memory region fall back to the binary search. */
+  void setFlat(bool enable);
+
 protected:
   /** Memory map item.
    * That is, a collection of address, length and associated index. */
@@ -60,9 +68,20 @@ protected:
     }
   };
 
+  /** Adds the given item to the page table. */
+  void mapItem(const AddrMapItem &item);
+  /** Rebuilds the page table from scratch. */
+  void rebuildPages();
+
 protected:
   /** Holds the vector of memory items, the order of these items is maintained. */
   std::vector<AddrMapItem> _items;
+  /** If @c true, the page table is maintained and used for lookups. */
+  bool _flat;
+  /** Page directory, maps the upper 16 bits of the address to a page index or -1. */
+  std::vector<int32_t> _directory;
+  /** The pages, mapping 16-byte blocks to item indices. */
+  std::vector< std::vector<int32_t> > _pages;
 };
 
 #endif // ADDRESSMAP_HH
@@ -6,8 +6,11 @@
 #include "intermediaterepresentation.hh"
 #include <QTimeZone>
 #include <QRegularExpression>
+#include <QtConcurrent>
 
 #define CUSTOM_CTCSS_TONE 0x33
+// Number of elements (e.g., channels) encoded in one go, when encoding in parallel.
+#define ENCODE_CHUNK_SIZE 128
 
 
 QVector<char> _anytone_bin_dtmf_tab = {
@@ -4532,6 +4535,8 @@ AnytoneCodeplug::clear() {
     remImage(0);
 
   addImage(_label);
+  // AnyTone codeplugs consist of many small elements
+  image(0).setFlatAddressMap(true);
 
   // Allocate bitmaps
   this->allocateBitmaps();
@@ -4726,6 +4731,81 @@ AnytoneCodeplug::encode(Config *config, const Flags &flags, const ErrorStack &er
   return this->encodeElements(flags, ctx, err);
 }
 
+bool
+AnytoneCodeplug::encodeTasks(const QVector<EncodeTask> &tasks, const Flags &flags, Context &ctx,
+                             const ErrorStack &err)
+{
+  if (! flags.parallelEncode()) {
+    for (auto task: tasks) {
+      if (! task(err))
+        return false;
+    }
+    return true;
+  }
+
+  // Each task gets its own error stack, they get merged in order afterwards.
+  struct Job { EncodeTask task; ErrorStack err; bool ok; };
+  QVector<Job> jobs; jobs.reserve(tasks.size());
+  for (auto task: tasks)
+    jobs.append(Job{task, ErrorStack(), true});
+
+  // Make sure, neither the context nor the codeplug memory layout gets modified concurrently.
+  bool wasFrozen = ctx.isFrozen();
+  ctx.freeze();
+  detachElements();
+  QtConcurrent::blockingMap(jobs, [](Job &job) { job.ok = job.task(job.err); });
+  if (! wasFrozen)
+    ctx.thaw();
+
+  bool ok = true;
+  for (const auto &job: jobs) {
+    err.take(job.err);
+    ok = ok && job.ok;
+  }
+  return ok;
+}
+
+bool
+AnytoneCodeplug::encodeRange(unsigned int n, const Flags &flags,
+                             const std::function<bool(unsigned int, const ErrorStack &)> &encode,
+                             const ErrorStack &err)
+{
+  if ((! flags.parallelEncode()) || (n <= ENCODE_CHUNK_SIZE)) {
+    for (unsigned int i=0; i<n; i++) {
+      if (! encode(i, err))
+        return false;
+    }
+    return true;
+  }
+
+  struct Chunk { unsigned int first, last; ErrorStack err; bool ok; };
+  QVector<Chunk> chunks;
+  for (unsigned int i=0; i<n; i+=ENCODE_CHUNK_SIZE)
+    chunks.append(Chunk{i, std::min(n, i+ENCODE_CHUNK_SIZE), ErrorStack(), true});
+
+  detachElements();
+  QtConcurrent::blockingMap(chunks, [&encode](Chunk &chunk) {
+    for (unsigned int i=chunk.first; chunk.ok && (i<chunk.last); i++)
+      chunk.ok = encode(i, chunk.err);
+  });
+
+  bool ok = true;
+  for (const auto &chunk: chunks) {
+    err.take(chunk.err);
+    ok = ok && chunk.ok;
+  }
+  return ok;
+}
+
+void
+AnytoneCodeplug::detachElements() {
+  for (int i=0; i<numImages(); i++) {
+    for (int j=0; j<image(i).numElements(); j++)
+      image(i).element(j).data().detach();
+  }
+}
+
+
 bool
 AnytoneCodeplug::decode(Config *config, const ErrorStack &err) {
   // Maps code-plug indices to objects
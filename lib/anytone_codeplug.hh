@@ -7,6 +7,7 @@
 #include "codeplug.hh"
 #include "contact.hh"
 #include <QGeoCoordinate>
+#include <functional>
 
 class RadioSettings;
 
@@ -3442,6 +3443,26 @@ protected:
   /** Links all previously created config objects. */
   virtual bool linkElements(Context &ctx, const ErrorStack &err=ErrorStack()) = 0;
 
+  /** A self-contained encoding step, see @c encodeTasks. */
+  typedef std::function<bool(const ErrorStack &err)> EncodeTask;
+  /** Runs the given encoding tasks.
+   *
+   * The tasks must write into disjoint regions of the codeplug and must not modify the context.
+   * If parallel encoding is enabled via @c flags, the tasks are run concurrently on the global
+   * thread pool against a frozen context. Otherwise, they are run in order. In both cases, error
+   * messages are passed on in task order. */
+  bool encodeTasks(const QVector<EncodeTask> &tasks, const Flags &flags, Context &ctx,
+                   const ErrorStack &err=ErrorStack());
+  /** Calls @c encode for each index @c 0...n-1. If parallel encoding is enabled, the range is
+   * split into chunks, which are encoded concurrently. Like for @c encodeTasks, @c encode must
+   * only touch the memory associated with the given index. */
+  bool encodeRange(unsigned int n, const Flags &flags,
+                   const std::function<bool(unsigned int i, const ErrorStack &err)> &encode,
+                   const ErrorStack &err=ErrorStack());
+  /** Ensures that all elements own their data. This must be called before the codeplug memory
+   * is accessed from several threads, as @c data() may detach an element otherwise. */
+  void detachElements();
+
 protected:
   /** Holds the image label. */
   QString _label;
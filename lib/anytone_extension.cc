@@ -28,7 +28,7 @@ AnytoneAPRSFrequency::setFrequency(Frequency freq) {
   if (_frequency == freq)
     return;
   _frequency = freq;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -77,7 +77,7 @@ AnytoneChannelExtension::setFrequencyCorrection(int corr) {
   if (corr == _frequencyCorrection)
     return;
   _frequencyCorrection = corr;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -89,7 +89,7 @@ AnytoneChannelExtension::enableHandsFree(bool enable) {
   if (enable == _handsFree)
     return;
   _handsFree = enable;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneAPRSFrequencyRef *
@@ -106,7 +106,7 @@ AnytoneChannelExtension::setAPRSPTT(APRSPTT mode) {
   if (_aprsPTT == mode)
     return;
   _aprsPTT = mode;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -140,7 +140,7 @@ AnytoneFMChannelExtension::enableRXCustomCTCSS(bool enable) {
   if (enable == _rxCustomCTCSS)
     return;
   _rxCustomCTCSS = enable;
-  emit modified(this);
+  emitModified();
 }
 bool
 AnytoneFMChannelExtension::txCustomCTCSS() const {
@@ -151,7 +151,7 @@ AnytoneFMChannelExtension::enableTXCustomCTCSS(bool enable) {
   if (enable == _txCustomCTCSS)
     return;
   _txCustomCTCSS = enable;
-  emit modified(this);
+  emitModified();
 }
 double
 AnytoneFMChannelExtension::customCTCSS() const {
@@ -162,7 +162,7 @@ AnytoneFMChannelExtension::setCustomCTCSS(double freq) {
   if (freq == _customCTCSS)
     return;
   _customCTCSS = freq;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneFMChannelExtension::SquelchMode
@@ -174,7 +174,7 @@ AnytoneFMChannelExtension::setSquelchMode(SquelchMode mode) {
   if (mode == _squelchMode)
     return;
   _squelchMode = mode;
-  emit modified(this);
+  emitModified();
 }
 
 Frequency
@@ -186,7 +186,7 @@ AnytoneFMChannelExtension::setScramblerFrequency(const Frequency &f) {
   if (f == _scramblerFrequency)
     return;
   _scramblerFrequency = f;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -219,7 +219,7 @@ AnytoneDMRChannelExtension::enableAdaptiveTDMA(bool enable) {
   if (enable == _adaptiveTDMA)
     return;
   _adaptiveTDMA = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -231,7 +231,7 @@ AnytoneDMRChannelExtension::enableThroughMode(bool enable) {
   if (enable == _throughMode)
     return;
   _throughMode = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -243,7 +243,7 @@ void AnytoneDMRChannelExtension::enableCRC(bool enable) {
   if (enable == _crc)
     return;
   _crc = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -276,7 +276,7 @@ AnytoneZoneExtension::enableHidden(bool enable) {
   if (_hidden == enable)
     return;
   _hidden = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -342,7 +342,7 @@ AnytoneFMAPRSSettingsExtension::setTXDelay(Interval intv) {
   if (_txDelay == intv)
     return;
   _txDelay = intv;
-  emit modified(this);
+  emitModified();
 }
 
 Interval
@@ -354,7 +354,7 @@ AnytoneFMAPRSSettingsExtension::setPreWaveDelay(Interval intv) {
   if (_preWaveDelay == intv)
     return;
   _preWaveDelay = intv;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -366,7 +366,7 @@ AnytoneFMAPRSSettingsExtension::enablePassAll(bool enable) {
   if (_passAll == enable)
     return;
   _passAll = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -378,7 +378,7 @@ AnytoneFMAPRSSettingsExtension::enableReportPosition(bool enable) {
   if (_reportPosition == enable)
     return;
   _reportPosition = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -390,7 +390,7 @@ AnytoneFMAPRSSettingsExtension::enableReportMicE(bool enable) {
   if (_reportMicE == enable)
     return;
   _reportMicE = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -402,7 +402,7 @@ AnytoneFMAPRSSettingsExtension::enableReportObject(bool enable) {
   if (_reportObject == enable)
     return;
   _reportObject = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -414,7 +414,7 @@ AnytoneFMAPRSSettingsExtension::enableReportItem(bool enable) {
   if (_reportItem == enable)
     return;
   _reportItem = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -426,7 +426,7 @@ AnytoneFMAPRSSettingsExtension::enableReportMessage(bool enable) {
   if (_reportMessage == enable)
     return;
   _reportMessage = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -438,7 +438,7 @@ AnytoneFMAPRSSettingsExtension::enableReportWeather(bool enable) {
   if (_reportWeather == enable)
     return;
   _reportWeather = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -450,7 +450,7 @@ AnytoneFMAPRSSettingsExtension::enableReportNMEA(bool enable) {
   if (_reportNMEA == enable)
     return;
   _reportNMEA = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -462,7 +462,7 @@ AnytoneFMAPRSSettingsExtension::enableReportStatus(bool enable) {
   if (_reportStatus == enable)
     return;
   _reportStatus = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -474,7 +474,7 @@ AnytoneFMAPRSSettingsExtension::enableReportOther(bool enable) {
   if (_reportOther == enable)
     return;
   _reportOther = enable;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneAPRSFrequencyList *
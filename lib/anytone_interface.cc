@@ -1,12 +1,18 @@
 #include "anytone_interface.hh"
 #include "logger.hh"
 #include <QtEndian>
+#include <QVector>
+#include <QElapsedTimer>
+#include <algorithm>
 
 #define USB_VID_GD32  0x28e9
 #define USB_PID_GD32  0x018a
 #define USB_VID_STM32 0x2e3c
 #define USB_PID_STM32 0x5740
 
+/** Time in ms to wait for late responses after a failed pipelined read. */
+#define DRAIN_TIMEOUT 100
+
 /* ********************************************************************************************* *
  * Implementation of AnytoneInterface::ReadRequest
  * ********************************************************************************************* */
@@ -88,7 +94,8 @@ AnytoneInterface::RadioVariant::isValid() const {
  * Implementation of AnytoneInterface
  * ********************************************************************************************* */
 AnytoneInterface::AnytoneInterface(const USBDeviceDescriptor &descriptor, const ErrorStack &err, QObject *parent)
-  : USBSerial(descriptor, QSerialPort::Baud115200, err, parent), _state(STATE_INITIALIZED), _info()
+  : USBSerial(descriptor, QSerialPort::Baud115200, err, parent), _state(STATE_INITIALIZED), _info(),
+    _readWindow(1), _writeWindow(1)
 {
   if (isOpen()) {
     _state = STATE_OPEN;
@@ -138,6 +145,26 @@ AnytoneInterface::getInfo(RadioVariant &info) {
   return false;
 }
 
+unsigned int
+AnytoneInterface::readWindow() const {
+  return _readWindow;
+}
+
+void
+AnytoneInterface::setReadWindow(unsigned int n) {
+  _readWindow = std::max(1U, n);
+}
+
+unsigned int
+AnytoneInterface::writeWindow() const {
+  return _writeWindow;
+}
+
+void
+AnytoneInterface::setWriteWindow(unsigned int n) {
+  _writeWindow = std::max(1U, n);
+}
+
 bool
 AnytoneInterface::write_start(uint32_t bank, uint32_t addr, const ErrorStack &err)
 {
@@ -161,9 +188,20 @@ AnytoneInterface::write(uint32_t bank, uint32_t addr, uint8_t *data, int nbytes,
     return false;
   }
 
+  // Each request writes a complete block, there is no way to write a partial one.
+  if (0 != (nbytes % 16)) {
+    errMsg(err) << "Anytone: Cannot write " << nbytes << " bytes to address "
+                << QString::number(addr, 16) << "h: Size is not a multiple of 16.";
+    return false;
+  }
+
   //logDebug() << "Anytone: Write " << nbytes << "b to addr 0x" << QString::number(addr, 16) << "...";
 
+  if (1 < _writeWindow)
+    return write_pipelined(addr, data, nbytes, err);
+
   for (int i=0; i<nbytes; i+=16) {
+    TransferStats::Request request(_stats, TransferStats::Direction::Write, 16);
     uint8_t ack;
     WriteRequest req(addr+i, (const char *)(data+i));
     if (! send_receive((const char *)&req, sizeof(WriteRequest),(char *)&ack, 1, err)) {
@@ -210,7 +248,25 @@ AnytoneInterface::read(uint32_t bank, uint32_t addr, uint8_t *data, int nbytes,
 
   //logDebug() << "Anytone: Read " << nbytes << "b from addr 0x" << QString::number(addr, 16) << "...";
 
+  if (1 < _readWindow) {
+    ErrorStack attempt;
+    if (read_pipelined(addr, data, nbytes, attempt))
+      return true;
+    if (! isOpen()) {
+      err.take(attempt);
+      return false;
+    }
+    // The device may not cope with several requests in flight. Drop any late response and
+    // continue in lock-step for the rest of the transfer.
+    logWarn() << "Anytone: Pipelined read failed, fall back to lock-step reads: "
+              << attempt.format();
+    while (waitForReadyRead(DRAIN_TIMEOUT))
+      QSerialPort::readAll();
+    _readWindow = 1;
+  }
+
   for (int i=0; i<nbytes; i+=16) {
+    TransferStats::Request request(_stats, TransferStats::Direction::Read, std::min(16, nbytes-i));
     ReadRequest req(addr + i);
     ReadResponse resp;
     if (! send_receive((const char *)&req, sizeof(ReadRequest),
@@ -223,7 +279,117 @@ AnytoneInterface::read(uint32_t bank, uint32_t addr, uint8_t *data, int nbytes,
       errMsg(err) << "Anytone: Cannot read data from device: " << error_message << ".";
       return false;
     }
-    memcpy(data+i, resp.data, 16);
+    // A trailing partial block is read entirely, but only the requested bytes are copied.
+    memcpy(data+i, resp.data, std::min(16, nbytes-i));
+  }
+
+  return true;
+}
+
+bool
+AnytoneInterface::read_pipelined(uint32_t addr, uint8_t *data, int nbytes, const ErrorStack &err) {
+  // Round up, a trailing partial block is read entirely like in lock-step mode.
+  int nreq = (nbytes+15)/16, sent = 0, received = 0;
+  QVector<bool> done(nreq, false);
+  // Each request is timed from sending it until its response arrives.
+  QVector<qint64> sentAt(nreq, 0);
+  QElapsedTimer timer; timer.start();
+
+  while (received < nreq) {
+    // Fill window of outstanding requests
+    while ((sent < nreq) && ((sent-received) < int(_readWindow))) {
+      ReadRequest req(addr + 16*sent);
+      if (! send((const char *)&req, sizeof(ReadRequest), err)) {
+        errMsg(err) << "Anytone: Cannot read data from device.";
+        return false;
+      }
+      sentAt[sent++] = timer.nsecsElapsed()/1000;
+    }
+    flush();
+
+    ReadResponse resp;
+    if (! receive((char *)&resp, sizeof(ReadResponse), err)) {
+      errMsg(err) << "Anytone: Cannot read data from device.";
+      return false;
+    }
+
+    // Match response to one of the outstanding requests
+    uint32_t respAddr = qFromBigEndian(resp.addr);
+    if ((respAddr < addr) || (respAddr >= (addr + 16*sent)) || (0 != ((respAddr-addr) % 16))
+        || done[(respAddr-addr)/16]) {
+      errMsg(err) << "Anytone: Cannot read data from device: Unexpected response for address "
+                  << QString::number(respAddr, 16) << "h.";
+      return false;
+    }
+    int idx = (respAddr-addr)/16;
+
+    QString error_message;
+    if (! resp.check(respAddr, error_message)) {
+      errMsg(err) << "Anytone: Cannot read data from device: " << error_message << ".";
+      return false;
+    }
+    memcpy(data+16*idx, resp.data, std::min(16, nbytes-16*idx));
+    done[idx] = true;
+    received++;
+    if (_stats) {
+      _stats->addRequest(TransferStats::Direction::Read, std::min(16, nbytes-16*idx),
+                         timer.nsecsElapsed()/1000 - sentAt[idx]);
+    }
+  }
+
+  return true;
+}
+
+bool
+AnytoneInterface::write_pipelined(uint32_t addr, const uint8_t *data, int nbytes, const ErrorStack &err) {
+  // The size is a multiple of 16, see write().
+  int nreq = nbytes/16, sent = 0, acked = 0;
+  uint8_t acks[64];
+  // Each request is timed from sending it until its ACK arrives.
+  QVector<qint64> sentAt(nreq, 0);
+  QElapsedTimer timer; timer.start();
+
+  while (acked < nreq) {
+    // Fill window of outstanding requests
+    while ((sent < nreq) && ((sent-acked) < int(_writeWindow))) {
+      WriteRequest req(addr + 16*sent, (const char *)(data + 16*sent));
+      if (! send((const char *)&req, sizeof(WriteRequest), err)) {
+        errMsg(err) << "Anytone: Cannot write data to device.";
+        return false;
+      }
+      sentAt[sent++] = timer.nsecsElapsed()/1000;
+    }
+    flush();
+
+    // Wait for at least one ACK, then take all ACKs already received
+    if (! receive((char *)acks, 1, err)) {
+      errMsg(err) << "Anytone: Cannot write data to device.";
+      return false;
+    }
+    int n = 1;
+    qint64 pending = std::min(qint64(std::min(sent-acked, int(sizeof(acks))) - 1), bytesAvailable());
+    if (0 < pending) {
+      qint64 r = QSerialPort::read((char *)acks+1, pending);
+      if (0 > r) {
+        errMsg(err) << "Anytone: Cannot read response from device.";
+        return false;
+      }
+      n += r;
+    }
+
+    // ACKs arrive in the order of the requests
+    for (int i=0; i<n; i++, acked++) {
+      if (0x06 != acks[i]) {
+        errMsg(err) << "Anytone: Cannot write data to device at address "
+                    << QString::number(addr+16*acked, 16) << "h: Unexpected response "
+                    << (int)acks[i] << ", expected 6.";
+        return false;
+      }
+      if (_stats) {
+        _stats->addRequest(TransferStats::Direction::Write, 16,
+                           timer.nsecsElapsed()/1000 - sentAt[acked]);
+      }
+    }
   }
 
   return true;
@@ -331,6 +497,20 @@ AnytoneInterface::leave_program_mode(const ErrorStack &err) {
 
 bool
 AnytoneInterface::send_receive(const char *cmd, int clen, char *resp, int rlen, const ErrorStack &err) {
+  // Only lock-step requests are timed, responses to pipelined ones cannot be attributed.
+  QElapsedTimer timer; timer.start();
+  if (! send(cmd, clen, err))
+    return false;
+  if (! receive(resp, rlen, err)) {
+    resetRoundTripTime();
+    return false;
+  }
+  addRoundTripSample(timer.nsecsElapsed()/1000);
+  return true;
+}
+
+bool
+AnytoneInterface::send(const char *cmd, int clen, const ErrorStack &err) {
   // Try to write command to device
   if (clen != QSerialPort::write(cmd, clen)) {
     errMsg(err) << "Cannot send command to device.";
@@ -338,27 +518,25 @@ AnytoneInterface::send_receive(const char *cmd, int clen, char *resp, int rlen,
     _state = STATE_ERROR;
     return false;
   }
+  return true;
+}
 
-  // Read from device until complete response has been read
-  char *p = resp;
-  int len = rlen;
-  while (len > 0) {
-    if (! waitForReadyRead(1000)) {
-      errMsg(err) << "No response from device: Timeout.";
-      close();
-      _state = STATE_ERROR;
-      return false;
-    }
+bool
+AnytoneInterface::receive(char *resp, int rlen, const ErrorStack &err) {
+  // Wait until the complete response has arrived. Responses to pipelined requests may already
+  // be buffered.
+  if (! waitForResponse(rlen, 1000)) {
+    errMsg(err) << "No response from device: Timeout.";
+    close();
+    _state = STATE_ERROR;
+    return false;
+  }
 
-    int r = QSerialPort::read(p, len);
-    if (r < 0) {
-      errMsg(err) << "Cannot read response from device.";
-      close();
-      _state = STATE_ERROR;
-      return false;
-    }
-    p += r;
-    len-=r;
+  if (rlen != QSerialPort::read(resp, rlen)) {
+    errMsg(err) << "Cannot read response from device.";
+    close();
+    _state = STATE_ERROR;
+    return false;
   }
 
   // done
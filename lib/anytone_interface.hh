@@ -46,6 +46,26 @@ public:
    * The information is only read once. */
   bool getInfo(RadioVariant &info);
 
+  /** Returns the number of read requests kept in flight during a read.
+   * A window of 1 means, that each read request waits for its response before the next one
+   * is send (default). */
+  unsigned int readWindow() const;
+  /** Sets the number of read requests kept in flight during a read.
+   * If larger than 1, up to @c n read requests are send to the device back-to-back and the
+   * responses are matched by address. If a pipelined read fails (e.g., timeout or unexpected
+   * response), the window falls back to 1 and the read is repeated in lock-step. */
+  void setReadWindow(unsigned int n);
+
+  /** Returns the number of write requests kept in flight during a write.
+   * A window of 1 means, that each write request waits for its ACK before the next one
+   * is send (default). */
+  unsigned int writeWindow() const;
+  /** Sets the number of write requests kept in flight during a write.
+   * If larger than 1, up to @c n write requests are send to the device back-to-back. The ACKs
+   * carry no address. As the device acknowledges the requests in order, they are matched by
+   * their position. */
+  void setWriteWindow(unsigned int n);
+
   bool read_start(uint32_t bank, uint32_t addr, const ErrorStack &err=ErrorStack());
   bool read(uint32_t bank, uint32_t addr, uint8_t *data, int nbytes, const ErrorStack &err=ErrorStack());
   bool read_finish(const ErrorStack &err=ErrorStack());
@@ -65,6 +85,14 @@ protected:
   bool leave_program_mode(const ErrorStack &err=ErrorStack());
   /** Internal used method to send messages to and receive responses from radio. */
   bool send_receive(const char *cmd, int clen, char *resp, int rlen, const ErrorStack &err=ErrorStack());
+  /** Internal used method to send a message to the radio without waiting for a response. */
+  bool send(const char *cmd, int clen, const ErrorStack &err=ErrorStack());
+  /** Internal used method to receive a response of the given size from the radio. */
+  bool receive(char *resp, int rlen, const ErrorStack &err=ErrorStack());
+  /** Reads the given number of bytes, keeping up to @c readWindow() read requests in flight. */
+  bool read_pipelined(uint32_t addr, uint8_t *data, int nbytes, const ErrorStack &err=ErrorStack());
+  /** Writes the given number of bytes, keeping up to @c writeWindow() write requests in flight. */
+  bool write_pipelined(uint32_t addr, const uint8_t *data, int nbytes, const ErrorStack &err=ErrorStack());
 
 protected:
   /** Binary representation of a read request to the radio. */
@@ -128,6 +156,10 @@ protected:
   State _state;
   /** Holds the radio info. */
   RadioVariant _info;
+  /** Holds the number of read requests kept in flight. */
+  unsigned int _readWindow;
+  /** Holds the number of write requests kept in flight. */
+  unsigned int _writeWindow;
 };
 
 
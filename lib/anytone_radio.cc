@@ -4,15 +4,31 @@
 #include "config.hh"
 #include "logger.hh"
 #include "configcopyvisitor.hh"
+#include <QSerialPortInfo>
 
 #define RBSIZE 16
 #define WBSIZE 16
 
+/** Number of blocks read from the device to verify a cached element. */
+#define CACHE_SAMPLES 3
+/** Number of read requests kept in flight during codeplug down- and uploads, if pipelined
+ * transfers are enabled. */
+#define READ_WINDOW 32
+/** Number of write requests kept in flight during call-sign DB and satellite uploads. */
+#define WRITE_WINDOW 32
+/** Number of bytes passed to the interface at once during batched writes. */
+#define WRITE_BATCH 0x1000
+/** Minimum interval between two upload progress signals in ms. */
+#define PROGRESS_INTERVAL 250
+
 
 AnytoneRadio::AnytoneRadio(const QString &name, AnytoneInterface *device, QObject *parent)
   : Radio(parent), _name(name), _dev(device), _codeplugFlags(), _config(nullptr),
-    _codeplug(nullptr), _callsigns(nullptr), _satellites(nullptr)
+    _codeplug(nullptr), _callsigns(nullptr), _callsignUsers(nullptr), _satellites(nullptr),
+    _imageCache(nullptr), _readWindow(1)
 {
+  if (_dev)
+    _dev->setStats(&_stats);
   // Check if device is open
   if ((nullptr==_dev) || (! _dev->isOpen())) {
     _task = StatusError;
@@ -29,6 +45,10 @@ AnytoneRadio::~AnytoneRadio() {
     _dev->deleteLater();
     _dev = nullptr;
   }
+  if (_imageCache)
+    delete _imageCache;
+  if (_callsignUsers)
+    delete _callsignUsers;
 }
 
 const QString &
@@ -46,6 +66,16 @@ AnytoneRadio::codeplug() {
   return *_codeplug;
 }
 
+const CallsignDB *
+AnytoneRadio::callsignDB() const {
+  return _callsigns;
+}
+
+CallsignDB *
+AnytoneRadio::callsignDB() {
+  return _callsigns;
+}
+
 bool
 AnytoneRadio::startDownload(const TransferFlags &flags, const ErrorStack &err) {
   if (StatusIdle != _task)
@@ -53,6 +83,8 @@ AnytoneRadio::startDownload(const TransferFlags &flags, const ErrorStack &err) {
 
   _task = StatusDownload;
   _errorStack = err;
+  _readWindow = flags.pipelined() ? READ_WINDOW : 1;
+  openImageCache(flags);
 
   if (flags.blocking()) {
     run();
@@ -82,6 +114,8 @@ AnytoneRadio::startUpload(Config *config, const Codeplug::Flags &flags, const Er
   _task = StatusUpload;
   _codeplugFlags = flags;
   _errorStack = err;
+  _readWindow = flags.pipelined() ? READ_WINDOW : 1;
+  openImageCache(flags);
 
   if (flags.blocking()) {
     run();
@@ -103,7 +137,20 @@ AnytoneRadio::startUpload(Config *config, const Codeplug::Flags &flags, const Er
 
 bool
 AnytoneRadio::startUploadCallsignDB(UserDatabase *db, const CallsignDB::Flags &selection, const ErrorStack &err) {
-  _callsigns->encode(db, selection);
+  if (_callsignUsers) {
+    delete _callsignUsers;
+    _callsignUsers = nullptr;
+  }
+
+  if (_callsigns->hasStreamingEncoder()) {
+    // Only select the users here, the DB gets encoded while uploading.
+    qint64 n = std::min(db->count(), qint64(_callsigns->maxEntries()));
+    if (selection.hasCountLimit())
+      n = std::min(n, (qint64)selection.countLimit());
+    _callsignUsers = new CallsignDB::SortedUserIterator(db, n);
+  } else {
+    _callsigns->encode(db, selection);
+  }
 
   _task = StatusUploadCallsigns;
   _errorStack = err;
@@ -148,6 +195,8 @@ AnytoneRadio::startUploadSatelliteConfig(SatelliteDatabase *db, const TransferFl
 
 void
 AnytoneRadio::run() {
+  TransferStats::Session session(_stats);
+
   if (StatusDownload == _task) {
     if ((nullptr==_dev) || (! _dev->isOpen())) {
       _task = StatusError;
@@ -157,7 +206,10 @@ AnytoneRadio::run() {
 
     emit downloadStarted();
 
-    if (! download()) {
+    _dev->setReadWindow(_readWindow);
+    bool ok = download();
+    _dev->setReadWindow(1);
+    if (! ok) {
       _dev->reboot();
       _dev->close();
       _task = StatusError;
@@ -178,7 +230,10 @@ AnytoneRadio::run() {
 
     emit uploadStarted();
 
-    if (! upload()) {
+    _dev->setReadWindow(_readWindow);
+    bool ok = upload();
+    _dev->setReadWindow(1);
+    if (! ok) {
       _dev->reboot();
       _dev->close();
       _task = StatusError;
@@ -242,9 +297,11 @@ AnytoneRadio::download() {
     return false;
   }
 
+  _stats.beginPhase("read");
   logDebug() << "Download of " << _codeplug->image(0).numElements() << " bitmaps.";
 
   // Download bitmaps
+  QVector<ImageCache::Region> bitmaps;
   for (int n=0; n<_codeplug->image(0).numElements(); n++) {
     unsigned addr = _codeplug->image(0).element(n).address();
     unsigned size = _codeplug->image(0).element(n).data().size();
@@ -252,8 +309,10 @@ AnytoneRadio::download() {
       errMsg(_errorStack) << "Cannot download codeplug.";
       return false;
     }
+    bitmaps.append({addr, size});
     emit downloadProgress(float(n*100)/_codeplug->image(0).numElements());
   }
+  loadImageCache(bitmaps);
 
   // Allocate remaining memory sections
   unsigned nstart = _codeplug->image(0).numElements();
@@ -276,15 +335,21 @@ AnytoneRadio::download() {
   for (int n=nstart; n<_codeplug->image(0).numElements(); n++) {
     unsigned addr = _codeplug->image(0).element(n).address();
     unsigned size = _codeplug->image(0).element(n).data().size();
-    if (! _dev->read(0, addr, _codeplug->data(addr), size, _errorStack)) {
+    if (readCached(addr, size)) {
+      logDebug() << "Took " << Qt::hex << size <<
+                    "h bytes at address " << Qt::hex << addr << " from cache.";
+    } else if (! _dev->read(0, addr, _codeplug->data(addr), size, _errorStack)) {
       errMsg(_errorStack) << "Cannot download codeplug.";
       return false;
+    } else {
+      logDebug() << "Read " << Qt::hex << size <<
+                    "h bytes from address " << Qt::hex << addr << ".";
     }
-    logDebug() << "Read " << Qt::hex << size <<
-                  "h bytes from address " << Qt::hex << addr << ".";
     emit downloadProgress(float(n*100)/_codeplug->image(0).numElements());
   }
 
+  storeImageCache(bitmaps);
+
   return true;
 }
 
@@ -296,7 +361,9 @@ AnytoneRadio::upload() {
   }
 
   // Download bitmaps first
-  size_t nbitmaps = _codeplug->numImages();
+  _stats.beginPhase("read");
+  size_t nbitmaps = _codeplug->image(0).numElements();
+  QVector<ImageCache::Region> bitmaps;
   for (int n=0; n<_codeplug->image(0).numElements(); n++) {
     unsigned addr = _codeplug->image(0).element(n).address();
     unsigned size = _codeplug->image(0).element(n).data().size();
@@ -304,6 +371,7 @@ AnytoneRadio::upload() {
       errMsg(_errorStack) << "Cannot read codeplug for update.";
       return false;
     }
+    bitmaps.append({addr, size});
     emit uploadProgress(float(n*25)/_codeplug->image(0).numElements());
   }
 
@@ -311,7 +379,9 @@ AnytoneRadio::upload() {
   // and written back to the device more or less untouched
   _codeplug->allocateUpdated();
 
-  // Download new memory sections for update
+  // Download new memory sections for update. These are always read from the device, never from
+  // the image cache. They serve as the reference to decide which blocks need to be written, and
+  // untouched bytes of modified blocks are written back as read.
   for (int n=nbitmaps; n<_codeplug->image(0).numElements(); n++) {
     unsigned addr = _codeplug->image(0).element(n).address();
     unsigned size = _codeplug->image(0).element(n).data().size();
@@ -322,7 +392,14 @@ AnytoneRadio::upload() {
     emit uploadProgress(25+float(n*25)/_codeplug->image(0).numElements());
   }
 
+  // Keep a snapshot of all elements read from the device. The data is implicitly shared, hence
+  // the snapshot gets detached from the codeplug once the latter is modified during encoding.
+  QHash<uint32_t, QByteArray> snapshot;
+  for (int n=0; n<_codeplug->image(0).numElements(); n++)
+    snapshot.insert(_codeplug->image(0).element(n).address(), _codeplug->image(0).element(n).data());
+
   // Update binary codeplug from config
+  _stats.beginPhase("encode");
   if (! _codeplug->encode(_config, _codeplugFlags, _errorStack)) {
     errMsg(_errorStack) << "Cannot encode codeplug.";
     return false;
@@ -330,43 +407,71 @@ AnytoneRadio::upload() {
 
   // Sort all elements before uploading
   _codeplug->image(0).sort();
+  _stats.beginPhase("write");
 
-  // Upload all elements back to the device
+  // Upload all elements back to the device. Only those blocks are written, that differ from the
+  // snapshot read from the device. Elements not read from the device are written entirely.
+  size_t totalBlocks = _codeplug->image(0).memSize()/WBSIZE;
+  size_t blkDone = 0, blkSkipped = 0;
   for (int n=0; n<_codeplug->image(0).numElements(); n++) {
     unsigned addr = _codeplug->image(0).element(n).address();
     unsigned size = _codeplug->image(0).element(n).data().size();
-    if (! _dev->write(0, addr, _codeplug->data(addr), size, _errorStack)) {
-      errMsg(_errorStack) << "Cannot write codeplug.";
-      return false;
+    unsigned nblks = size/WBSIZE;
+    const uint8_t *data = _codeplug->data(addr);
+    const uint8_t *prev = nullptr;
+    if (snapshot.contains(addr) && (int(size) == snapshot[addr].size()))
+      prev = (const uint8_t *)snapshot[addr].constData();
+
+    unsigned i = 0;
+    while (i < nblks) {
+      if (prev && (0 == memcmp(prev+i*WBSIZE, data+i*WBSIZE, WBSIZE))) {
+        blkSkipped++; blkDone++; i++;
+        continue;
+      }
+      // Collect consecutive modified blocks
+      unsigned j = i+1;
+      while ((j < nblks) && ((nullptr == prev) || memcmp(prev+j*WBSIZE, data+j*WBSIZE, WBSIZE)))
+        j++;
+      if (! _dev->write(0, addr+i*WBSIZE, _codeplug->data(addr+i*WBSIZE), (j-i)*WBSIZE, _errorStack)) {
+        errMsg(_errorStack) << "Cannot write codeplug.";
+        return false;
+      }
+      blkDone += (j-i); i = j;
     }
-    emit uploadProgress(50+float(n*50)/_codeplug->image(0).numElements());
+    emit uploadProgress(50+float(blkDone*50)/totalBlocks);
   }
 
+  logInfo() << "Wrote " << (blkDone-blkSkipped) << " of " << totalBlocks << " blocks, skipped "
+            << blkSkipped << " unchanged blocks.";
+
+  storeImageCache(bitmaps);
+
   return true;
 }
 
 
 bool
 AnytoneRadio::uploadCallsigns() {
-  // Sort all elements before uploading
-  _callsigns->image(0).sort();
-
-  size_t totalBlocks = _callsigns->memSize()/WBSIZE;
-  size_t blkWritten  = 0;
-  // Upload all elements back to the device
-  for (int n=0; n<_callsigns->image(0).numElements(); n++) {
-    unsigned addr = _callsigns->image(0).element(n).address();
-    unsigned size = _callsigns->image(0).element(n).data().size();
-    unsigned nblks = size/WBSIZE;
-    for (unsigned i=0; i<nblks; i++) {
-      if (! _dev->write(0, addr+i*WBSIZE, _callsigns->data(addr)+i*WBSIZE, WBSIZE, _errorStack)) {
-        errMsg(_errorStack) << "Cannot write callsign db.";
-        _task = StatusError;
-        return false;
-      }
-      blkWritten++;
-      emit uploadProgress(float(blkWritten*100)/totalBlocks);
-    }
+  _progressTimer.invalidate();
+  _dev->setWriteWindow(WRITE_WINDOW);
+  // Call-signs are encoded and written in one pass
+  _stats.beginPhase("write");
+
+  bool ok;
+  if (_callsignUsers) {
+    CallsignWriter writer(this);
+    ok = _callsigns->encode(*_callsignUsers, writer, _errorStack);
+  } else {
+    // Sort all elements before uploading
+    _callsigns->image(0).sort();
+    ok = writeBatched(*_callsigns, _errorStack);
+  }
+
+  _dev->setWriteWindow(1);
+  if (! ok) {
+    errMsg(_errorStack) << "Cannot write callsign db.";
+    _task = StatusError;
+    return false;
   }
 
   return true;
@@ -378,23 +483,134 @@ AnytoneRadio::uploadSatellites() {
   // Sort all elements before uploading
   _satellites->image(0).sort();
 
-  size_t totalBlocks = _satellites->memSize()/WBSIZE;
-  size_t blkWritten  = 0;
-  // Upload all elements back to the device
-  for (int n=0; n<_satellites->image(0).numElements(); n++) {
-    unsigned addr = _satellites->image(0).element(n).address();
-    unsigned size = _satellites->image(0).element(n).data().size();
-    unsigned nblks = size/WBSIZE;
-    for (unsigned i=0; i<nblks; i++) {
-      if (! _dev->write(0, addr+i*WBSIZE, _satellites->data(addr)+i*WBSIZE, WBSIZE, _errorStack)) {
-        errMsg(_errorStack) << "Cannot write satellite config.";
-        _task = StatusError;
+  _progressTimer.invalidate();
+  _dev->setWriteWindow(WRITE_WINDOW);
+  _stats.beginPhase("write");
+  bool ok = writeBatched(*_satellites, _errorStack);
+  _dev->setWriteWindow(1);
+
+  if (! ok) {
+    errMsg(_errorStack) << "Cannot write satellite config.";
+    _task = StatusError;
+    return false;
+  }
+
+  return true;
+}
+
+
+bool
+AnytoneRadio::writeBatched(DFUFile &file, const ErrorStack &err) {
+  size_t total = file.memSize(), written = 0;
+  for (int n=0; n<file.image(0).numElements(); n++) {
+    unsigned addr = file.image(0).element(n).address();
+    unsigned size = file.image(0).element(n).data().size();
+    for (unsigned o=0, len=0; o<size; o+=len, written+=len) {
+      len = std::min(unsigned(WRITE_BATCH), size-o);
+      if (! _dev->write(0, addr+o, file.data(addr+o), len, err))
         return false;
-      }
-      blkWritten++;
-      emit uploadProgress(float(blkWritten*100)/totalBlocks);
+      reportUploadProgress(float((written+len)*100)/total);
     }
   }
 
   return true;
 }
+
+void
+AnytoneRadio::reportUploadProgress(float percent) {
+  if ((percent < 100) && _progressTimer.isValid() && (_progressTimer.elapsed() < PROGRESS_INTERVAL))
+    return;
+  _progressTimer.start();
+  emit uploadProgress(percent);
+}
+
+
+void
+AnytoneRadio::openImageCache(const TransferFlags &flags) {
+  if (_imageCache) {
+    delete _imageCache;
+    _imageCache = nullptr;
+  }
+
+  AnytoneInterface::RadioVariant variant;
+  if ((! flags.useImageCache()) || (nullptr == _dev) || (! _dev->getInfo(variant)))
+    return;
+
+  // Identify the particular radio by model, firmware version and the serial number of its USB
+  // interface. The port is not part of the key, as it changes whenever the radio gets re-plugged.
+  // Radios sharing the same serial number are told apart by the fingerprint.
+  _imageCache = new ImageCache(variant.name, variant.version, QSerialPortInfo(*_dev).serialNumber());
+}
+
+void
+AnytoneRadio::loadImageCache(const QVector<ImageCache::Region> &bitmaps) {
+  if (nullptr == _imageCache)
+    return;
+  // The bitmaps serve as the fingerprint of the codeplug within the device
+  _imageCache->load(ImageCache::fingerprint(_codeplug->image(0), bitmaps));
+}
+
+void
+AnytoneRadio::storeImageCache(const QVector<ImageCache::Region> &bitmaps) {
+  if (nullptr == _imageCache)
+    return;
+  ErrorStack err;
+  if (! _imageCache->store(_codeplug->image(0), ImageCache::fingerprint(_codeplug->image(0), bitmaps), err))
+    logWarn() << "Cannot update image cache: " << err.format();
+}
+
+bool
+AnytoneRadio::readCached(uint32_t addr, uint32_t size) {
+  if ((nullptr == _imageCache) || (! _imageCache->isLoaded()))
+    return false;
+
+  unsigned nblks = size/RBSIZE;
+  const uint8_t *cached = _imageCache->data(addr, size);
+  if ((nullptr == cached) || (nblks <= CACHE_SAMPLES))
+    return false;
+
+  // Verify first, last and some blocks in between. Errors of the sample reads are kept separate,
+  // as the element gets read entirely on a miss anyway.
+  uint8_t block[RBSIZE];
+  for (unsigned i=0; i<CACHE_SAMPLES; i++) {
+    unsigned blk = (i*(nblks-1))/(CACHE_SAMPLES-1);
+    ErrorStack err;
+    if (! _dev->read(0, addr+blk*RBSIZE, block, RBSIZE, err)) {
+      // If the device got closed, the transfer fails. Keep the cause.
+      if (! _dev->isOpen())
+        _errorStack.take(err);
+      else
+        logDebug() << "Cannot verify cached element at " << Qt::hex << addr << "h: " << err.format();
+      return false;
+    }
+    if (0 != memcmp(block, cached+blk*RBSIZE, RBSIZE))
+      return false;
+  }
+
+  memcpy(_codeplug->data(addr), cached, size);
+  return true;
+}
+
+
+/* ********************************************************************************************* *
+ * Implementation of AnytoneRadio::CallsignWriter
+ * ********************************************************************************************* */
+AnytoneRadio::CallsignWriter::CallsignWriter(AnytoneRadio *radio)
+  : CallsignDB::Sink(), _radio(radio)
+{
+  // pass...
+}
+
+bool
+AnytoneRadio::CallsignWriter::write(uint32_t address, const QByteArray &data, const ErrorStack &err) {
+  if (! _radio->_dev->write(0, address, (uint8_t *)data.constData(), data.size(), err)) {
+    errMsg(err) << "Cannot write callsign db bank at " << QString::number(address, 16) << "h.";
+    return false;
+  }
+
+  qint64 total = _radio->_callsignUsers->count();
+  if (total)
+    _radio->reportUploadProgress(float(_radio->_callsignUsers->position()*100)/total);
+
+  return true;
+}
@@ -14,6 +14,8 @@
 #include "anytone_interface.hh"
 #include "anytone_codeplug.hh"
 #include "anytone_satelliteconfig.hh"
+#include "imagecache.hh"
+#include <QElapsedTimer>
 
 /** Implements an interface to Anytone radios.
  *
@@ -24,7 +26,9 @@
  * config gets applied to the binary codeplug. That is, all channels, contacts, zones, group-lists
  * and scan-lists are generated and their bitmaps gets updated accordingly. Also the general config
  * gets updated from the common codeplug settings. Finally, the resulting binary codeplug gets
- * written back to the device.
+ * written back to the device. Only those blocks of the elements read from the device, that were
+ * actually modified by the encoding, are written back. If enabled by the transfer flags, all reads
+ * keep several read requests in flight (see @c AnytoneInterface::setReadWindow).
  *
  * This rather complex method of writing a codeplug to the device is needed to maintain all
  * settings within the radio that are not defined within the common codeplug config while keeping
@@ -46,6 +50,8 @@ public:
   const QString &name() const;
   const Codeplug &codeplug() const;
   Codeplug &codeplug();
+  const CallsignDB *callsignDB() const;
+  CallsignDB *callsignDB();
 
 public slots:
   /** Starts the download of the codeplug and derives the generic configuration from it. */
@@ -71,12 +77,46 @@ private:
   /** Uploads the encoded codeplug to the radio. This method block until the upload is complete. */
   virtual bool upload();
   /** Uploads the encoded callsign database to the radio.
-   * This method block until the upload is complete. */
+   * This method block until the upload is complete. If the callsign database provides a
+   * streaming encoder, the database gets encoded bank-by-bank while uploading. */
   virtual bool uploadCallsigns();
   /** Uploads the encoded satellite config to the radio.
    * This method block until the upload is complete. */
   virtual bool uploadSatellites();
 
+  /** Opens the image cache for the connected radio, if enabled by the given flags. */
+  void openImageCache(const TransferFlags &flags);
+  /** Tries to load the cached image matching the bitmaps read from the device. */
+  void loadImageCache(const QVector<ImageCache::Region> &bitmaps);
+  /** Stores the current codeplug in the image cache. */
+  void storeImageCache(const QVector<ImageCache::Region> &bitmaps);
+  /** Tries to fill the specified element from the image cache. Before, some sample blocks are read
+   * from the device and compared to the cached data. Only used for downloads, as the elements read
+   * before an upload serve as the reference for the blocks to write.
+   * @returns @c true if the element was taken from the cache. */
+  bool readCached(uint32_t addr, uint32_t size);
+
+  /** Writes all elements of the first image of the given file to the device in batches, keeping
+   * several write requests in flight. */
+  bool writeBatched(DFUFile &file, const ErrorStack &err=ErrorStack());
+  /** Emits the upload progress, at most every few hundred milliseconds or once complete. */
+  void reportUploadProgress(float percent);
+
+protected:
+  /** Writes the banks produced by the streaming callsign-db encoder directly to the device. */
+  class CallsignWriter: public CallsignDB::Sink
+  {
+  public:
+    /** Constructor. */
+    explicit CallsignWriter(AnytoneRadio *radio);
+
+    bool write(uint32_t address, const QByteArray &data, const ErrorStack &err=ErrorStack());
+
+  protected:
+    /** A weak reference to the radio. */
+    AnytoneRadio *_radio;
+  };
+
 protected:
   /** The device identifier. */
   QString _name;
@@ -93,8 +133,16 @@ protected:
   AnytoneCodeplug *_codeplug;
   /** The actual binary callsign database representation. */
   CallsignDB *_callsigns;
+  /** The users to stream into the callsign database, if a streaming encoder is available. */
+  CallsignDB::SortedUserIterator *_callsignUsers;
   /** The actual binary callsign database representation. */
   AnytoneSatelliteConfig *_satellites;
+  /** The optional local copy of the codeplug image. */
+  ImageCache *_imageCache;
+  /** Number of read requests kept in flight during codeplug transfers. */
+  unsigned int _readWindow;
+  /** Time since the last upload progress was emitted. */
+  QElapsedTimer _progressTimer;
 };
 
 #endif // __D868UV_HH__
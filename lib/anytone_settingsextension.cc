@@ -37,7 +37,7 @@ AnytoneDMRSettingsExtension::setManualGroupCallHangTime(Interval sec) {
   if (_manualGroupCallHangTime == sec)
     return;
   _manualGroupCallHangTime = sec;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -50,7 +50,7 @@ AnytoneDMRSettingsExtension::setManualPrivateCallHangTime(Interval sec) {
   if (_manualPrivateCallHangTime == sec)
     return;
   _manualPrivateCallHangTime = sec;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -63,7 +63,7 @@ AnytoneDMRSettingsExtension::setWakeHeadPeriod(Interval ms) {
   if (_wakeHeadPeriod == ms)
     return;
   _wakeHeadPeriod = ms;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -75,7 +75,7 @@ AnytoneDMRSettingsExtension::enableFilterOwnID(bool enable) {
   if (_filterOwnID == enable)
     return;
   _filterOwnID = enable;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneDMRSettingsExtension::SlotMatch
@@ -87,7 +87,7 @@ AnytoneDMRSettingsExtension::setMonitorSlotMatch(SlotMatch match) {
   if (_monitorSlotMatch == match)
     return;
   _monitorSlotMatch = match;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -99,7 +99,7 @@ AnytoneDMRSettingsExtension::enableMonitorColorCodeMatch(bool enable) {
   if (_monitorColorCodeMatch == enable)
     return;
   _monitorColorCodeMatch = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -111,7 +111,7 @@ AnytoneDMRSettingsExtension::enableMonitorIDMatch(bool enable) {
   if (_monitorIDMatch == enable)
     return;
   _monitorIDMatch = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -123,7 +123,7 @@ AnytoneDMRSettingsExtension::enableMonitorTimeSlotHold(bool enable) {
   if (_monitorTimeSlotHold == enable)
     return;
   _monitorTimeSlotHold = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -136,7 +136,7 @@ AnytoneDMRSettingsExtension::setTalkerAliasSource(TalkerAliasSource mode) {
   if (mode == _talkerAliasSource)
     return;
   _talkerAliasSource = mode;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -149,7 +149,7 @@ AnytoneDMRSettingsExtension::setEncryption(EncryptionType type) {
   if (type == _encryption)
     return;
   _encryption = type;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -189,7 +189,7 @@ AnytoneGPSSettingsExtension::setTimeZone(const QTimeZone &zone) {
   if (_timeZone == zone)
     return;
   _timeZone = zone;
-  emit modified(this);
+  emitModified();
 }
 
 void
@@ -208,7 +208,7 @@ AnytoneGPSSettingsExtension::enablePositionReporting(bool enable) {
   if (_gpsRangeReporting == enable)
     return;
   _gpsRangeReporting = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -222,7 +222,7 @@ AnytoneGPSSettingsExtension::setUpdatePeriod(Interval sec) {
   if (_gpsRangingInterval == sec)
     return;
   _gpsRangingInterval = sec;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -261,7 +261,7 @@ AnytoneRoamingSettingsExtension::enableAutoRoam(bool enable) {
   if (enable == _autoRoam)
     return;
   _autoRoam = enable;
-  emit modified(this);
+  emitModified();
 }
 
 Interval
@@ -273,7 +273,7 @@ AnytoneRoamingSettingsExtension::setAutoRoamPeriod(Interval min) {
   if (_autoRoamPeriod == min)
     return;
   _autoRoamPeriod = min;
-  emit modified(this);
+  emitModified();
 }
 
 Interval
@@ -285,7 +285,7 @@ AnytoneRoamingSettingsExtension::setAutoRoamDelay(Interval min) {
   if (_autoRoamDelay == min)
     return;
   _autoRoamDelay = min;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -297,7 +297,7 @@ AnytoneRoamingSettingsExtension::enableRepeaterRangeCheck(bool enable) {
   if (_repeaterRangeCheck == enable)
     return;
   _repeaterRangeCheck = enable;
-  emit modified(this);
+  emitModified();
 }
 Interval
 AnytoneRoamingSettingsExtension::repeaterCheckInterval() const {
@@ -308,7 +308,7 @@ AnytoneRoamingSettingsExtension::setRepeaterCheckInterval(Interval sec) {
   if (_repeaterCheckInterval == sec)
     return;
   _repeaterCheckInterval = sec;
-  emit modified(this);
+  emitModified();
 }
 
 unsigned int
@@ -320,7 +320,7 @@ AnytoneRoamingSettingsExtension::setRepeaterRangeCheckCount(unsigned int sec) {
   if (_repeaterRangeCheckCount == sec)
     return;
   _repeaterRangeCheckCount = sec;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneRoamingSettingsExtension::OutOfRangeAlert
@@ -332,7 +332,7 @@ AnytoneRoamingSettingsExtension::setOutOfRangeAlert(OutOfRangeAlert type) {
   if (type == _outOfRangeAlert)
     return;
   _outOfRangeAlert = type;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneRoamingSettingsExtension::RoamStart
@@ -344,7 +344,7 @@ AnytoneRoamingSettingsExtension::setRoamingStartCondition(RoamStart start) {
   if (_roamingStartCondition == start)
     return;
   _roamingStartCondition = start;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneRoamingSettingsExtension::RoamStart
@@ -356,7 +356,7 @@ AnytoneRoamingSettingsExtension::setRoamingReturnCondition(RoamStart end) {
   if (_roamingReturnCondition == end)
     return;
   _roamingReturnCondition = end;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -368,7 +368,7 @@ AnytoneRoamingSettingsExtension::enableNotification(bool enable) {
   if (_notification == enable)
     return;
   _notification = enable;
-  emit modified(this);
+  emitModified();
 }
 unsigned int
 AnytoneRoamingSettingsExtension::notificationCount() const {
@@ -379,7 +379,7 @@ AnytoneRoamingSettingsExtension::setNotificationCount(unsigned int n) {
   if (_notificationCount == n)
     return;
   _notificationCount = n;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -391,7 +391,7 @@ AnytoneRoamingSettingsExtension::enableGPSRoaming(bool enable) {
   if (enable == _gpsRoaming)
     return;
   _gpsRoaming = enable;
-  emit modified(this);
+  emitModified();
 }
 
 RoamingZoneReference *
@@ -542,7 +542,7 @@ AnytoneSettingsExtension::setVFOScanType(VFOScanType type) {
   if (_vfoScanType == type)
     return;
   _vfoScanType = type;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneSettingsExtension::VFOMode
@@ -554,7 +554,7 @@ AnytoneSettingsExtension::setModeA(VFOMode mode) {
   if (_modeA == mode)
     return;
   _modeA = mode;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneSettingsExtension::VFOMode
@@ -566,7 +566,7 @@ AnytoneSettingsExtension::setModeB(VFOMode mode) {
   if (_modeB == mode)
     return;
   _modeB = mode;
-  emit modified(this);
+  emitModified();
 }
 
 ZoneReference *
@@ -595,7 +595,7 @@ AnytoneSettingsExtension::setSelectedVFO(VFO vfo) {
   if (_selectedVFO == vfo)
     return;
   _selectedVFO = vfo;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -607,7 +607,7 @@ AnytoneSettingsExtension::enableSubChannel(bool enable) {
   if (_subChannel == enable)
     return;
   _subChannel = enable;
-  emit modified(this);
+  emitModified();
 }
 
 Frequency
@@ -619,7 +619,7 @@ AnytoneSettingsExtension::setMinVFOScanFrequencyUHF(Frequency hz) {
   if (_minVFOScanFrequencyUHF == hz)
     return;
   _minVFOScanFrequencyUHF = hz;
-  emit modified(this);
+  emitModified();
 }
 Frequency
 AnytoneSettingsExtension::maxVFOScanFrequencyUHF() const {
@@ -630,7 +630,7 @@ AnytoneSettingsExtension::setMaxVFOScanFrequencyUHF(Frequency hz) {
   if (_maxVFOScanFrequencyUHF == hz)
     return;
   _maxVFOScanFrequencyUHF = hz;
-  emit modified(this);
+  emitModified();
 }
 
 Frequency
@@ -642,7 +642,7 @@ AnytoneSettingsExtension::setMinVFOScanFrequencyVHF(Frequency hz) {
   if (_minVFOScanFrequencyVHF == hz)
     return;
   _minVFOScanFrequencyVHF = hz;
-  emit modified(this);
+  emitModified();
 }
 Frequency
 AnytoneSettingsExtension::maxVFOScanFrequencyVHF() const {
@@ -653,7 +653,7 @@ AnytoneSettingsExtension::setMaxVFOScanFrequencyVHF(Frequency hz) {
   if (_maxVFOScanFrequencyVHF == hz)
     return;
   _maxVFOScanFrequencyVHF = hz;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -665,7 +665,7 @@ AnytoneSettingsExtension::enableKeepLastCaller(bool enable) {
   if (_keepLastCaller == enable)
     return;
   _keepLastCaller = enable;
-  emit modified(this);
+  emitModified();
 }
 
 Frequency
@@ -677,7 +677,7 @@ AnytoneSettingsExtension::setVFOStep(Frequency step) {
   if (_vfoStep == step)
     return;
   _vfoStep = step;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneSettingsExtension::STEType
@@ -689,7 +689,7 @@ AnytoneSettingsExtension::setSTEType(STEType type) {
   if (_steType == type)
     return;
   _steType = type;
-  emit modified(this);
+  emitModified();
 }
 double
 AnytoneSettingsExtension::steFrequency() const {
@@ -700,7 +700,7 @@ AnytoneSettingsExtension::setSTEFrequency(double freq) {
   if (_steFrequency == freq)
     return;
   _steFrequency = freq;
-  emit modified(this);
+  emitModified();
 }
 
 Interval
@@ -712,7 +712,7 @@ AnytoneSettingsExtension::setSTEDuration(Interval intv) {
   if (intv == _steDuration)
     return;
   _steDuration = intv;
-  emit modified(this);
+  emitModified();
 }
 
 Frequency
@@ -724,7 +724,7 @@ AnytoneSettingsExtension::setTBSTFrequency(Frequency Hz) {
   if (_tbstFrequency == Hz)
     return;
   _tbstFrequency = Hz;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -738,7 +738,7 @@ AnytoneSettingsExtension::enableProMode(bool enable) {
   if (_proMode == enable)
     return;
   _proMode = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -752,7 +752,7 @@ AnytoneSettingsExtension::enableMaintainCallChannel(bool enable) {
   if (_maintainCallChannel == enable)
     return;
   _maintainCallChannel = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -766,7 +766,7 @@ AnytoneSettingsExtension::setFan(FanControl ctrl) {
   if (_fan == ctrl)
     return;
   _fan = ctrl;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -811,7 +811,7 @@ AnytoneBootSettingsExtension::enableGPSCheck(bool enable) {
   if (_gpsCheck == enable)
     return;
   _gpsCheck = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -844,7 +844,7 @@ AnytonePowerSaveSettingsExtension::setAutoShutdown(Interval intv) {
   if (_autoShutDownDelay == intv)
     return;
   _autoShutDownDelay = intv;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -856,7 +856,7 @@ AnytonePowerSaveSettingsExtension::enableResetAutoShutdownOnCall(bool enable) {
   if (enable == _resetAutoShutdownOnCall)
     return;
   _resetAutoShutdownOnCall = enable;
-  emit modified(this);
+  emitModified();
 }
 
 AnytonePowerSaveSettingsExtension::PowerSave
@@ -868,7 +868,7 @@ AnytonePowerSaveSettingsExtension::setPowerSave(PowerSave save) {
   if (_powerSave == save)
     return;
   _powerSave = save;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -880,7 +880,7 @@ AnytonePowerSaveSettingsExtension::enableATPC(bool enable) {
   if (enable == _atpc)
     return;
   _atpc = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -928,7 +928,7 @@ AnytoneKeySettingsExtension::setFuncKey1Short(KeyFunction func) {
   if (_funcKey1Short == func)
     return;
   _funcKey1Short = func;
-  emit modified(this);
+  emitModified();
 }
 AnytoneKeySettingsExtension::KeyFunction
 AnytoneKeySettingsExtension::funcKey1Long() const {
@@ -939,7 +939,7 @@ AnytoneKeySettingsExtension::setFuncKey1Long(KeyFunction func) {
   if (_funcKey1Long == func)
     return;
   _funcKey1Long = func;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneKeySettingsExtension::KeyFunction
@@ -951,7 +951,7 @@ AnytoneKeySettingsExtension::setFuncKey2Short(KeyFunction func) {
   if (_funcKey2Short == func)
     return;
   _funcKey2Short = func;
-  emit modified(this);
+  emitModified();
 }
 AnytoneKeySettingsExtension::KeyFunction
 AnytoneKeySettingsExtension::funcKey2Long() const {
@@ -962,7 +962,7 @@ AnytoneKeySettingsExtension::setFuncKey2Long(KeyFunction func) {
   if (_funcKey2Long == func)
     return;
   _funcKey2Long = func;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneKeySettingsExtension::KeyFunction
@@ -974,7 +974,7 @@ AnytoneKeySettingsExtension::setFuncKey3Short(KeyFunction func) {
   if (_funcKey3Short == func)
     return;
   _funcKey3Short = func;
-  emit modified(this);
+  emitModified();
 }
 AnytoneKeySettingsExtension::KeyFunction
 AnytoneKeySettingsExtension::funcKey3Long() const {
@@ -985,7 +985,7 @@ AnytoneKeySettingsExtension::setFuncKey3Long(KeyFunction func) {
   if (_funcKey3Long == func)
     return;
   _funcKey3Long = func;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneKeySettingsExtension::KeyFunction
@@ -997,7 +997,7 @@ AnytoneKeySettingsExtension::setFuncKey4Short(KeyFunction func) {
   if (_funcKey4Short == func)
     return;
   _funcKey4Short = func;
-  emit modified(this);
+  emitModified();
 }
 AnytoneKeySettingsExtension::KeyFunction
 AnytoneKeySettingsExtension::funcKey4Long() const {
@@ -1008,7 +1008,7 @@ AnytoneKeySettingsExtension::setFuncKey4Long(KeyFunction func) {
   if (_funcKey4Long == func)
     return;
   _funcKey4Long = func;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneKeySettingsExtension::KeyFunction
@@ -1020,7 +1020,7 @@ AnytoneKeySettingsExtension::setFuncKey5Short(KeyFunction func) {
   if (_funcKey5Short == func)
     return;
   _funcKey5Short = func;
-  emit modified(this);
+  emitModified();
 }
 AnytoneKeySettingsExtension::KeyFunction
 AnytoneKeySettingsExtension::funcKey5Long() const {
@@ -1031,7 +1031,7 @@ AnytoneKeySettingsExtension::setFuncKey5Long(KeyFunction func) {
   if (_funcKey5Long == func)
     return;
   _funcKey5Long = func;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneKeySettingsExtension::KeyFunction
@@ -1043,7 +1043,7 @@ AnytoneKeySettingsExtension::setFuncKey6Short(KeyFunction func) {
   if (_funcKey6Short == func)
     return;
   _funcKey6Short = func;
-  emit modified(this);
+  emitModified();
 }
 AnytoneKeySettingsExtension::KeyFunction
 AnytoneKeySettingsExtension::funcKey6Long() const {
@@ -1054,7 +1054,7 @@ AnytoneKeySettingsExtension::setFuncKey6Long(KeyFunction func) {
   if (_funcKey6Long == func)
     return;
   _funcKey6Long = func;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneKeySettingsExtension::KeyFunction
@@ -1066,7 +1066,7 @@ AnytoneKeySettingsExtension::setFuncKeyAShort(KeyFunction func) {
   if (_funcKeyAShort == func)
     return;
   _funcKeyAShort = func;
-  emit modified(this);
+  emitModified();
 }
 AnytoneKeySettingsExtension::KeyFunction
 AnytoneKeySettingsExtension::funcKeyALong() const {
@@ -1077,7 +1077,7 @@ AnytoneKeySettingsExtension::setFuncKeyALong(KeyFunction func) {
   if (_funcKeyALong == func)
     return;
   _funcKeyALong = func;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -1091,7 +1091,7 @@ AnytoneKeySettingsExtension::setFuncKeyAVeryLong(KeyFunction func) {
   if (_funcKeyAVeryLong == func)
     return;
   _funcKeyAVeryLong = func;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -1104,7 +1104,7 @@ AnytoneKeySettingsExtension::setFuncKeyBShort(KeyFunction func) {
   if (_funcKeyBShort == func)
     return;
   _funcKeyBShort = func;
-  emit modified(this);
+  emitModified();
 }
 AnytoneKeySettingsExtension::KeyFunction
 AnytoneKeySettingsExtension::funcKeyBLong() const {
@@ -1115,7 +1115,7 @@ AnytoneKeySettingsExtension::setFuncKeyBLong(KeyFunction func) {
   if (_funcKeyBLong == func)
     return;
   _funcKeyBLong = func;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneKeySettingsExtension::KeyFunction
@@ -1128,7 +1128,7 @@ AnytoneKeySettingsExtension::setFuncKeyBVeryLong(KeyFunction func) {
   if (_funcKeyBVeryLong == func)
     return;
   _funcKeyBVeryLong = func;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -1141,7 +1141,7 @@ AnytoneKeySettingsExtension::setFuncKeyCShort(KeyFunction func) {
   if (_funcKeyCShort == func)
     return;
   _funcKeyCShort = func;
-  emit modified(this);
+  emitModified();
 }
 AnytoneKeySettingsExtension::KeyFunction
 AnytoneKeySettingsExtension::funcKeyCLong() const {
@@ -1152,7 +1152,7 @@ AnytoneKeySettingsExtension::setFuncKeyCLong(KeyFunction func) {
   if (_funcKeyCLong == func)
     return;
   _funcKeyCLong = func;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneKeySettingsExtension::KeyFunction
@@ -1164,7 +1164,7 @@ AnytoneKeySettingsExtension::setFuncKeyDShort(KeyFunction func) {
   if (_funcKeyDShort == func)
     return;
   _funcKeyDShort = func;
-  emit modified(this);
+  emitModified();
 }
 AnytoneKeySettingsExtension::KeyFunction
 AnytoneKeySettingsExtension::funcKeyDLong() const {
@@ -1175,7 +1175,7 @@ AnytoneKeySettingsExtension::setFuncKeyDLong(KeyFunction func) {
   if (_funcKeyDLong == func)
     return;
   _funcKeyDLong = func;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -1189,7 +1189,7 @@ AnytoneKeySettingsExtension::setFuncKnobShort(KeyFunction func) {
   if (_funcKnobShort == func)
     return;
   _funcKnobShort = func;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneKeySettingsExtension::KeyFunction
@@ -1202,7 +1202,7 @@ AnytoneKeySettingsExtension::setFuncKnobLong(KeyFunction func) {
   if (_funcKnobLong == func)
     return;
   _funcKnobLong = func;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -1215,7 +1215,7 @@ AnytoneKeySettingsExtension::setLongPressDuration(Interval ms) {
   if (_longPressDuration == ms)
     return;
   _longPressDuration = ms;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -1229,7 +1229,7 @@ AnytoneKeySettingsExtension::setUpDownKeyFunction(UpDownKeyFunction func) {
   if (_upDownFunction == func)
     return;
   _upDownFunction = func;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -1242,7 +1242,7 @@ AnytoneKeySettingsExtension::enableAutoKeyLock(bool enabled) {
   if (_autoKeyLock==enabled)
     return;
   _autoKeyLock = enabled;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -1254,7 +1254,7 @@ AnytoneKeySettingsExtension::enableKnobLock(bool enable) {
   if (_knobLock == enable)
     return;
   _knobLock = enable;
-  emit modified(this);
+  emitModified();
 }
 bool
 AnytoneKeySettingsExtension::keypadLockEnabled() const {
@@ -1265,7 +1265,7 @@ AnytoneKeySettingsExtension::enableKeypadLock(bool enable) {
   if (_keypadLock == enable)
     return;
   _keypadLock = enable;
-  emit modified(this);
+  emitModified();
 }
 bool
 AnytoneKeySettingsExtension::sideKeysLockEnabled() const {
@@ -1276,7 +1276,7 @@ AnytoneKeySettingsExtension::enableSideKeysLock(bool enable) {
   if (_sideKeysLock == enable)
     return;
   _sideKeysLock = enable;
-  emit modified(this);
+  emitModified();
 }
 bool
 AnytoneKeySettingsExtension::forcedKeyLockEnabled() const {
@@ -1287,7 +1287,7 @@ AnytoneKeySettingsExtension::enableForcedKeyLock(bool enable) {
   if (_forcedKeyLock == enable)
     return;
   _forcedKeyLock = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -1321,7 +1321,7 @@ AnytoneToneSettingsExtension::enableTOTNotification(bool enable) {
   if (enable == _totNotification)
     return;
   _totNotification = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -1334,7 +1334,7 @@ AnytoneToneSettingsExtension::enableWXAlarm(bool enable) {
   if (enable == _wxAlarm)
     return;
   _wxAlarm = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -1377,7 +1377,7 @@ AnytoneDisplaySettingsExtension::setBrightness(unsigned int level) {
   if (_brightness == level)
     return;
   _brightness = level;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -1389,7 +1389,7 @@ AnytoneDisplaySettingsExtension::enableDisplayFrequency(bool enable) {
   if (_displayFrequency == enable)
     return;
   _displayFrequency = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -1401,7 +1401,7 @@ AnytoneDisplaySettingsExtension::enableVolumeChangePrompt(bool enable) {
   if (_volumeChangePrompt == enable)
     return;
   _volumeChangePrompt = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -1413,7 +1413,7 @@ AnytoneDisplaySettingsExtension::enableCallEndPrompt(bool enable) {
   if (_callEndPrompt == enable)
     return;
   _callEndPrompt = enable;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneDisplaySettingsExtension::LastCallerDisplayMode
@@ -1425,7 +1425,7 @@ AnytoneDisplaySettingsExtension::setLastCallerDisplay(LastCallerDisplayMode mode
   if (_lastCallerDisplay == mode)
     return;
   _lastCallerDisplay = mode;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -1437,7 +1437,7 @@ AnytoneDisplaySettingsExtension::enableShowClock(bool enable) {
   if (_showClock == enable)
     return;
   _showClock = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -1449,7 +1449,7 @@ AnytoneDisplaySettingsExtension::enableShowCall(bool enable) {
   if (_showCall == enable)
     return;
   _showCall = enable;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneDisplaySettingsExtension::Color
@@ -1461,7 +1461,7 @@ AnytoneDisplaySettingsExtension::setCallColor(Color color) {
   if (_callColor == color)
     return;
   _callColor = color;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneDisplaySettingsExtension::Language
@@ -1473,7 +1473,7 @@ AnytoneDisplaySettingsExtension::setLanguage(Language lang) {
   if (_language == lang)
     return;
   _language = lang;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneDisplaySettingsExtension::DateFormat
@@ -1485,7 +1485,7 @@ AnytoneDisplaySettingsExtension::setDateFormat(DateFormat format) {
   if (format == _dateFormat)
     return;
   _dateFormat = format;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -1497,7 +1497,7 @@ AnytoneDisplaySettingsExtension::enableShowChannelNumber(bool enable) {
   if (_showChannelNumber == enable)
     return;
   _showChannelNumber = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -1509,7 +1509,7 @@ AnytoneDisplaySettingsExtension::enableShowGlobalChannelNumber(bool enable) {
   if (_showGlobalChannelNumber == enable)
     return;
   _showGlobalChannelNumber = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -1521,7 +1521,7 @@ AnytoneDisplaySettingsExtension::enableShowColorCode(bool enable) {
   if (_showColorCode == enable)
     return;
   _showColorCode = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -1533,7 +1533,7 @@ AnytoneDisplaySettingsExtension::enableShowTimeSlot(bool enable) {
   if (_showTimeSlot == enable)
     return;
   _showTimeSlot = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -1545,7 +1545,7 @@ AnytoneDisplaySettingsExtension::enableShowChannelType(bool enable) {
   if (_showChannelType == enable)
     return;
   _showChannelType = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -1557,7 +1557,7 @@ AnytoneDisplaySettingsExtension::enableShowContact(bool enable) {
   if (_showContact == enable)
     return;
   _showContact = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -1569,7 +1569,7 @@ AnytoneDisplaySettingsExtension::enableShowLastHeard(bool enable) {
   if (_showLastHeard == enable)
     return;
   _showLastHeard = enable;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneDisplaySettingsExtension::Color
@@ -1581,7 +1581,7 @@ AnytoneDisplaySettingsExtension::setStandbyTextColor(Color color) {
   if (_standbyTextColor == color)
     return;
   _standbyTextColor = color;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneDisplaySettingsExtension::Color
@@ -1593,7 +1593,7 @@ AnytoneDisplaySettingsExtension::setStandbyBackgroundColor(Color color) {
   if (_standbyBackgroundColor == color)
     return;
   _standbyBackgroundColor = color;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -1607,7 +1607,7 @@ AnytoneDisplaySettingsExtension::setBacklightDuration(Interval sec) {
   if (_backlightDuration == sec)
     return;
   _backlightDuration = sec;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -1621,7 +1621,7 @@ AnytoneDisplaySettingsExtension::setBacklightDurationTX(Interval sec) {
   if (_backlightDurationTX == sec)
     return;
   _backlightDurationTX = sec;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -1634,7 +1634,7 @@ AnytoneDisplaySettingsExtension::setChannelNameColor(Color color) {
   if (_channelNameColor == color)
     return;
   _channelNameColor = color;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneDisplaySettingsExtension::Color
@@ -1646,7 +1646,7 @@ AnytoneDisplaySettingsExtension::setChannelBNameColor(Color color) {
   if (_channelBNameColor == color)
     return;
   _channelBNameColor = color;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneDisplaySettingsExtension::Color
@@ -1658,7 +1658,7 @@ AnytoneDisplaySettingsExtension::setZoneNameColor(Color color) {
   if (_zoneNameColor == color)
     return;
   _zoneNameColor = color;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneDisplaySettingsExtension::Color
@@ -1670,7 +1670,7 @@ AnytoneDisplaySettingsExtension::setZoneBNameColor(Color color) {
   if (_zoneBNameColor == color)
     return;
   _zoneBNameColor = color;
-  emit modified(this);
+  emitModified();
 }
 
 Interval
@@ -1682,7 +1682,7 @@ AnytoneDisplaySettingsExtension::setBacklightDurationRX(Interval sec) {
   if (_backlightDurationRX == sec)
     return;
   _backlightDurationRX = sec;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -1694,7 +1694,7 @@ AnytoneDisplaySettingsExtension::enableCustomChannelBackground(bool enable) {
   if (enable == _customChannelBackground)
     return;
   _customChannelBackground = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -1730,7 +1730,7 @@ AnytoneAudioSettingsExtension::enableRecording(bool enable) {
   if (_recording == enable)
     return;
   _recording = enable;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneAudioSettingsExtension::VoxSource
@@ -1742,7 +1742,7 @@ AnytoneAudioSettingsExtension::setVOXSource(VoxSource source) {
   if (_voxSource == source)
     return;
   _voxSource = source;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -1754,7 +1754,7 @@ AnytoneAudioSettingsExtension::enableEnhanceAudio(bool enable) {
   if (_enhanceAudio == enable)
     return;
   _enhanceAudio = enable;
-  emit modified(this);
+  emitModified();
 }
 
 Interval
@@ -1766,7 +1766,7 @@ AnytoneAudioSettingsExtension::setMuteDelay(Interval intv) {
   if (_muteDelay == intv)
     return;
   _muteDelay = intv;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -1780,7 +1780,7 @@ AnytoneAudioSettingsExtension::setSpeaker(Speaker speaker) {
   if (_speaker == speaker)
     return;
   _speaker = speaker;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -1794,7 +1794,7 @@ AnytoneAudioSettingsExtension::setHandsetSpeaker(HandsetSpeakerSource src) {
   if (_handsetSpeaker == src)
     return;
   _handsetSpeaker = src;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -1808,7 +1808,7 @@ AnytoneAudioSettingsExtension::setHandsetType(HandsetType type) {
   if (_handsetType == type)
     return;
   _handsetType = type;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -1841,7 +1841,7 @@ AnytoneMenuSettingsExtension::setDuration(Interval sec) {
   if (_menuDuration == sec)
     return;
   _menuDuration = sec;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -1853,7 +1853,7 @@ AnytoneMenuSettingsExtension::enableSeparator(bool enable) {
   if (_showSeparator == enable)
     return;
   _showSeparator = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -1894,7 +1894,7 @@ AnytoneAutoRepeaterSettingsExtension::setDirectionA(Direction dir) {
   if (_directionA == dir)
     return;
   _directionA = dir;
-  emit modified(this);
+  emitModified();
 }
 AnytoneAutoRepeaterSettingsExtension::Direction
 AnytoneAutoRepeaterSettingsExtension::directionB() const {
@@ -1905,7 +1905,7 @@ AnytoneAutoRepeaterSettingsExtension::setDirectionB(Direction dir) {
   if (_directionB == dir)
     return;
   _directionB = dir;
-  emit modified(this);
+  emitModified();
 }
 
 Frequency
@@ -1917,7 +1917,7 @@ AnytoneAutoRepeaterSettingsExtension::setVHFMin(Frequency Hz) {
   if (_minVHF == Hz)
     return;
   _minVHF = Hz;
-  emit modified(this);
+  emitModified();
 }
 Frequency
 AnytoneAutoRepeaterSettingsExtension::vhfMax() const {
@@ -1928,7 +1928,7 @@ AnytoneAutoRepeaterSettingsExtension::setVHFMax(Frequency Hz) {
   if (_maxVHF == Hz)
     return;
   _maxVHF = Hz;
-  emit modified(this);
+  emitModified();
 }
 Frequency
 AnytoneAutoRepeaterSettingsExtension::uhfMin() const {
@@ -1939,7 +1939,7 @@ AnytoneAutoRepeaterSettingsExtension::setUHFMin(Frequency Hz) {
   if (_minUHF == Hz)
     return;
   _minUHF = Hz;
-  emit modified(this);
+  emitModified();
 }
 Frequency
 AnytoneAutoRepeaterSettingsExtension::uhfMax() const {
@@ -1950,7 +1950,7 @@ AnytoneAutoRepeaterSettingsExtension::setUHFMax(Frequency Hz) {
   if (_maxUHF == Hz)
     return;
   _maxUHF = Hz;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneAutoRepeaterOffsetRef *
@@ -1972,7 +1972,7 @@ AnytoneAutoRepeaterSettingsExtension::setVHF2Min(Frequency Hz) {
   if (_minVHF2 == Hz)
     return;
   _minVHF2 = Hz;
-  emit modified(this);
+  emitModified();
 }
 Frequency
 AnytoneAutoRepeaterSettingsExtension::vhf2Max() const {
@@ -1983,7 +1983,7 @@ AnytoneAutoRepeaterSettingsExtension::setVHF2Max(Frequency Hz) {
   if (_maxVHF2 == Hz)
     return;
   _maxVHF2 = Hz;
-  emit modified(this);
+  emitModified();
 }
 Frequency
 AnytoneAutoRepeaterSettingsExtension::uhf2Min() const {
@@ -1994,7 +1994,7 @@ AnytoneAutoRepeaterSettingsExtension::setUHF2Min(Frequency Hz) {
   if (_minUHF2 == Hz)
     return;
   _minUHF2 = Hz;
-  emit modified(this);
+  emitModified();
 }
 Frequency
 AnytoneAutoRepeaterSettingsExtension::uhf2Max() const {
@@ -2005,7 +2005,7 @@ AnytoneAutoRepeaterSettingsExtension::setUHF2Max(Frequency Hz) {
   if (_maxUHF2 == Hz)
     return;
   _maxUHF2 = Hz;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneAutoRepeaterOffsetRef *
@@ -2052,7 +2052,7 @@ AnytoneAutoRepeaterOffset::setOffset(Frequency offset) {
   if (_offset == offset)
     return;
   _offset = offset;
-  emit modified(this);
+  emitModified();
 }
 
 ConfigItem *
@@ -2123,7 +2123,7 @@ AnytoneBluetoothHandsetSettingsExtension::enableShutdown(bool enable) {
   if (_shutdown == enable)
     return;
   _shutdown = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -2138,7 +2138,7 @@ AnytoneBluetoothHandsetSettingsExtension::setVolumeLevelA(unsigned int level) {
   if (_volumeLevelA == level)
     return;
   _volumeLevelA = level;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -2153,7 +2153,7 @@ AnytoneBluetoothHandsetSettingsExtension::setVolumeLevelB(unsigned int level) {
   if (_volumeLevelB == level)
     return;
   _volumeLevelB = level;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -2168,7 +2168,7 @@ AnytoneBluetoothHandsetSettingsExtension::setMicGain(unsigned int gain) {
   if (_micGain == gain)
     return;
   _micGain = gain;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -2183,7 +2183,7 @@ AnytoneBluetoothHandsetSettingsExtension::setSquelch(unsigned int level) {
   if (_squelch == level)
     return;
   _squelch = level;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -2198,7 +2198,7 @@ AnytoneBluetoothHandsetSettingsExtension::setTxNoiseReduction(unsigned int level
   if (_txNoiseReduction == level)
     return;
   _txNoiseReduction = level;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -2213,7 +2213,7 @@ AnytoneBluetoothHandsetSettingsExtension::setVoxLevel(unsigned int level) {
   if (_voxLevel == level)
     return;
   _voxLevel = level;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -2227,7 +2227,7 @@ AnytoneBluetoothHandsetSettingsExtension::setVoxDelay(Interval delay) {
   if (_voxDelay == delay)
     return;
   _voxDelay = delay;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -2241,7 +2241,7 @@ AnytoneBluetoothHandsetSettingsExtension::setFuncKeyAShort(AnytoneKeySettingsExt
   if (_funcKeyAShort == func)
     return;
   _funcKeyAShort = func;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneKeySettingsExtension::KeyFunction
@@ -2254,7 +2254,7 @@ AnytoneBluetoothHandsetSettingsExtension::setFuncKeyBShort(AnytoneKeySettingsExt
   if (_funcKeyBShort == func)
     return;
   _funcKeyBShort = func;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneKeySettingsExtension::KeyFunction
@@ -2267,7 +2267,7 @@ AnytoneBluetoothHandsetSettingsExtension::setFuncKeyCShort(AnytoneKeySettingsExt
   if (_funcKeyCShort == func)
     return;
   _funcKeyCShort = func;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneKeySettingsExtension::KeyFunction
@@ -2280,7 +2280,7 @@ AnytoneBluetoothHandsetSettingsExtension::setFuncKeyALong(AnytoneKeySettingsExte
   if (_funcKeyALong == func)
     return;
   _funcKeyALong = func;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneKeySettingsExtension::KeyFunction
@@ -2293,7 +2293,7 @@ AnytoneBluetoothHandsetSettingsExtension::setFuncKeyBLong(AnytoneKeySettingsExte
   if (_funcKeyBLong == func)
     return;
   _funcKeyBLong = func;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneKeySettingsExtension::KeyFunction
@@ -2306,7 +2306,7 @@ AnytoneBluetoothHandsetSettingsExtension::setFuncKeyCLong(AnytoneKeySettingsExte
   if (_funcKeyCLong == func)
     return;
   _funcKeyCLong = func;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneKeySettingsExtension::KeyFunction
@@ -2319,7 +2319,7 @@ AnytoneBluetoothHandsetSettingsExtension::setFuncKeyAVeryLong(AnytoneKeySettings
   if (_funcKeyAVeryLong == func)
     return;
   _funcKeyAVeryLong = func;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneKeySettingsExtension::KeyFunction
@@ -2332,7 +2332,7 @@ AnytoneBluetoothHandsetSettingsExtension::setFuncKeyBVeryLong(AnytoneKeySettings
   if (_funcKeyBVeryLong == func)
     return;
   _funcKeyBVeryLong = func;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneKeySettingsExtension::KeyFunction
@@ -2345,7 +2345,7 @@ AnytoneBluetoothHandsetSettingsExtension::setFuncKeyCVeryLong(AnytoneKeySettings
   if (_funcKeyCVeryLong == func)
     return;
   _funcKeyCVeryLong = func;
-  emit modified(this);
+  emitModified();
 }
 
 Interval
@@ -2358,7 +2358,7 @@ AnytoneBluetoothHandsetSettingsExtension::setBacklight(Interval dur) {
   if (_backlight == dur)
     return;
   _backlight = dur;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -2396,7 +2396,7 @@ AnytoneBluetoothSettingsExtension::enablePTTLatch(bool enable) {
   if (enable == _pttLatch)
     return;
   _pttLatch = enable;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneBluetoothHandsetSettingsExtension *
@@ -2414,7 +2414,7 @@ AnytoneBluetoothSettingsExtension::enableBluetooth(bool enable) {
   if (enable == _bluetoothEnabled)
     return;
   _bluetoothEnabled = enable;
-  emit modified(this);
+  emitModified();
 }
 
 Interval
@@ -2426,7 +2426,7 @@ AnytoneBluetoothSettingsExtension::setPTTSleepTimer(Interval intv) {
   if (intv == _pttSleep)
     return;
   _pttSleep = intv;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -2439,7 +2439,7 @@ AnytoneBluetoothSettingsExtension::enableInternalMic(bool enable) {
   if (enable == _internalMic)
     return;
   _internalMic = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -2452,7 +2452,7 @@ AnytoneBluetoothSettingsExtension::enableInternalSpeaker(bool enable) {
   if (enable == _internalSpeaker)
     return;
   _internalSpeaker = enable;
-  emit modified(this);
+  emitModified();
 }
 
 unsigned int
@@ -2465,7 +2465,7 @@ AnytoneBluetoothSettingsExtension::setMicGain(unsigned int gain) {
   if (_micGain == gain)
     return;
   _micGain = gain;
-  emit modified(this);
+  emitModified();
 }
 
 unsigned int
@@ -2478,7 +2478,7 @@ AnytoneBluetoothSettingsExtension::setSpeakerGain(unsigned int gain) {
   if (_speakerGain == gain)
     return;
   _speakerGain = gain;
-  emit modified(this);
+  emitModified();
 }
 
 const Interval &
@@ -2491,7 +2491,7 @@ AnytoneBluetoothSettingsExtension::setHoldDuration(const Interval &dur) {
   if (dur == _holdDuration)
     return;
   _holdDuration = dur;
-  emit modified(this);
+  emitModified();
 }
 
 const Interval &
@@ -2504,7 +2504,7 @@ AnytoneBluetoothSettingsExtension::setHoldDelay(const Interval &dur) {
   if (dur == _holdDelay)
     return;
   _holdDelay = dur;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -2537,7 +2537,7 @@ AnytoneRepeaterSettingsExtension::enable(bool enable) {
   if (_enabled == enable)
     return;
   _enabled = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -2549,7 +2549,7 @@ AnytoneRepeaterSettingsExtension::enableMonitor(bool enable) {
   if (_monitor == enable)
     return;
   _monitor = enable;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneRepeaterSettingsExtension::TimeSlot
@@ -2561,7 +2561,7 @@ AnytoneRepeaterSettingsExtension::setTimeSlot(TimeSlot ts) {
   if (_timeSlot == ts)
     return;
   _timeSlot = ts;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -2574,7 +2574,7 @@ AnytoneRepeaterSettingsExtension::setSecTimeSlot(TimeSlot ts) {
   if (_secTimeSlot == ts)
     return;
   _secTimeSlot = ts;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -2588,7 +2588,7 @@ AnytoneRepeaterSettingsExtension::setColorCode(ColorCode code) {
   if (_colorCode == code)
     return;
   _colorCode = code;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -2623,7 +2623,7 @@ AnytoneSatelliteSettingsExtension::setPower(Channel::Power power) {
   if (_power == power)
     return;
   _power = power;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -2637,6 +2637,6 @@ AnytoneSatelliteSettingsExtension::setSquelch(unsigned int squelch) {
   if (_squelch == squelch)
     return;
   _squelch = squelch;
-  emit modified(this);
+  emitModified();
 }
 
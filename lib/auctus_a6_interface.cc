@@ -2,6 +2,7 @@
 #include <QMetaEnum>
 #include <QtEndian>
 #include <QThread>
+#include <QElapsedTimer>
 #include "logger.hh"
 
 #define TIMEOUT 5000
@@ -34,6 +35,7 @@ AuctusA6Interface::send_receive(uint16_t command,
                                 const uint8_t *params, uint8_t plen,
                                 uint8_t *response, uint8_t &rlen, const ErrorStack &err)
 {
+  QElapsedTimer timer; timer.start();
   if (! send(command, params, plen, err)) {
     errMsg(err) << "Cannot send command.";
     return false;
@@ -42,8 +44,10 @@ AuctusA6Interface::send_receive(uint16_t command,
   uint16_t rcommand=0;
   if (! receive(rcommand, response, rlen, err)) {
     errMsg(err) << "Cannot receive response.";
+    resetRoundTripTime();
     return false;
   }
+  addRoundTripSample(timer.nsecsElapsed()/1000);
 
   if ((rcommand&0x7fff) != command) {
     errMsg(err) << "Request and response commands mismatch. Expected "
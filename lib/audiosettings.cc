@@ -33,7 +33,7 @@ AudioSettings::setSquelch(Level squelch) {
   if (_squelch == squelch)
     return;
   _squelch = squelch;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -52,7 +52,7 @@ AudioSettings::setDMRSquelch(Level dmrSquelch) {
   if (_dmrSquelch == dmrSquelch)
     return;
   _dmrSquelch = dmrSquelch;
-  emit modified(this);
+  emitModified();
 }
 
 void
@@ -73,7 +73,7 @@ AudioSettings::setMicGain(Level micGain) {
   if (_micGain == micGain)
     return;
   _micGain = micGain;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -92,7 +92,7 @@ AudioSettings::setFMMicGain(Level fmMicGain) {
   if (_fmMicGain == fmMicGain)
     return;
   _fmMicGain = fmMicGain;
-  emit modified(this);
+  emitModified();
 }
 
 void
@@ -115,7 +115,7 @@ AudioSettings::setM17MicGain(Level m17MicGain) {
   if (_m17MicGain == m17MicGain)
     return;
   _m17MicGain = m17MicGain;
-  emit modified(this);
+  emitModified();
 }
 
 void
@@ -141,7 +141,7 @@ AudioSettings::setVox(Level vox) {
   if (_vox == vox)
     return;
   _vox = vox;
-  emit modified(this);
+  emitModified();
 }
 
 void
@@ -160,7 +160,7 @@ AudioSettings::setMaxSpeakerVolume(Level maxSpeakerVolume) {
   if (_maxSpeakerVolume == maxSpeakerVolume)
     return;
   _maxSpeakerVolume = maxSpeakerVolume;
-  emit modified(this);
+  emitModified();
 }
 
 Level
@@ -173,7 +173,7 @@ AudioSettings::setMaxHeadphoneVolume(Level maxHeadphoneVolume) {
   if (_maxHeadphoneVolume == maxHeadphoneVolume)
     return;
   _maxHeadphoneVolume = maxHeadphoneVolume;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -187,7 +187,7 @@ AudioSettings::setVOXDelay(Interval voxDelay) {
   if (_voxDelay == voxDelay)
     return;
   _voxDelay = voxDelay;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -200,5 +200,5 @@ AudioSettings::enableSpeechSynthesis(bool speechSynthesis) {
   if (_speech == speechSynthesis)
     return;
   _speech = speechSynthesis;
-  emit modified(this);
+  emitModified();
 }
\ No newline at end of file
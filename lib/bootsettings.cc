@@ -34,7 +34,7 @@ BootSettings::setBootDisplay(BootDisplay mode) {
   if (_bootDisplay == mode)
     return;
   _bootDisplay = mode;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -48,7 +48,7 @@ BootSettings::setMessage1(const QString &message1) {
   if (_message1 == message1)
     return;
   _message1 = message1;
-  emit modified(this);
+  emitModified();
 }
 
 const QString &
@@ -61,7 +61,7 @@ BootSettings::setMessage2(const QString &message2) {
   if (_message2 == message2)
     return;
   _message2 = message2;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -75,7 +75,7 @@ BootSettings::enableBootPassword(bool enable) {
   if (_bootPasswordEnabled == enable)
     return;
   _bootPasswordEnabled = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -89,7 +89,7 @@ BootSettings::setBootPassword(const QString &pass) {
   if (_bootPassword == pass)
     return;
   _bootPassword = pass;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -103,7 +103,7 @@ BootSettings::enableDefaultChannel(bool enable) {
   if (_defaultChannel == enable)
     return;
   _defaultChannel = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -139,6 +139,6 @@ BootSettings::enableReset(bool enable) {
   if (_reset == enable)
     return;
   _reset = enable;
-  emit modified(this);
+  emitModified();
 }
 
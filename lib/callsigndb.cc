@@ -1,4 +1,6 @@
 #include "callsigndb.hh"
+#include <algorithm>
+#include <limits>
 
 
 /* ********************************************************************************************* *
@@ -39,6 +41,109 @@ CallsignDB::Flags::clearCountLimit() {
 }
 
 
+/* ********************************************************************************************* *
+ * Implementation of CallsignDB::UserIterator
+ * ********************************************************************************************* */
+CallsignDB::UserIterator::UserIterator()
+{
+  // pass...
+}
+
+CallsignDB::UserIterator::~UserIterator() {
+  // pass...
+}
+
+
+/* ********************************************************************************************* *
+ * Implementation of CallsignDB::SortedUserIterator
+ * ********************************************************************************************* */
+CallsignDB::SortedUserIterator::SortedUserIterator(const UserDatabase *db, qint64 n)
+  : UserIterator(), _db(db), _order(), _pos(0), _current()
+{
+  if ((0 > n) || (n > _db->count()))
+    n = _db->count();
+  _order.reserve(n);
+  for (int i=0; i<n; i++)
+    _order.append(i);
+  std::sort(_order.begin(), _order.end(), [this](int a, int b) {
+    return _db->user(a).id() < _db->user(b).id();
+  });
+}
+
+qint64
+CallsignDB::SortedUserIterator::count() const {
+  return _order.size();
+}
+
+qint64
+CallsignDB::SortedUserIterator::position() const {
+  return _pos;
+}
+
+const UserDatabase::User *
+CallsignDB::SortedUserIterator::next() {
+  if (_pos >= _order.size())
+    return nullptr;
+  _current = _db->user(_order[_pos++]);
+  return &_current;
+}
+
+
+/* ********************************************************************************************* *
+ * Implementation of CallsignDB::Sink
+ * ********************************************************************************************* */
+CallsignDB::Sink::Sink()
+{
+  // pass...
+}
+
+CallsignDB::Sink::~Sink() {
+  // pass...
+}
+
+
+/* ********************************************************************************************* *
+ * Implementation of CallsignDB::ImageSink
+ * ********************************************************************************************* */
+CallsignDB::ImageSink::ImageSink(DFUFile::Image &image)
+  : Sink(), _image(image)
+{
+  // pass...
+}
+
+bool
+CallsignDB::ImageSink::write(uint32_t address, const QByteArray &data, const ErrorStack &err) {
+  Q_UNUSED(err)
+  _image.addElement(address, data.size());
+  memcpy(_image.data(address), data.constData(), data.size());
+  return true;
+}
+
+
+/* ********************************************************************************************* *
+ * Implementation of CallsignDB::FileSink
+ * ********************************************************************************************* */
+CallsignDB::FileSink::FileSink(const QString &filename, const QString &imageName)
+  : Sink(), _writer(filename, imageName)
+{
+  // pass...
+}
+
+bool
+CallsignDB::FileSink::write(uint32_t address, const QByteArray &data, const ErrorStack &err) {
+  if ((! _writer.isOpen()) && (! _writer.open(err)))
+    return false;
+  return _writer.write(address, data, err);
+}
+
+bool
+CallsignDB::FileSink::close(const ErrorStack &err) {
+  if ((! _writer.isOpen()) && (! _writer.open(err)))
+    return false;
+  return _writer.close(err);
+}
+
+
 /* ********************************************************************************************* *
  * Implementation of CallsignDB
  * ********************************************************************************************* */
@@ -51,3 +156,20 @@ CallsignDB::CallsignDB(QObject *parent)
 CallsignDB::~CallsignDB() {
   // pass...
 }
+
+unsigned int
+CallsignDB::maxEntries() const {
+  return std::numeric_limits<unsigned int>::max();
+}
+
+bool
+CallsignDB::hasStreamingEncoder() const {
+  return false;
+}
+
+bool
+CallsignDB::encode(UserIterator &users, Sink &sink, const ErrorStack &err) {
+  Q_UNUSED(users); Q_UNUSED(sink);
+  errMsg(err) << "Streaming encoding is not implemented for this call-sign DB.";
+  return false;
+}
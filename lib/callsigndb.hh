@@ -3,14 +3,17 @@
 
 #include "dfufile.hh"
 #include "transferflags.hh"
+#include "userdatabase.hh"
 
 
-// Forward decl.
-class UserDatabase;
-
 /** Abstract base class of all callsign database implementations.
  * This class defines the interface for all device-specific binary encodings of call sign
  * databases. The interface is particularly simple: reimplement the @c encode method.
+ *
+ * Some implementations also provide a streaming encoder, see
+ * @c encode(UserIterator&, Sink&, const ErrorStack&). It consumes the users one-by-one and passes
+ * the encoded memory bank-by-bank to a @c Sink. Hence, the memory usage is proportional to a
+ * single bank instead of the complete database.
  * @ingroup conf */
 class CallsignDB : public DFUFile
 {
@@ -41,6 +44,95 @@ public:
     int64_t _count;
   };
 
+  /** Abstract iterator over users, used by the streaming encoder. The users must be provided in
+   * ascending order of their IDs. */
+  class UserIterator
+  {
+  protected:
+    /** Hidden constructor. */
+    UserIterator();
+
+  public:
+    /** Destructor. */
+    virtual ~UserIterator();
+
+    /** Returns the number of users to iterate over. */
+    virtual qint64 count() const = 0;
+    /** Returns the next user or @c nullptr if there are no more users. The returned user is only
+     * valid until the next call. */
+    virtual const UserDatabase::User *next() = 0;
+  };
+
+  /** Iterates over the first @c n users of a @c UserDatabase in ascending order of their IDs.
+   * Only the IDs and indices of the selected users are held in memory. */
+  class SortedUserIterator: public UserIterator
+  {
+  public:
+    /** Selects the first @c n users of the given database. If @c n is negative, all users
+     * are selected. */
+    SortedUserIterator(const UserDatabase *db, qint64 n=-1);
+
+    qint64 count() const;
+    const UserDatabase::User *next();
+    /** Returns the number of users returned so far. */
+    qint64 position() const;
+
+  protected:
+    /** The user database. */
+    const UserDatabase *_db;
+    /** The indices of the selected users, sorted by ID. */
+    QVector<int> _order;
+    /** The current position. */
+    int _pos;
+    /** The current user. */
+    UserDatabase::User _current;
+  };
+
+  /** Abstract receiver of encoded memory regions, used by the streaming encoder. */
+  class Sink
+  {
+  protected:
+    /** Hidden constructor. */
+    Sink();
+
+  public:
+    /** Destructor. */
+    virtual ~Sink();
+
+    /** Receives the given data, to be stored at the specified address. */
+    virtual bool write(uint32_t address, const QByteArray &data, const ErrorStack &err=ErrorStack()) = 0;
+  };
+
+  /** Collects all received memory regions as elements of a @c DFUFile image. */
+  class ImageSink: public Sink
+  {
+  public:
+    /** Constructor. */
+    explicit ImageSink(DFUFile::Image &image);
+
+    bool write(uint32_t address, const QByteArray &data, const ErrorStack &err=ErrorStack());
+
+  protected:
+    /** A weak reference to the image. */
+    DFUFile::Image &_image;
+  };
+
+  /** Writes all received memory regions straight into a DFU file. */
+  class FileSink: public Sink
+  {
+  public:
+    /** Constructor, the file gets created on the first write. */
+    FileSink(const QString &filename, const QString &imageName);
+
+    bool write(uint32_t address, const QByteArray &data, const ErrorStack &err=ErrorStack());
+    /** Finalizes and closes the file. */
+    bool close(const ErrorStack &err=ErrorStack());
+
+  protected:
+    /** The underlying DFU file writer. */
+    DFUFile::StreamWriter _writer;
+  };
+
 protected:
   /** Hidden constructor. */
   explicit CallsignDB(QObject *parent=nullptr);
@@ -52,6 +144,16 @@ public:
   /** Encodes the given user db into the device specific callsign db. */
   virtual bool encode(UserDatabase *db, const Flags &selection=Flags(),
                       const ErrorStack &err=ErrorStack()) = 0;
+
+  /** Returns the maximum number of entries the call-sign DB can hold. */
+  virtual unsigned int maxEntries() const;
+
+  /** Returns @c true if the streaming encoder is implemented. */
+  virtual bool hasStreamingEncoder() const;
+  /** Streams the users provided by the iterator into the given sink. The encoded DB is not
+   * stored within this object. The default implementation fails, as it must be implemented by
+   * the device specific call-sign DB. */
+  virtual bool encode(UserIterator &users, Sink &sink, const ErrorStack &err=ErrorStack());
 };
 
 #endif // CALLSIGNDB_HH
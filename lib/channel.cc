@@ -87,7 +87,7 @@ Channel::setRXFrequency(Frequency freq) {
     return true;
 
   _rxFreq = freq;
-  emit modified(this);
+  emitModified();
 
   return true;
 }
@@ -103,7 +103,7 @@ Channel::setTXFrequency(Frequency freq) {
     return true;
 
   _txFreq = freq;
-  emit modified(this);
+  emitModified();
 
   return true;
 }
@@ -141,7 +141,7 @@ Channel::setPower(Power power) {
     return;
   _power = power;
   _defaultPower = false;
-  emit modified(this);
+  emitModified();
 }
 
 void
@@ -150,7 +150,7 @@ Channel::setDefaultPower() {
     return;
 
   _defaultPower = true;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -175,7 +175,7 @@ Channel::setTimeout(const Interval& dur) {
     return true;
 
   _txTimeOut = dur;
-  emit modified(this);
+  emitModified();
 
   return true;
 }
@@ -186,7 +186,7 @@ Channel::setDefaultTimeout() {
     return;
 
   setTimeout(Interval::null());
-  emit modified(this);
+  emitModified();
 }
 
 void
@@ -202,7 +202,7 @@ Channel::rxOnly() const {
 bool
 Channel::setRXOnly(bool enable) {
   _rxOnly = enable;
-  emit modified(this);
+  emitModified();
   return true;
 }
 
@@ -223,7 +223,7 @@ Channel::setVOX(Level level) {
   if (_vox == level)
     return;
   _vox = level;
-  emit modified(this);
+  emitModified();
 }
 void
 Channel::setVOXDefault() {
@@ -255,7 +255,7 @@ Channel::setScanList(ScanList *list) {
 
 void
 Channel::onReferenceModified() {
-  emit modified(this);
+  emitModified();
 }
 
 OpenGD77ChannelExtension *
@@ -381,7 +381,7 @@ AnalogChannel::setSquelch(Level level) {
   if (_squelch == level)
     return true;
   _squelch = level;
-  emit modified(this);
+  emitModified();
   return true;
 }
 void
@@ -451,7 +451,7 @@ FMChannel::admit() const {
 void
 FMChannel::setAdmit(Admit admit) {
   _admit = admit;
-  emit modified(this);
+  emitModified();
 }
 
 SelectiveCall
@@ -461,7 +461,7 @@ FMChannel::rxTone() const {
 bool
 FMChannel::setRXTone(SelectiveCall code) {
   _rxTone = code;
-  emit modified(this);
+  emitModified();
   return true;
 }
 
@@ -472,7 +472,7 @@ FMChannel::txTone() const {
 bool
 FMChannel::setTXTone(SelectiveCall code) {
   _txTone = code;
-  emit modified(this);
+  emitModified();
   return true;
 }
 
@@ -483,7 +483,7 @@ FMChannel::bandwidth() const {
 bool
 FMChannel::setBandwidth(Bandwidth bw) {
   _bw = bw;
-  emit modified(this);
+  emitModified();
   return true;
 }
 
@@ -697,7 +697,7 @@ DMRChannel::admit() const {
 void
 DMRChannel::setAdmit(Admit admit) {
   _admit = admit;
-  emit modified(this);
+  emitModified();
 }
 
 unsigned
@@ -711,7 +711,7 @@ DMRChannel::setColorCode(unsigned cc) {
     cc = 15;
   }
   _colorCode = cc;
-  emit modified(this);
+  emitModified();
   return true;
 }
 
@@ -722,7 +722,7 @@ DMRChannel::timeSlot() const {
 bool
 DMRChannel::setTimeSlot(TimeSlot slot) {
   _timeSlot = slot;
-  emit modified(this);
+  emitModified();
   return true;
 }
 
@@ -745,7 +745,7 @@ bool
 DMRChannel::setGroupList(RXGroupList *g) {
   if(! _rxGroup.set(g))
     return false;
-  emit modified(this);
+  emitModified();
   return true;
 }
 
@@ -768,7 +768,7 @@ bool
 DMRChannel::setContact(DMRContact *c) {
   if(! _txContact.set(c))
     return false;
-  emit modified(this);
+  emitModified();
   return true;
 }
 
@@ -791,7 +791,7 @@ bool
 DMRChannel::setAPRS(PositionReportingSystem *sys) {
   if (! _posSystem.set(sys))
     return false;
-  emit modified(this);
+  emitModified();
   return true;
 }
 
@@ -813,7 +813,7 @@ DMRChannel::roaming() const {
 bool
 DMRChannel::setRoaming(RoamingZone *zone) {
   _roaming.set(zone);
-  emit modified(this);
+  emitModified();
   return true;
 }
 
@@ -836,7 +836,7 @@ bool
 DMRChannel::setRadioId(DMRRadioID *id) {
   if (! _radioId.set(id))
     return false;
-  emit modified(this);
+  emitModified();
   return true;
 }
 
@@ -945,7 +945,7 @@ M17Channel::setMode(Mode mode) {
   if (_mode == mode)
     return;
   _mode = mode;
-  emit modified(this);
+  emitModified();
 }
 
 unsigned int
@@ -959,7 +959,7 @@ M17Channel::setAccessNumber(unsigned int can) {
   if (_accessNumber == can)
     return;
   _accessNumber = can;
-  emit modified(this);
+  emitModified();
 }
 
 const M17ContactReference *
@@ -989,7 +989,7 @@ bool
 M17Channel::setContact(M17Contact *c) {
   if(! _txContact.set(c))
     return false;
-  emit modified(this);
+  emitModified();
   return true;
 }
 
@@ -1003,7 +1003,7 @@ M17Channel::enableAPRS(bool enabled) {
   if (_gpsEnabled == enabled)
     return;
   _gpsEnabled = enabled;
-  emit modified(this);
+  emitModified();
 }
 
 M17Channel::EncryptionMode
@@ -1016,7 +1016,7 @@ M17Channel::setEncryptionMode(EncryptionMode mode) {
   if (_encryptionMode == mode)
     return;
   _encryptionMode = mode;
-  emit modified(this);
+  emitModified();
 }
 
 YAML::Node
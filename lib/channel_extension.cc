@@ -21,7 +21,7 @@ ChannelExtension::enableTalkaround(bool enable) {
   if (enable == _talkaround)
     return;
   _talkaround = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -57,7 +57,7 @@ FMChannelExtension::enableReverseBurst(bool enable) {
   if (enable == _reverseBurst)
     return;
   _reverseBurst = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -94,7 +94,7 @@ DMRChannelExtension::enablePrivateCallConfirm(bool enabled) {
   if (enabled == _callConfirm)
     return;
   _callConfirm = enabled;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -108,7 +108,7 @@ DMRChannelExtension::enableSMS(bool enable) {
   if (enable == _sms)
     return;
   _sms = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -122,7 +122,7 @@ DMRChannelExtension::enableSMSConfirm(bool enabled) {
   if (enabled == _smsConfirm)
     return;
   _smsConfirm = enabled;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -136,7 +136,7 @@ DMRChannelExtension::enableDataConfirm(bool enable) {
   if (enable==_dataConfirm)
     return;
   _dataConfirm = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -150,7 +150,7 @@ DMRChannelExtension::enableDCDM(bool enable) {
   if (enable == _dcdm)
     return;
   _dcdm = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -164,7 +164,7 @@ DMRChannelExtension::enableLoneWorker(bool enable) {
   if (enable == _loneWorker)
     return;
   _loneWorker = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
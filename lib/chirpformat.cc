@@ -96,6 +96,7 @@ ChirpReader::read(QTextStream &stream, Config *config, const ErrorStack &err) {
     }
   }
 
+  Config::UpdateGuard update(config);
   int line=2;
   while (! stream.atEnd()) {
     QStringList entry;
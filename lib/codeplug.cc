@@ -10,7 +10,8 @@
  * Implementation of CodePlug::Flags
  * ********************************************************************************************* */
 Codeplug::Flags::Flags()
-  : TransferFlags(), _updateCodeplug(true), _autoEnableGPS(false), _autoEnableRoaming(false)
+  : TransferFlags(), _updateCodeplug(true), _autoEnableGPS(false), _autoEnableRoaming(false),
+    _parallelEncode(false)
 {
   // pass...
 }
@@ -48,6 +49,16 @@ Codeplug::Flags::setAutoEnableRoaming(bool enable) {
   _autoEnableRoaming = enable;
 }
 
+bool
+Codeplug::Flags::parallelEncode() const {
+  return _parallelEncode;
+}
+
+void
+Codeplug::Flags::setParallelEncode(bool enable) {
+  _parallelEncode = enable;
+}
+
 
 
 /* ********************************************************************************************* *
@@ -770,7 +781,7 @@ Codeplug::InvertedBitmapElement::enableFirst(unsigned int n) {
  * Implementation of CodePlug::Context
  * ********************************************************************************************* */
 Codeplug::Context::Context(Config *config)
-  : _config(config), _satellites(nullptr), _tables()
+  : _config(config), _satellites(nullptr), _tables(), _frozen(false)
 {
   // Add tables for common elements
   addTable(&DMRRadioID::staticMetaObject);
@@ -803,65 +814,100 @@ Codeplug::Context::satellites() const {
 
 bool
 Codeplug::Context::hasTable(const QMetaObject *obj, bool exact) const {
-  // Find a matching table
-  if (_tables.contains(obj->className()))
-    return true;
-  if (exact)
-    return false;
-  if (obj->superClass())
-    return hasTable(obj->superClass(), false);
-  return false;
+  return nullptr != findTable(obj, exact);
+}
+
+const Codeplug::Context::Table *
+Codeplug::Context::findTable(const QMetaObject *obj, bool exact) const {
+  // Walk up the class hierarchy until a matching table is found
+  for (; nullptr != obj; obj = obj->superClass()) {
+    auto table = _tables.constFind(obj);
+    if (_tables.constEnd() != table)
+      return &table.value();
+    if (exact)
+      return nullptr;
+  }
+  return nullptr;
 }
 
 Codeplug::Context::Table &
 Codeplug::Context::getTable(const QMetaObject *obj) {
-  if (_tables.contains(obj->className()))
-    return _tables[obj->className()];
-  return getTable(obj->superClass());
+  // Use a const lookup here, the table might be shared between threads.
+  return const_cast<Table &>(*findTable(obj));
 }
 
 bool
 Codeplug::Context::addTable(const QMetaObject *obj) {
-  if (hasTable(obj, true))
+  if (_frozen || hasTable(obj, true))
     return false;
-  _tables.insert(obj->className(), Table());
+  _tables.insert(obj, Table());
   return true;
 }
 
 bool
 Codeplug::Context::remTable(const QMetaObject *obj, bool exact) {
-  if (! hasTable(obj, exact))
+  if (_frozen)
     return false;
-  if (_tables.contains(obj->className()))
-    return _tables.remove(obj->className());
-  return remTable(obj->superClass());
+  for (; nullptr != obj; obj = obj->superClass()) {
+    if (_tables.contains(obj))
+      return _tables.remove(obj);
+    if (exact)
+      return false;
+  }
+  return false;
+}
+
+void
+Codeplug::Context::freeze() {
+  _frozen = true;
+}
+
+void
+Codeplug::Context::thaw() {
+  _frozen = false;
+}
+
+bool
+Codeplug::Context::isFrozen() const {
+  return _frozen;
 }
 
 
 ConfigItem *
 Codeplug::Context::obj(const QMetaObject *elementType, unsigned idx, bool exact) {
-  if (! hasTable(elementType, exact))
+  const Table *table = findTable(elementType, exact);
+  if ((nullptr == table) || (idx >= table->objects.size()))
     return nullptr;
-  return getTable(elementType).objects.value(idx, nullptr);
+  return table->objects[idx];
 }
 
 int
 Codeplug::Context::index(ConfigItem *obj) {
   if (nullptr == obj)
     return -1;
-  if (! hasTable(obj->metaObject()))
+  const Table *table = findTable(obj->metaObject());
+  if (nullptr == table)
     return -1;
-  return getTable(obj->metaObject()).indices.value(obj, -1);
+  return table->indices.value(obj, -1);
 }
 
 bool
 Codeplug::Context::add(ConfigItem *obj, unsigned idx) {
-  if (! hasTable(obj->metaObject()))
+  const Table *table = findTable(obj->metaObject());
+  if (nullptr == table)
     return false;
-  if (! getTable(obj->metaObject()).indices.contains(obj))
-    getTable(obj->metaObject()).indices.insert(obj, idx);
-  if (! getTable(obj->metaObject()).objects.contains(idx))
-    getTable(obj->metaObject()).objects.insert(idx, obj);
+  if (_frozen) {
+    // A frozen context cannot be modified, but associating an object with its existing index is
+    // fine.
+    return table->indices.contains(obj) && (idx == table->indices.value(obj));
+  }
+  Table &t = const_cast<Table &>(*table);
+  if (! t.indices.contains(obj))
+    t.indices.insert(obj, idx);
+  if (idx >= t.objects.size())
+    t.objects.resize(idx+1, nullptr);
+  if (nullptr == t.objects[idx])
+    t.objects[idx] = obj;
   return true;
 }
 
@@ -870,7 +916,7 @@ Codeplug::Context::add(ConfigItem *obj, unsigned idx) {
  * Implementation of CodePlug
  * ********************************************************************************************* */
 Codeplug::Codeplug(QObject *parent)
-  : DFUFile(parent)
+  : DFUFile(parent), _copies(nullptr)
 {
 	// pass...
 }
@@ -881,7 +927,33 @@ Codeplug::~Codeplug() {
 
 Config *
 Codeplug::preprocess(Config *config, const ErrorStack &err) const {
-  return ConfigCopy::copy(config, err)->as<Config>();
+  QHash<ConfigObject *, ConfigObject *> map;
+  ConfigItem *copy = ConfigCopy::copy(config, map, err);
+  if (nullptr == copy)
+    return nullptr;
+  if (nullptr != _copies) {
+    for (auto obj=map.begin(); obj!=map.end(); obj++)
+      _copies->insert(obj.key(), obj.value());
+  }
+  return copy->as<Config>();
+}
+
+Config *
+Codeplug::preprocessWithOrigins(Config *config, QHash<const ConfigObject *, const ConfigObject *> &origins,
+                                const ErrorStack &err) const {
+  QHash<const ConfigObject *, QPointer<ConfigObject>> copies;
+  _copies = &copies;
+  Config *intermediate = preprocess(config, err);
+  _copies = nullptr;
+
+  origins.clear();
+  if (nullptr == intermediate)
+    return nullptr;
+  for (auto obj=copies.begin(); obj!=copies.end(); obj++) {
+    if (! obj.value().isNull())
+      origins.insert(obj.value().data(), obj.key());
+  }
+  return intermediate;
 }
 
 bool
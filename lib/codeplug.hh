@@ -3,11 +3,14 @@
 
 #include <QObject>
 #include <QHash>
+#include <QPointer>
+#include <vector>
 #include "dfufile.hh"
 #include "transferflags.hh"
 
 class Config;
 class ConfigItem;
+class ConfigObject;
 class SatelliteDatabase;
 
 
@@ -47,10 +50,18 @@ public:
     /** Sets if roaming gets enabled automatically. */
     void setAutoEnableRoaming(bool enable);
 
+    /** If @c true, independent sections of the codeplug get encoded concurrently on the global
+     * thread pool. Only codeplugs that support this (currently the AnyTone family) make use of
+     * it, all others ignore it. Default @c false. */
+    bool parallelEncode() const;
+    /** Enables/disables the concurrent encoding of codeplug sections. */
+    void setParallelEncode(bool enable);
+
   protected:
     bool _updateCodeplug;
     bool _autoEnableGPS;
     bool _autoEnableRoaming;
+    bool _parallelEncode;
   };
 
 
@@ -355,6 +366,14 @@ public:
     /** Deletes a table. */
     bool remTable(const QMetaObject *obj, bool exact=false);
 
+    /** Freezes the context. A frozen context is read-only: no tables or indices can be added or
+     * removed. Only then, the context can be shared between several threads. */
+    void freeze();
+    /** Un-freezes the context. */
+    void thaw();
+    /** Returns @c true if the context is frozen. */
+    bool isFrozen() const;
+
     /** Returns the object associated by the given index and type. */
     template <class T>
     T* get(unsigned idx) {
@@ -370,18 +389,19 @@ public:
     /** Returns the number of elements for the specified type. */
     template <class T>
     unsigned int count(bool exact=true) {
-      if (! hasTable(&T::staticMetaObject, exact))
+      const Table *table = findTable(&T::staticMetaObject, exact);
+      if (nullptr == table)
         return 0;
-      return getTable(&T::staticMetaObject).indices.size();
+      return table->indices.size();
     }
 
-    /** Returns a reference to the object table. */
+    /** Returns a reference to the index->object table. Unused indices are @c nullptr. */
     template <class T>
-    const QHash<ConfigItem*, unsigned> &objects() {
+    const std::vector<ConfigItem *> &objects() {
       return getTable(&T::staticMetaObject).objects;
     }
 
-    /** Returns a reference to the index table. */
+    /** Returns a reference to the object->index table. */
     template <class T>
     const QHash<ConfigItem*, unsigned> &indices() {
       return getTable(&T::staticMetaObject).indices;
@@ -391,13 +411,14 @@ public:
      * Returns null otherwise. */
     template <class T>
     T* find(std::function<bool(T*)> test) {
-      if (! hasTable(&T::staticMetaObject))
+      const Table *table = findTable(&T::staticMetaObject, false);
+      if (nullptr == table)
         return nullptr;
-      for (auto item: getTable(&T::staticMetaObject).indices.keys()) {
-        if (nullptr == qobject_cast<T*>(item))
+      for (auto item=table->indices.keyBegin(); item!=table->indices.keyEnd(); item++) {
+        if (nullptr == qobject_cast<T*>(*item))
           continue;
-        if (test(qobject_cast<T*>(item)))
-          return qobject_cast<T*>(item);
+        if (test(qobject_cast<T*>(*item)))
+          return qobject_cast<T*>(*item);
       }
       return nullptr;
     }
@@ -406,13 +427,17 @@ public:
     /** Internal used table type to associate objects and indices. */
     class Table {
     public:
-      /** The index->object map. */
-      QHash<unsigned, ConfigItem *> objects;
+      /** The dense index->object map. Unused indices are @c nullptr. */
+      std::vector<ConfigItem *> objects;
       /** The object->index map. */
       QHash<ConfigItem *, unsigned> indices;
     };
 
   protected:
+    /** Returns the table for the given type or one of its super classes. If @c exact is
+     * @c true, only the table for exactly the given type is returned.
+     * @returns @c nullptr if there is no such table. */
+    const Table *findTable(const QMetaObject *obj, bool exact=false) const;
     /** Returns a reference to the table for the given type. */
     Table &getTable(const QMetaObject *obj);
 
@@ -421,8 +446,10 @@ public:
     Config *_config;
     /** A weak reference to the satellite database. */
     SatelliteDatabase *_satellites;
-    /** Table of tables. */
-    QHash<QString, Table> _tables;
+    /** Table of tables, keyed by type. */
+    QHash<const QMetaObject *, Table> _tables;
+    /** If @c true, the context is read-only. */
+    bool _frozen;
   };
 
 protected:
@@ -449,9 +476,20 @@ public:
   /** Returns a prepared configuration for this particular radio. All unsupported features are
    *  removed from the copy. The default implementation only copies the config. */
   virtual Config *preprocess(Config *config, const ErrorStack &err=ErrorStack()) const;
+  /** Same as @c preprocess, but also maps each object of the returned configuration to the
+   * object of @c config it was copied from. Objects created during the preprocessing (e.g., split
+   * zones) are not mapped. Used to key the incremental verification on the original objects. */
+  Config *preprocessWithOrigins(Config *config, QHash<const ConfigObject *, const ConfigObject *> &origins,
+                                const ErrorStack &err=ErrorStack()) const;
   /** Encodes a given abstract configuration (@c config) to the device specific binary code-plug.
    * This must be implemented by the device-specific codeplug. */
   virtual bool encode(Config *config, const Flags &flags=Flags(), const ErrorStack &err=ErrorStack()) = 0;
+
+protected:
+  /** While @c preprocessWithOrigins runs, collects the copies made by @c preprocess keyed by
+   * their originals. Objects deleted during the preprocessing drop out as the pointers are
+   * guarded. */
+  mutable QHash<const ConfigObject *, QPointer<ConfigObject>> *_copies;
 };
 
 #endif // CODEPLUG_HH
@@ -62,7 +62,7 @@ CommercialChannelExtension::setEncryptionKey(EncryptionKey *key) {
   if (_encryptionKey.as<EncryptionKey>() == key)
     return;
   _encryptionKey.set(key);
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -14,11 +14,26 @@
 #include <cmath>
 
 
+/* ********************************************************************************************* *
+ * Implementation of Config::UpdateGuard
+ * ********************************************************************************************* */
+Config::UpdateGuard::UpdateGuard(Config *config)
+  : _config(config)
+{
+  _config->beginUpdate();
+}
+
+Config::UpdateGuard::~UpdateGuard() {
+  _config->endUpdate();
+}
+
+
 /* ********************************************************************************************* *
  * Implementation of Config
  * ********************************************************************************************* */
 Config::Config(QObject *parent)
-  : ConfigItem(parent), _modified(false), _settings(new RadioSettings(this)),
+  : ConfigItem(parent), _modified(false), _updateDepth(0), _updatePending(false), _deferred(),
+    _settings(new RadioSettings(this)),
     _radioIDs(new RadioIDList(this)), _contacts(new ContactList(this)),
     _rxGroupLists(new RXGroupLists(this)), _channels(new ChannelList(this)),
     _zones(new ZoneList(this)), _scanlists(new ScanLists(this)),
@@ -63,7 +78,11 @@ Config::Config(QObject *parent)
 bool
 Config::copy(const ConfigItem &other) {
   const Config *conf = other.as<Config>();
-  if ((nullptr==conf) || (! ConfigItem::copy(other)))
+  if (nullptr==conf)
+    return false;
+
+  UpdateGuard update(this);
+  if (! ConfigItem::copy(other))
     return false;
 
   _settings->copy(*conf->settings());
@@ -97,7 +116,67 @@ Config::isModified() const {
 void
 Config::setModified(bool modified) {
   _modified = modified;
-  emit this->modified(this);
+  if (_updateDepth)
+    _updatePending = true;
+  else
+    emit this->modified(this);
+}
+
+void
+Config::beginUpdate() {
+  if (0 == _updateDepth++) {
+    foreach (AbstractConfigObjectList *list, lists())
+      list->beginUpdate();
+  }
+}
+
+void
+Config::endUpdate() {
+  if (0 == _updateDepth)
+    return;
+  // Flush the deferred item and collected element modifications while still updating. This way,
+  // the resulting element-modified signals are coalesced into the single modified signal below.
+  if (1 == _updateDepth) {
+    // Handlers may modify further items, hence flush until nothing is deferred anymore.
+    while (! _deferred.isEmpty()) {
+      QHash<ConfigItem *, QPointer<ConfigItem>> deferred = _deferred;
+      _deferred.clear();
+      foreach (QPointer<ConfigItem> item, deferred) {
+        if (! item.isNull())
+          emit item->modified(item.data());
+      }
+    }
+    foreach (AbstractConfigObjectList *list, lists())
+      list->endUpdate();
+  }
+  if ((0 == --_updateDepth) && _updatePending) {
+    _updatePending = false;
+    emit modified(this);
+  }
+}
+
+bool
+Config::isUpdating() const {
+  return 0 != _updateDepth;
+}
+
+void
+Config::deferModified(ConfigItem *item) {
+  if (0 == _updateDepth) {
+    emit item->modified(item);
+    return;
+  }
+  // Re-insert if a deleted item left a stale entry at the same address.
+  if (_deferred.value(item).isNull())
+    _deferred.insert(item, item);
+}
+
+QList<AbstractConfigObjectList *>
+Config::lists() const {
+  return QList<AbstractConfigObjectList *>{
+    _radioIDs, _contacts, _rxGroupLists, _channels, _zones, _scanlists, _gpsSystems,
+    _roamingChannels, _roamingZones
+  };
 }
 
 bool
@@ -312,7 +391,10 @@ Config::setTyTExtension(TyTConfigExtension *ext) {
 void
 Config::onConfigModified() {
   _modified = true;
-  emit modified(this);
+  if (_updateDepth)
+    _updatePending = true;
+  else
+    emit modified(this);
 }
 
 bool
@@ -327,6 +409,7 @@ Config::readCSV(const QString &filename, QString &errorMessage) {
 bool
 Config::readCSV(QTextStream &stream, QString &errorMessage)
 {
+  UpdateGuard update(this);
   return CSVReader::read(this, stream, errorMessage);
 }
 
@@ -354,17 +437,20 @@ Config::readYAML(const QString &filename, const ErrorStack &err) {
     return false;
   }
 
-  clear();
-  ConfigItem::Context context;
+  {
+    // The update must be finished before the modified flag is reset below.
+    UpdateGuard update(this);
+    clear();
+    ConfigItem::Context context;
 
-  if (! parse(node, context, err))
-    return false;
+    if (! parse(node, context, err))
+      return false;
 
-  if (! link(node, context, err))
-    return false;
+    if (! link(node, context, err))
+      return false;
+  }
 
   setModified(false);
-  emit modified(this);
 
   return true;
 }
@@ -39,6 +39,7 @@
 #define CONFIG_HH
 
 #include <QTextStream>
+#include <QPointer>
 
 #include "configobject.hh"
 #include "contact.hh"
@@ -98,6 +99,22 @@ class Config : public ConfigItem
   /** Represents the config extension for TyT devices. */
   Q_PROPERTY(TyTConfigExtension* tytExtension READ tytExtension WRITE setTyTExtension)
 
+public:
+  /** Batches all modifications of the configuration between its construction and destruction
+   * into a single update, see @c Config::beginUpdate. */
+  class UpdateGuard
+  {
+  public:
+    /** Starts a batch update of the given configuration. */
+    explicit UpdateGuard(Config *config);
+    /** Ends the batch update. */
+    ~UpdateGuard();
+
+  protected:
+    /** The configuration being updated. */
+    Config *_config;
+  };
+
 public:
   /** Constructs an empty configuration. */
   Q_INVOKABLE explicit Config(QObject *parent = nullptr);
@@ -110,6 +127,26 @@ public:
   /** Sets the modified flag. */
   void setModified(bool modified);
 
+  /** Starts a batch update of the configuration.
+   *
+   * While updating, the @c modified signals of the items within the configuration are deferred,
+   * the modifications of the list elements are collected instead of being signalled individually
+   * and the @c modified signal of the configuration is held back. Once the outermost batch
+   * update ends (see @c endUpdate), each deferred item emits its @c modified signal once, each
+   * list emits a single @c elementModified signal per
+   * modified element and the configuration emits a single @c modified signal. Additions and
+   * removals of elements are still signalled immediately, as views depend on them to keep their
+   * indices valid. Calls may be nested. Prefer @c UpdateGuard over calling this method
+   * directly. */
+  void beginUpdate();
+  /** Ends a batch update, see @c beginUpdate. */
+  void endUpdate();
+  /** Returns @c true if a batch update is in progress. */
+  bool isUpdating() const;
+  /** Defers the @c modified signal of the given item until the current batch update ends.
+   * Called by @c ConfigItem, if the item is modified during a batch update. */
+  void deferModified(ConfigItem *item);
+
   /** Returns the radio wide settings. */
   RadioSettings *settings() const;
   /** Returns the list of radio IDs. */
@@ -172,6 +209,10 @@ public:
 protected:
   bool populate(YAML::Node &node, const Context &context, const ErrorStack &err=ErrorStack());
 
+private:
+  /** Returns all lists of the configuration. */
+  QList<AbstractConfigObjectList *> lists() const;
+
 protected slots:
   /** Iternal callback. */
   void onConfigModified();
@@ -179,6 +220,13 @@ protected slots:
 protected:
   /** If @c true, the configuration was modified. */
   bool _modified;
+  /** Nesting depth of batch updates. */
+  unsigned int _updateDepth;
+  /** If @c true, a modification was held back during the current batch update. */
+  bool _updatePending;
+  /** The items modified during the current batch update. The guarded pointers skip items deleted
+   * before the update ends. */
+  QHash<ConfigItem *, QPointer<ConfigItem>> _deferred;
   /** Radio wide settings. */
   RadioSettings *_settings;
   /** The list of radio IDs. */
@@ -1,4 +1,5 @@
 #include "configcopyvisitor.hh"
+#include "config.hh"
 #include "configobject.hh"
 #include "configreference.hh"
 #include "channel.hh"
@@ -298,6 +299,12 @@ FixReferencesVisistor::FixReferencesVisistor(QHash<ConfigObject *, ConfigObject
   map[DefaultRoamingZone::get()] = DefaultRoamingZone::get();
 }
 
+bool
+FixReferencesVisistor::process(Config *config, const ErrorStack &err) {
+  Config::UpdateGuard update(config);
+  return Visitor::process(config, err);
+}
+
 bool
 FixReferencesVisistor::processProperty(ConfigItem *item, const QMetaProperty &prop, const ErrorStack &err) {
   // First, traverse normally
@@ -357,6 +364,11 @@ FixReferencesVisistor::processList(AbstractConfigObjectList *list, const ErrorSt
 ConfigItem *
 ConfigCopy::copy(ConfigItem *original, const ErrorStack &err) {
   QHash<ConfigObject*, ConfigObject*> map;
+  return copy(original, map, err);
+}
+
+ConfigItem *
+ConfigCopy::copy(ConfigItem *original, QHash<ConfigObject *, ConfigObject *> &map, const ErrorStack &err) {
   ConfigCloneVisitor cloner(map);
   if (! cloner.processItem(original, err)) {
     errMsg(err) << "Cannot clone item of type " << original->metaObject()->className() << ".";
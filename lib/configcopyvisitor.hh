@@ -44,6 +44,8 @@ public:
   /** Constructor. */
   FixReferencesVisistor(QHash<ConfigObject *, ConfigObject*> &map, bool keepUnknown=false);
 
+  /** Traverses the configuration within a single batch update. */
+  bool process(Config *config, const ErrorStack &err=ErrorStack());
   bool processProperty(ConfigItem *item, const QMetaProperty &prop, const ErrorStack &err=ErrorStack());
   bool processList(AbstractConfigObjectList *list, const ErrorStack &err=ErrorStack());
 
@@ -59,6 +61,10 @@ class ConfigCopy {
 public:
   /** Copies the given item. */
   static ConfigItem *copy(ConfigItem *original, const ErrorStack &err=ErrorStack());
+  /** Copies the given item. The copies of all objects are stored in @c map, keyed by their
+   * originals. */
+  static ConfigItem *copy(ConfigItem *original, QHash<ConfigObject *, ConfigObject *> &map,
+                          const ErrorStack &err=ErrorStack());
 };
 
 #endif // CONFIGCOPYVISITOR_HH
@@ -48,11 +48,10 @@ ConfigMergeVisitor::processItem(ConfigItem *item, const ErrorStack &err) {
 
 bool
 ConfigMergeVisitor::processRadioID(RadioID *item, const ErrorStack &err) {
-  if (0 == _destination->radioIDs()->findItemsByName(item->name()).count())
+  ConfigObject *obj = _destination->radioIDs()->findFirstByName(item->name());
+  if (nullptr == obj)
     return addObject(_destination->radioIDs(), nullptr, item, err);
-
-  RadioID *present = _destination->radioIDs()->findItemsByName(item->name())
-      .first()->as<RadioID>();
+  RadioID *present = obj->as<RadioID>();
 
   if (ItemStrategy::Ignore == _itemStrategy)
     return ignoreObject(_destination->radioIDs(), present, item, err);
@@ -69,11 +68,10 @@ ConfigMergeVisitor::processRadioID(RadioID *item, const ErrorStack &err) {
 
 bool
 ConfigMergeVisitor::processChannel(Channel *item, const ErrorStack &err) {
-  if (0 == _destination->channelList()->findItemsByName(item->name()).count())
+  ConfigObject *obj = _destination->channelList()->findFirstByName(item->name());
+  if (nullptr == obj)
     return addObject(_destination->channelList(), nullptr, item, err);
-
-  Channel *present = _destination->channelList()->findItemsByName(item->name())
-      .first()->as<Channel>();
+  Channel *present = obj->as<Channel>();
 
   if (ItemStrategy::Ignore == _itemStrategy)
     return ignoreObject(_destination->channelList(), present, item, err);
@@ -90,11 +88,10 @@ ConfigMergeVisitor::processChannel(Channel *item, const ErrorStack &err) {
 
 bool
 ConfigMergeVisitor::processContact(Contact *item, const ErrorStack &err) {
-  if (0 == _destination->contacts()->findItemsByName(item->name()).count())
+  ConfigObject *obj = _destination->contacts()->findFirstByName(item->name());
+  if (nullptr == obj)
     return addObject(_destination->contacts(), nullptr, item, err);
-
-  Contact *present = _destination->contacts()->findItemsByName(item->name())
-      .first()->as<Contact>();
+  Contact *present = obj->as<Contact>();
 
   if (ItemStrategy::Ignore == _itemStrategy)
     return ignoreObject(_destination->contacts(), present, item, err);
@@ -111,11 +108,10 @@ ConfigMergeVisitor::processContact(Contact *item, const ErrorStack &err) {
 
 bool
 ConfigMergeVisitor::processPositioningSystem(PositionReportingSystem *item, const ErrorStack &err) {
-  if (0 == _destination->posSystems()->findItemsByName(item->name()).count())
+  ConfigObject *obj = _destination->posSystems()->findFirstByName(item->name());
+  if (nullptr == obj)
     return addObject(_destination->posSystems(), nullptr, item, err);
-
-  PositionReportingSystem *present = _destination->posSystems()->findItemsByName(item->name())
-      .first()->as<PositionReportingSystem>();
+  PositionReportingSystem *present = obj->as<PositionReportingSystem>();
 
   if (ItemStrategy::Ignore == _itemStrategy)
     return ignoreObject(_destination->posSystems(), present, item, err);
@@ -132,11 +128,10 @@ ConfigMergeVisitor::processPositioningSystem(PositionReportingSystem *item, cons
 
 bool
 ConfigMergeVisitor::processRoamingChannel(RoamingChannel *item, const ErrorStack &err) {
-  if (0 == _destination->roamingChannels()->findItemsByName(item->name()).count())
+  ConfigObject *obj = _destination->roamingChannels()->findFirstByName(item->name());
+  if (nullptr == obj)
     return addObject(_destination->roamingChannels(), nullptr, item, err);
-
-  RoamingChannel *present = _destination->roamingChannels()->findItemsByName(item->name())
-      .first()->as<RoamingChannel>();
+  RoamingChannel *present = obj->as<RoamingChannel>();
 
   if (ItemStrategy::Ignore == _itemStrategy)
     return ignoreObject(_destination->roamingChannels(), present, item, err);
@@ -153,11 +148,10 @@ ConfigMergeVisitor::processRoamingChannel(RoamingChannel *item, const ErrorStack
 
 bool
 ConfigMergeVisitor::processGroupList(RXGroupList *item, const ErrorStack &err) {
-  if (0 == _destination->rxGroupLists()->findItemsByName(item->name()).count())
+  ConfigObject *obj = _destination->rxGroupLists()->findFirstByName(item->name());
+  if (nullptr == obj)
     return addObject(_destination->rxGroupLists(), nullptr, item, err);
-
-  RXGroupList *present = _destination->rxGroupLists()->findItemsByName(item->name())
-      .first()->as<RXGroupList>();
+  RXGroupList *present = obj->as<RXGroupList>();
 
   if (SetStrategy::Ignore == _setStrategy)
     return ignoreObject(_destination->rxGroupLists(), present, item, err);
@@ -177,11 +171,10 @@ ConfigMergeVisitor::processGroupList(RXGroupList *item, const ErrorStack &err) {
 
 bool
 ConfigMergeVisitor::processZone(Zone *item, const ErrorStack &err) {
-  if (0 == _destination->zones()->findItemsByName(item->name()).count())
+  ConfigObject *obj = _destination->zones()->findFirstByName(item->name());
+  if (nullptr == obj)
     return addObject(_destination->zones(), nullptr, item, err);
-
-  Zone *present = _destination->zones()->findItemsByName(item->name())
-      .first()->as<Zone>();
+  Zone *present = obj->as<Zone>();
 
   if (SetStrategy::Ignore == _setStrategy)
     return ignoreObject(_destination->zones(), present, item, err);
@@ -202,11 +195,10 @@ ConfigMergeVisitor::processZone(Zone *item, const ErrorStack &err) {
 
 bool
 ConfigMergeVisitor::processScanList(ScanList *item, const ErrorStack &err) {
-  if (0 == _destination->scanlists()->findItemsByName(item->name()).count())
+  ConfigObject *obj = _destination->scanlists()->findFirstByName(item->name());
+  if (nullptr == obj)
     return addObject(_destination->scanlists(), nullptr, item, err);
-
-  ScanList *present = _destination->scanlists()->findItemsByName(item->name())
-      .first()->as<ScanList>();
+  ScanList *present = obj->as<ScanList>();
 
   if (SetStrategy::Ignore == _setStrategy)
     return ignoreObject(_destination->scanlists(), present, item, err);
@@ -226,11 +218,10 @@ ConfigMergeVisitor::processScanList(ScanList *item, const ErrorStack &err) {
 
 bool
 ConfigMergeVisitor::processRoamingZone(RoamingZone *item, const ErrorStack &err) {
-  if (0 == _destination->roamingZones()->findItemsByName(item->name()).count())
+  ConfigObject *obj = _destination->roamingZones()->findFirstByName(item->name());
+  if (nullptr == obj)
     return addObject(_destination->roamingZones(), nullptr, item, err);
-
-  RoamingZone *present = _destination->roamingZones()->findItemsByName(item->name())
-      .first()->as<RoamingZone>();
+  RoamingZone *present = obj->as<RoamingZone>();
 
   if (SetStrategy::Ignore == _setStrategy)
     return ignoreObject(_destination->roamingZones(), present, item, err);
@@ -338,6 +329,7 @@ ConfigMerge::mergeInto(Config *destination, Config *source,
                        ConfigMergeVisitor::SetStrategy setStrategy,
                        const ErrorStack &err)
 {
+  Config::UpdateGuard update(destination);
   QHash<ConfigObject *, ConfigObject *> referenceTable;
   ConfigMergeVisitor mergeVisitor(destination, referenceTable, itemStrategy, setStrategy);
   if (! mergeVisitor.process(source, err)) {
@@ -4,6 +4,7 @@
 #include "visitor.hh"
 
 class ConfigObject;
+class AbstractConfigObjectList;
 class RadioID;
 class Channel;
 class Contact;
@@ -1,4 +1,5 @@
 #include "configobject.hh"
+#include "config.hh"
 #include "configreference.hh"
 #include "logger.hh"
 #include "frequency.hh"
@@ -259,7 +260,7 @@ ConfigItem::copy(const ConfigItem &other) {
     }
   }
 
-  emit modified(this);
+  emitModified();
   return true;
 }
 
@@ -1057,6 +1058,15 @@ ConfigItem::config() const {
   return nullptr;
 }
 
+void
+ConfigItem::emitModified() {
+  const Config *owner = config();
+  if ((nullptr != owner) && (owner != this) && owner->isUpdating())
+    const_cast<Config *>(owner)->deferModified(this);
+  else
+    emit modified(this);
+}
+
 void
 ConfigItem::findItemsOfTypes(const QStringList &typeNames, QSet<ConfigItem *> &items) const {
   // Do not check yourself
@@ -1170,7 +1180,8 @@ ConfigObject::setName(const QString &name) {
   if (name.simplified().isEmpty() || (_name == name.simplified()))
     return;
   _name = name;
-  emit modified(this);
+  emit renamed(this);
+  emitModified();
 }
 
 QString
@@ -1252,13 +1263,15 @@ ConfigExtension::ConfigExtension(QObject *parent)
  * Implementation of AbstractConfigObjectList
  * ********************************************************************************************* */
 AbstractConfigObjectList::AbstractConfigObjectList(const QMetaObject &elementType, QObject *parent)
-  : QObject(parent), _elementTypes(), _items()
+  : QObject(parent), _elementTypes(), _items(), _positions(), _names(), _indexedNames(),
+    _updateDepth(0), _pendingModified()
 {
   _elementTypes.append(elementType);
 }
 
 AbstractConfigObjectList::AbstractConfigObjectList(const std::initializer_list<QMetaObject> &elementTypes, QObject *parent)
-  : QObject(parent), _elementTypes(elementTypes), _items()
+  : QObject(parent), _elementTypes(elementTypes), _items(), _positions(), _names(), _indexedNames(),
+    _updateDepth(0), _pendingModified()
 {
   // pass...
 }
@@ -1279,13 +1292,13 @@ AbstractConfigObjectList::count() const {
 
 int
 AbstractConfigObjectList::indexOf(ConfigObject *obj) const {
-  return _items.indexOf(obj);
+  return _positions.value(obj, -1);
 }
 
 void
 AbstractConfigObjectList::clear() {
   for (int i=(count()-1); i>=0; i--) {
-    _items.pop_back();
+    removeAt(i);
     emit elementRemoved(i);
   }
 }
@@ -1310,14 +1323,23 @@ AbstractConfigObjectList::findItemsOfTypes(const QStringList &typeNames, QSet<Co
 
 QList<ConfigObject *>
 AbstractConfigObjectList::findItemsByName(const QString name) const {
-  QList<ConfigObject *> items;
-  foreach (ConfigObject *obj, _items) {
-    if (obj->name() == name)
-      items.append(obj);
-  }
+  QList<ConfigObject *> items = _names.values(name);
+  std::sort(items.begin(), items.end(), [this](ConfigObject *a, ConfigObject *b) {
+    return indexOf(a) < indexOf(b);
+  });
   return items;
 }
 
+ConfigObject *
+AbstractConfigObjectList::findFirstByName(const QString &name) const {
+  ConfigObject *first = nullptr;
+  for (auto item = _names.constFind(name); (_names.constEnd() != item) && (item.key() == name); item++) {
+    if ((nullptr == first) || (indexOf(item.value()) < indexOf(first)))
+      first = item.value();
+  }
+  return first;
+}
+
 bool
 AbstractConfigObjectList::has(ConfigObject *obj) const {
   return 0 <= indexOf(obj);
@@ -1351,10 +1373,11 @@ AbstractConfigObjectList::add(ConfigObject *obj, int row, bool unique) {
                << " to list, expected instances of " << classNames().join(", ");
     return -1;
   }
-  _items.insert(row, obj);
+  insertAt(row, obj);
   // Otherwise connect to object
   connect(obj, SIGNAL(destroyed(QObject*)), this, SLOT(onElementDeleted(QObject*)));
   connect(obj, SIGNAL(modified(ConfigItem*)), this, SLOT(onElementModified(ConfigItem*)));
+  connect(obj, SIGNAL(renamed(ConfigObject*)), this, SLOT(onElementRenamed(ConfigObject*)));
   emit elementAdded(row);
   return row;
 }
@@ -1388,15 +1411,15 @@ AbstractConfigObjectList::replace(ConfigObject *obj, int row, bool unique) {
   }
 
   // Remove present element
-  ConfigObject *oldobj = _items.at(row);
-  _items.remove(row, 1);
+  ConfigObject *oldobj = removeAt(row);
   emit elementRemoved(row);
   disconnect(oldobj, nullptr, this, nullptr);
 
-  _items.insert(row, obj);
+  insertAt(row, obj);
   // connect to object
   connect(obj, SIGNAL(destroyed(QObject*)), this, SLOT(onElementDeleted(QObject*)));
   connect(obj, SIGNAL(modified(ConfigItem*)), this, SLOT(onElementModified(ConfigItem*)));
+  connect(obj, SIGNAL(renamed(ConfigObject*)), this, SLOT(onElementRenamed(ConfigObject*)));
   emit elementAdded(row);
 
   return row;
@@ -1410,7 +1433,7 @@ AbstractConfigObjectList::take(ConfigObject *obj) {
   int idx = indexOf(obj);
   if (0 > idx)
     return false;
-  _items.remove(idx, 1);
+  removeAt(idx);
   emit elementRemoved(idx);
   // Otherwise disconnect from
   disconnect(obj, nullptr, this, nullptr);
@@ -1427,6 +1450,7 @@ AbstractConfigObjectList::moveUp(int row) {
   if ((row <= 0) || (row>=count()))
     return false;
   std::swap(_items[row-1], _items[row]);
+  reindex(row-1, row);
   return true;
 }
 
@@ -1436,6 +1460,7 @@ AbstractConfigObjectList::moveUp(int first, int last) {
     return false;
   for (int row=first; row<=last; row++)
     std::swap(_items[row-1], _items[row]);
+  reindex(first-1, last);
   return true;
 }
 
@@ -1444,6 +1469,7 @@ AbstractConfigObjectList::moveDown(int row) {
   if ((row >= (count()-1)) || (0 > row))
     return false;
   std::swap(_items[row+1], _items[row]);
+  reindex(row, row+1);
   return true;
 }
 
@@ -1453,6 +1479,7 @@ AbstractConfigObjectList::moveDown(int first, int last) {
     return false;
   for (int row=last; row>=first; row--)
     std::swap(_items[row+1], _items[row]);
+  reindex(first, last+1);
   return true;
 }
 
@@ -1474,6 +1501,7 @@ AbstractConfigObjectList::move(int source, int count, int destination) {
     for (int i=0; i<count; i++)
       _items.insert(destination-1, _items.takeAt(source));
   }
+  reindex(std::min(source, destination));
 
   for (int i=0; i<count; i++)
     emit elementModified(destination+i);
@@ -1496,20 +1524,120 @@ AbstractConfigObjectList::classNames() const {
   return cls;
 }
 
+void
+AbstractConfigObjectList::beginUpdate() {
+  _updateDepth++;
+}
+
+void
+AbstractConfigObjectList::endUpdate() {
+  if ((0 == _updateDepth) || (0 != --_updateDepth) || _pendingModified.isEmpty())
+    return;
+
+  QVector<int> indices; indices.reserve(_pendingModified.size());
+  foreach (ConfigObject *obj, _pendingModified) {
+    int idx = indexOf(obj);
+    if (0 <= idx)
+      indices.append(idx);
+  }
+  _pendingModified.clear();
+
+  std::sort(indices.begin(), indices.end());
+  foreach (int idx, indices)
+    emit elementModified(idx);
+}
+
+bool
+AbstractConfigObjectList::isUpdating() const {
+  return 0 != _updateDepth;
+}
+
+void
+AbstractConfigObjectList::insertAt(int row, ConfigObject *obj) {
+  bool present = _positions.contains(obj);
+  _items.insert(row, obj);
+  reindex(row);
+  if (! present)
+    indexName(obj);
+}
+
+ConfigObject *
+AbstractConfigObjectList::removeAt(int row) {
+  ConfigObject *obj = _items.takeAt(row);
+  if (row == _positions.value(obj, -1))
+    _positions.remove(obj);
+  reindex(row);
+  if (! _positions.contains(obj)) {
+    unindexName(obj);
+    _pendingModified.remove(obj);
+  }
+  return obj;
+}
+
+void
+AbstractConfigObjectList::reindex(int from, int to) {
+  if ((0 > to) || (to >= _items.size()))
+    to = _items.size()-1;
+  // Items first appearing before 'from' are not affected. Iterating backwards ensures that the
+  // first occurrence within the range is stored.
+  for (int i=to; i>=from; i--) {
+    auto pos = _positions.find(_items[i]);
+    if (_positions.end() == pos)
+      _positions.insert(_items[i], i);
+    else if (pos.value() >= from)
+      pos.value() = i;
+  }
+}
+
+void
+AbstractConfigObjectList::indexName(ConfigObject *obj) {
+  QString name = obj->name();
+  _indexedNames.insert(obj, name);
+  _names.insert(name, obj);
+}
+
+void
+AbstractConfigObjectList::unindexName(ConfigObject *obj) {
+  // Do not access the object here, it may already be destroyed.
+  auto name = _indexedNames.find(obj);
+  if (_indexedNames.end() == name)
+    return;
+  _names.remove(name.value(), obj);
+  _indexedNames.erase(name);
+}
+
 void
 AbstractConfigObjectList::onElementModified(ConfigItem *obj) {
-  int idx = indexOf(obj->as<ConfigObject>());
-  if (0 <= idx)
+  ConfigObject *cobj = obj->as<ConfigObject>();
+  int idx = indexOf(cobj);
+  if (0 > idx)
+    return;
+  // Update name index, if the object was renamed
+  if (_indexedNames.value(cobj) != cobj->name()) {
+    unindexName(cobj);
+    indexName(cobj);
+  }
+  if (_updateDepth)
+    _pendingModified.insert(cobj);
+  else
     emit elementModified(idx);
 }
 
+void
+AbstractConfigObjectList::onElementRenamed(ConfigObject *obj) {
+  if ((0 <= indexOf(obj)) && (_indexedNames.value(obj) != obj->name())) {
+    unindexName(obj);
+    indexName(obj);
+  }
+}
+
 void
 AbstractConfigObjectList::onElementDeleted(QObject *obj) {
   // Use reinterpret cast here as the obj may already be destroyed and this all RTTI freed.
   // We just use the pointer address to remove the element here.
   int idx = indexOf(reinterpret_cast<ConfigObject *>(obj));
   if (0 <= idx) {
-    _items.remove(idx);
+    removeAt(idx);
     emit elementRemoved(idx);
   }
 }
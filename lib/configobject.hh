@@ -4,6 +4,7 @@
 #include <QObject>
 #include <QString>
 #include <QHash>
+#include <QSet>
 #include <QVector>
 #include <QMetaProperty>
 
@@ -174,6 +175,9 @@ protected:
   /** Recursively serializes the configuration to YAML nodes.
    * The complete configuration must be labeled first. */
   virtual bool populate(YAML::Node &node, const Context &context, const ErrorStack &err=ErrorStack());
+  /** Emits the @c modified signal. If the config owning this item is within a batch update (see
+   * @c Config::beginUpdate), the signal is deferred until the update ends. */
+  void emitModified();
 
 signals:
   /** Gets emitted once the config object is modified.
@@ -226,6 +230,11 @@ protected:
   /** Helper to find the @c IdPrefix class info in the class hierarchy. */
   static QString findIdPrefix(const QMetaObject* meta);
 
+signals:
+  /** Gets emitted once the object gets renamed. In contrast to @c modified, this signal is never
+   * deferred during batch updates, as lists need it to keep their name index valid. */
+  void renamed(ConfigObject *obj);
+
 protected:
   /** Holds the name of the object. */
   QString _name;
@@ -278,8 +287,11 @@ public:
   virtual const Config *config() const;
   /** Searches the config tree to find all instances of the given type names. */
   virtual void findItemsOfTypes(const QStringList &typeNames, QSet<ConfigItem*> &items) const;
-  /** Searches the list for objects with the given name. */
+  /** Searches the list for objects with the given name. The objects are returned in the order
+   * they appear in the list. */
   virtual QList<ConfigObject *> findItemsByName(const QString name) const;
+  /** Returns the first object in the list with the given name or @c nullptr if there is none. */
+  virtual ConfigObject *findFirstByName(const QString &name) const;
 
   /** Returns @c true, if the list contains the given object. */
   virtual bool has(ConfigObject *obj) const;
@@ -312,6 +324,16 @@ public:
   /** Returns a list of all class names. */
   QStringList classNames() const;
 
+  /** Starts a batch update. While updating, the modifications of the elements are collected and
+   * signalled once per modified element by @c endUpdate. The name index is kept up-to-date.
+   * Calls may be nested. */
+  void beginUpdate();
+  /** Ends a batch update. Once the outermost update ends, @c elementModified is emitted for each
+   * element modified during the update in ascending order. */
+  void endUpdate();
+  /** Returns @c true if a batch update is in progress. */
+  bool isUpdating() const;
+
 signals:
   /** Gets emitted if an element was added to the list. */
   void elementAdded(int idx);
@@ -323,14 +345,40 @@ signals:
 private slots:
   /** Internal used callback to handle modified elements. */
   void onElementModified(ConfigItem *obj);
+  /** Internal used callback to update the name index of renamed elements. */
+  void onElementRenamed(ConfigObject *obj);
   /** Internal used callback to handle deleted elements. */
   void onElementDeleted(QObject *obj);
 
+protected:
+  /** Inserts the object at the given row and updates the indices. */
+  void insertAt(int row, ConfigObject *obj);
+  /** Removes the object at the given row and updates the indices.
+   * @returns The removed object. */
+  ConfigObject *removeAt(int row);
+  /** Updates the position index for all items within [@c from, @c to]. If @c to is negative, all
+   * items from @c from to the end of the list are updated. */
+  void reindex(int from, int to=-1);
+  /** Adds the given object to the name index. */
+  void indexName(ConfigObject *obj);
+  /** Removes the given object from the name index. */
+  void unindexName(ConfigObject *obj);
+
 protected:
   /** Holds the static QMetaObject of the element type. */
   QList<QMetaObject> _elementTypes;
   /** Holds the list items. */
   QVector<ConfigObject *> _items;
+  /** Maps each item to its (first) position within the list. */
+  QHash<ConfigObject *, int> _positions;
+  /** Maps names to items. */
+  QMultiHash<QString, ConfigObject *> _names;
+  /** Holds the name under which each item is indexed. */
+  QHash<ConfigObject *, QString> _indexedNames;
+  /** Nesting depth of batch updates. */
+  unsigned int _updateDepth;
+  /** The elements modified during the current batch update. */
+  QSet<ConfigObject *> _pendingModified;
 };
 
 
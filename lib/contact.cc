@@ -34,7 +34,7 @@ Contact::ring() const {
 void
 Contact::setRing(bool enable) {
   _ring = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -115,7 +115,7 @@ DTMFContact::setNumber(const QString &number) {
   if (! validDTMFNumber(number))
     return false;
   _number = number.simplified();
-  emit modified(this);
+  emitModified();
   return true;
 }
 
@@ -203,7 +203,7 @@ DMRContact::number() const {
 bool
 DMRContact::setNumber(unsigned number) {
   _number = number;
-  emit modified(this);
+  emitModified();
   return true;
 }
 
@@ -232,7 +232,7 @@ DMRContact::setOpenGD77ContactExtension(OpenGD77ContactExtension *ext) {
   if (_openGD77) {
     _openGD77->setParent(this);
     connect(_openGD77, &OpenGD77ContactExtension::modified,
-            [this](ConfigItem*){ emit modified(this); });
+            [this](ConfigItem*){ emitModified(); });
   }
 }
 
@@ -249,7 +249,7 @@ DMRContact::setAnytoneExtension(AnytoneContactExtension *ext) {
   if (_anytone) {
     _anytone->setParent(this);
     connect(_anytone, &OpenGD77ContactExtension::modified,
-            [this](ConfigItem*){ emit modified(this); });
+            [this](ConfigItem*){ emitModified(); });
   }
 }
 
@@ -47,6 +47,26 @@ static const uint32_t _crc_table[256] = {
   0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d
 };
 
+/** Additional tables for the slicing-by-8 algorithm. The k-th table holds the CRC of each byte
+ * followed by k zero-bytes. Derived from the table above upon first use. */
+struct CRC32SliceTables {
+  uint32_t table[8][256];
+
+  CRC32SliceTables() {
+    for (int i=0; i<256; i++)
+      table[0][i] = _crc_table[i];
+    for (int k=1; k<8; k++)
+      for (int i=0; i<256; i++)
+        table[k][i] = (table[k-1][i] >> 8) ^ _crc_table[table[k-1][i] & 0xff];
+  }
+};
+
+static const CRC32SliceTables &
+crc32SliceTables() {
+  static const CRC32SliceTables tables;
+  return tables;
+}
+
 
 CRC32::CRC32()
   : _crc(0xFFFFFFFF)
@@ -61,6 +81,23 @@ CRC32::update(uint8_t c) {
 
 void
 CRC32::update(const uint8_t *buf, size_t n) {
+  // Slicing-by-8: Process 8 bytes per iteration with independent table lookups. The bytes are
+  // assembled explicitly, hence this works irrespective of alignment and host byte order.
+  if (n >= 8) {
+    const uint32_t (&t)[8][256] = crc32SliceTables().table;
+    uint32_t crc = _crc;
+    for (; n>=8; n-=8, buf+=8) {
+      uint32_t lo = crc ^ (uint32_t(buf[0]) | (uint32_t(buf[1])<<8) |
+                           (uint32_t(buf[2])<<16) | (uint32_t(buf[3])<<24));
+      uint32_t hi = uint32_t(buf[4]) | (uint32_t(buf[5])<<8) |
+          (uint32_t(buf[6])<<16) | (uint32_t(buf[7])<<24);
+      crc = t[7][lo & 0xff] ^ t[6][(lo>>8) & 0xff] ^ t[5][(lo>>16) & 0xff] ^ t[4][lo>>24] ^
+          t[3][hi & 0xff] ^ t[2][(hi>>8) & 0xff] ^ t[1][(hi>>16) & 0xff] ^ t[0][hi>>24];
+    }
+    _crc = crc;
+  }
+
+  // Remaining bytes
 	for (size_t i=0; i<n; i++)
     _crc = ( _crc_table[(_crc ^ buf[i]) & 0xFF] ^ (_crc >> 8) );
 }
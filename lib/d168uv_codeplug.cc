@@ -469,9 +469,9 @@ D168UVCodeplug::allocateUpdated() {
 
 bool
 D168UVCodeplug::encodeChannels(const Flags &flags, Context &ctx, const ErrorStack &err) {
-  Q_UNUSED(flags); Q_UNUSED(err)
   // Encode channels
-  for (unsigned int i=0; i<ctx.count<Channel>(); i++) {
+  return encodeRange(ctx.count<Channel>(), flags, [this, &ctx](unsigned int i, const ErrorStack &err) {
+    Q_UNUSED(err)
     // enable channel
     uint16_t bank = i/Limit::channelsPerBank(), idx = i%Limit::channelsPerBank();
     uint32_t addr = Offset::channelBanks() + bank*Offset::betweenChannelBanks()
@@ -481,8 +481,8 @@ D168UVCodeplug::encodeChannels(const Flags &flags, Context &ctx, const ErrorStac
     ch.fromChannelObj(ctx.get<Channel>(i), ctx);
     ChannelExtensionElement ext(data(addr + Offset::toChannelExtension()));
     ext.fromChannelObj(ctx.get<Channel>(i), ctx);
-  }
-  return true;
+    return true;
+  }, err);
 }
 
 bool
@@ -3389,10 +3389,9 @@ D578UVCodeplug::createElements(Context &ctx, const ErrorStack &err) {
 
 bool
 D578UVCodeplug::encodeChannels(const Flags &flags, Context &ctx, const ErrorStack &err) {
-  Q_UNUSED(flags); Q_UNUSED(err)
-
   // Encode channels
-  for (unsigned int i=0; i<ctx.count<Channel>(); i++) {
+  return encodeRange(ctx.count<Channel>(), flags, [this, &ctx](unsigned int i, const ErrorStack &err) {
+    Q_UNUSED(err)
     // enable channel
     uint16_t bank = i/Limit::channelsPerBank(), idx = i%Limit::channelsPerBank();
     uint32_t addr = Offset::channelBanks() + bank*Offset::betweenChannelBanks()
@@ -3402,8 +3401,8 @@ D578UVCodeplug::encodeChannels(const Flags &flags, Context &ctx, const ErrorStac
 
     ChannelExtensionElement ext(data(addr + Offset::toChannelExtension()));
     ext.clear();
-  }
-  return true;
+    return true;
+  }, err);
 }
 
 bool
@@ -3475,20 +3474,24 @@ D578UVCodeplug::allocateContacts() {
 
 bool
 D578UVCodeplug::encodeContacts(const Flags &flags, Context &ctx, const ErrorStack &err) {
-  Q_UNUSED(flags); Q_UNUSED(err)
-
   QVector<DMRContact*> contacts;
-  // Encode contacts and also collect id<->index map
-  for (unsigned int i=0; i<ctx.count<DigitalContact>(); i++) {
+  for (unsigned int i=0; i<ctx.count<DigitalContact>(); i++)
+    contacts.append(ctx.get<DMRContact>(i));
+
+  // Encode contacts
+  bool ok = encodeRange(contacts.size(), flags, [this, &ctx, &contacts](unsigned int i, const ErrorStack &err) {
+    Q_UNUSED(err)
     uint32_t bank_addr = Offset::contactBanks() + (i/Limit::contactsPerBank())*Offset::betweenContactBanks();
     uint32_t addr = bank_addr + (i%Limit::contactsPerBank())*ContactElement::size();
     ContactElement con(data(addr));
-    DMRContact *contact = ctx.get<DMRContact>(i);
-    if(! con.fromContactObj(contact, ctx))
+    if(! con.fromContactObj(contacts[i], ctx))
       return false;
     ((uint32_t *)data(Offset::contactIndex()))[i] = qToLittleEndian(i);
-    contacts.append(contact);
-  }
+    return true;
+  }, err);
+  if (! ok)
+    return false;
+
   // encode index map for contacts
   std::sort(contacts.begin(), contacts.end(),
             [](DMRContact *a, DMRContact *b) {
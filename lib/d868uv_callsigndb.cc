@@ -68,20 +68,20 @@ unsigned
 D868UVCallsignDB::EntryElement::fromUser(const UserDatabase::User &user) {
   clear();
   setCallType(DMRContact::PrivateCall);
-  setNumber(user.id);
+  setNumber(user.id());
   setRingTone(RingTone::Off);
-  setContent(user.name, user.city, user.call, user.state, user.country, "");
+  setContent(user.name(), user.city(), user.call(), user.state(), user.country(), "");
   return size(user);
 }
 
 unsigned
 D868UVCallsignDB::EntryElement::size(const UserDatabase::User &user) {
   return Limit::headerLength() // header
-         + std::min(qsizetype(Limit::nameLength()), user.name.size())+1       // name
-         + std::min(qsizetype(Limit::cityLength()), user.city.size())+1       // city
-         + std::min(qsizetype(Limit::callLength()), user.call.size())+1       // call
-         + std::min(qsizetype(Limit::stateLength()), user.state.size())+1     // state
-         + std::min(qsizetype(Limit::countryLength()), user.country.size())+1 // country
+         + std::min(qsizetype(Limit::nameLength()), user.name().size())+1       // name
+         + std::min(qsizetype(Limit::cityLength()), user.city().size())+1       // city
+         + std::min(qsizetype(Limit::callLength()), user.call().size())+1       // call
+         + std::min(qsizetype(Limit::stateLength()), user.state().size())+1     // state
+         + std::min(qsizetype(Limit::countryLength()), user.country().size())+1 // country
          + 1; // no comment but 0x00 terminator
 }
 
@@ -139,106 +139,129 @@ D868UVCallsignDB::D868UVCallsignDB(QObject *parent)
 {
   // allocate and clear DB memory
   addImage("AnyTone AT-D878UV Callsign database.");
+  image(0).setFlatAddressMap(true);
 }
 
 bool D868UVCallsignDB::encode(UserDatabase *db, const Flags &selection, const ErrorStack &err) {
-  Q_UNUSED(err)
-
   // Determine size of call-sign DB in memory
-  qint64 n = std::min(db->count(), qint64(Limit::entries()));
+  qint64 n = std::min(db->count(), qint64(maxEntries()));
   // If DB size is limited by settings
   if (selection.hasCountLimit())
     n = std::min(n, (qint64)selection.countLimit());
-  logDebug() << "Encode " << n << " entries.";
 
   // Select n users and sort them in ascending order of their IDs
-  QVector<UserDatabase::User> users;
-  users.reserve(n);
-  for (unsigned i=0; i<n; i++)
-    users.append(db->user(i));
-  std::sort(users.begin(), users.end(),
-            [](const UserDatabase::User &a, const UserDatabase::User &b) { return a.id < b.id; });
-
-  logDebug() << "Encode call-signs from " << users.first().id << ": " << users.first().call << ", "
-             << users.first().name << " in " << users.first().city << " to " << users.last().id
-             << ": " << users.last().call << ", " << users.last().name << " in " << users.last().city << ".";
-
-  // Compute total size of callsign db entries
-  size_t dbSize = 0;
-  size_t indexSize = n*IndexEntryElement::size();
-  for (qint64 i=0; i<n; i++)
-    dbSize += EntryElement::size(users[i]);
-
-  // Allocate DB limits
-  image(0).addElement(Offset::limits(), LimitsElement::size());
-  // Store DB limits
-  LimitsElement limits(data(Offset::limits()));
-  limits.clear();
-  limits.setCount(n);
-  limits.setTotalSize(dbSize);
-
-  // Allocate index banks
-  for (int i=0; 0<indexSize; i++, indexSize-=std::min(indexSize, size_t(IndexBankElement::size()))) {
-    size_t addr = Offset::index() + i*Offset::betweenIndexBanks();
-    size_t size = align_size(std::min(indexSize, size_t(IndexBankElement::size())), 16);
-    image(0).addElement(addr, size);
-    memset(data(addr), 0xff, size);
-  }
+  SortedUserIterator users(db, n);
+  ImageSink sink(image(0));
+  return encode(users, sink, err);
+}
 
-  // Allocate entry banks
-  for (int i=0; 0<dbSize; i++, dbSize-=std::min(dbSize, size_t(EntryBankElement::size()))) {
-    size_t addr = Offset::callsigns() + i*Offset::betweenCallsignBanks();
-    size_t size = align_size(std::min(dbSize, size_t(EntryBankElement::size())), 16);
-    image(0).addElement(addr, size);
-    memset(data(addr), 0x00, size);
-  }
+unsigned int
+D868UVCallsignDB::maxEntries() const {
+  return Limit::entries();
+}
 
-  // Fill index, the offset of the entry is not the real memory offset,
-  // but a virtual one without the gaps.
-  uint32_t entry_offset = 0;
-  uint32_t index_offset = 0;
-  uint32_t index_bank   = 0;
-  for (qint64 i=0; i<n; i++, index_offset+=IndexEntryElement::size()) {
-    if (IndexBankElement::size() <= index_offset) {
-      index_offset = 0; index_bank += 1;
+bool
+D868UVCallsignDB::hasStreamingEncoder() const {
+  return true;
+}
+
+bool
+D868UVCallsignDB::encode(UserIterator &users, Sink &sink, const ErrorStack &err) {
+  return encodeStream(users, sink, Offset::callsigns(), Offset::limits(), err);
+}
+
+bool
+D868UVCallsignDB::encodeStream(UserIterator &users, Sink &sink, uint32_t callsigns, uint32_t limits,
+                               const ErrorStack &err)
+{
+  unsigned int maxEntries = this->maxEntries();
+  logDebug() << "Encode " << std::min(users.count(), qint64(maxEntries)) << " entries.";
+
+  // The index and entry banks are filled in parallel. The offset of the entry stored in the index
+  // is not the real memory offset, but a virtual one without the gaps.
+  BankWriter index(sink, Offset::index(), Offset::betweenIndexBanks(), IndexBankElement::size(), 0xff);
+  BankWriter entries(sink, callsigns, Offset::betweenCallsignBanks(), EntryBankElement::size(), 0x00);
+
+  uint32_t count = 0, entry_offset = 0;
+  uint8_t index_buffer[IndexEntryElement::size()];
+  uint8_t entry_buffer[EntryElement::Limit::totalLength()];
+  unsigned int lastID = 0;
+  for (const UserDatabase::User *user = users.next();
+       (nullptr != user) && (count < maxEntries); user = users.next(), count++)
+  {
+    if (lastID > user->id()) {
+      errMsg(err) << "Cannot encode call-sign DB: Users not sorted by ID.";
+      return false;
     }
-    IndexEntryElement index(data(Offset::index()+index_bank*Offset::betweenIndexBanks()+index_offset));
-    index.setID(users[i].id, false);
-    index.setIndex(entry_offset);
-    entry_offset += EntryElement::size(users[i]);
+    lastID = user->id();
+
+    memset(index_buffer, 0xff, sizeof(index_buffer));
+    IndexEntryElement idx(index_buffer);
+    idx.setID(user->id(), false);
+    idx.setIndex(entry_offset);
+    if (! index.append(index_buffer, IndexEntryElement::size(), err))
+      return false;
+
+    memset(entry_buffer, 0x00, sizeof(entry_buffer));
+    uint32_t entry_size = EntryElement(entry_buffer).fromUser(*user);
+    if (! entries.append(entry_buffer, entry_size, err))
+      return false;
+    entry_offset += entry_size;
   }
 
-  // Then store DB entries
-  uint32_t entry_bank = 0;
-  entry_offset = 0;
-  for (qint64 i=0; i<n; i++) {
-    // Get size of current entry
-    uint32_t entry_size = EntryElement::size(users[i]);
-    // Check if entry fits into bank
-    if (EntryBankElement::size() < (entry_offset+entry_size)) {
-      // If not, split
-      uint8_t buffer[100]; EntryElement(buffer).fromUser(users[i]);
-      uint32_t n1 = (EntryBankElement::size()-entry_offset);
-      uint32_t n2 = entry_size-n1;
-      if (0 != n1) {
-        // Copy first half
-        uint8_t *ptr = data(Offset::callsigns()+entry_bank*Offset::betweenCallsignBanks()+entry_offset);
-        memcpy(ptr, buffer, n1);
-      }
-      // advance bank counter
-      entry_bank++; entry_offset = 0;
-      // copy second half
-      uint8_t *ptr = data(Offset::callsigns()+entry_bank*Offset::betweenCallsignBanks()+entry_offset);
-      memcpy(ptr, buffer+n1, n2);
-      // Update offset
-      entry_offset += n2;
-    } else {
-      // when it fits, just add
-      EntryElement(data(Offset::callsigns()+entry_bank*Offset::betweenCallsignBanks()+entry_offset))
-          .fromUser(users[i]);
-      entry_offset += entry_size;
+  if ((! index.flush(err)) || (! entries.flush(err)))
+    return false;
+
+  // Finally, store DB limits
+  QByteArray buffer(LimitsElement::size(), 0x00);
+  LimitsElement limitsElement((uint8_t *)buffer.data());
+  limitsElement.clear();
+  limitsElement.setCount(count);
+  limitsElement.setTotalSize(entry_offset);
+  if (! sink.write(limits, buffer, err))
+    return false;
+
+  logDebug() << "Encoded " << count << " call-signs using " << entry_offset << "b.";
+
+  return true;
+}
+
+
+/* ********************************************************************************************* *
+ * Implementation of D868UVCallsignDB::BankWriter
+ * ********************************************************************************************* */
+D868UVCallsignDB::BankWriter::BankWriter(Sink &sink, uint32_t address, uint32_t offset, uint32_t size, char fill)
+  : _sink(sink), _address(address), _offset(offset), _size(size), _fill(fill), _bank(0), _used(0),
+    _buffer(size, fill)
+{
+  // pass...
+}
+
+bool
+D868UVCallsignDB::BankWriter::append(const uint8_t *data, uint32_t n, const ErrorStack &err) {
+  while (n) {
+    if (_size == _used) {
+      if (! flush(err))
+        return false;
     }
+    uint32_t m = std::min(n, _size-_used);
+    memcpy(_buffer.data()+_used, data, m);
+    _used += m; data += m; n -= m;
+  }
+  return true;
+}
+
+bool
+D868UVCallsignDB::BankWriter::flush(const ErrorStack &err) {
+  if (0 == _used)
+    return true;
+
+  if (! _sink.write(_address + _bank*_offset, _buffer.left(align_size(_used, 16)), err)) {
+    errMsg(err) << "Cannot write call-sign DB bank " << _bank << ".";
+    return false;
   }
 
+  _bank++; _used = 0;
+  _buffer.fill(_fill, _size);
   return true;
 }
@@ -194,6 +194,44 @@ public:
   };
 
 
+protected:
+  /** Assembles a sequence of banks and passes each bank to a sink, once it is complete. */
+  class BankWriter
+  {
+  public:
+    /** Constructor.
+     * @param sink The sink, receiving the banks.
+     * @param address The address of the first bank.
+     * @param offset The offset between two banks.
+     * @param size The size of each bank.
+     * @param fill The fill value for unused memory. */
+    BankWriter(Sink &sink, uint32_t address, uint32_t offset, uint32_t size, char fill);
+
+    /** Appends the given data, continues with the next bank if the current one is full. */
+    bool append(const uint8_t *data, uint32_t n, const ErrorStack &err=ErrorStack());
+    /** Passes the current bank to the sink. The last bank gets truncated to a multiple of 16
+     * bytes. */
+    bool flush(const ErrorStack &err=ErrorStack());
+
+  protected:
+    /** The sink. */
+    Sink &_sink;
+    /** Address of the first bank. */
+    uint32_t _address;
+    /** Offset between banks. */
+    uint32_t _offset;
+    /** Size of each bank. */
+    uint32_t _size;
+    /** Fill value. */
+    char _fill;
+    /** Index of the current bank. */
+    uint32_t _bank;
+    /** Number of bytes used within the current bank. */
+    uint32_t _used;
+    /** Buffer of the current bank. */
+    QByteArray _buffer;
+  };
+
 public:
   /** Constructor, does not allocate any memory yet. */
   explicit D868UVCallsignDB(QObject *parent=nullptr);
@@ -202,6 +240,19 @@ public:
   bool encode(UserDatabase *db, const Flags &selection=Flags(),
               const ErrorStack &err=ErrorStack());
 
+  unsigned int maxEntries() const;
+
+  bool hasStreamingEncoder() const;
+  /** Streams up to @c maxEntries() users into the given sink. */
+  bool encode(UserIterator &users, Sink &sink, const ErrorStack &err=ErrorStack());
+
+protected:
+  /** Implements the streaming encoder for the given memory layout.
+   * The index and entry banks are passed to the sink as soon as they are complete, the limits
+   * element is passed last. */
+  bool encodeStream(UserIterator &users, Sink &sink, uint32_t callsigns, uint32_t limits,
+                    const ErrorStack &err);
+
 public:
   /** Some limits for the call-sign DB. */
   struct Limit {
@@ -1493,46 +1493,25 @@ D868UVCodeplug::preprocess(Config *config, const ErrorStack &err) const {
 bool
 D868UVCodeplug::encodeElements(const Flags &flags, Context &ctx, const ErrorStack &err)
 {
-  if (! this->encodeRadioID(flags, ctx, err))
-    return false;
-
-  if (! this->encodeGeneralSettings(flags, ctx, err))
-    return false;
-
-  if (! this->encodeSMSMessages(flags, ctx, err))
-    return false;
-
-  if (! this->encodeRepeaterOffsetFrequencies(flags, ctx, err))
-    return false;
-
-  if (! this->encodeBootSettings(flags, ctx, err))
-    return false;
-
-  if (! this->encodeChannels(flags, ctx, err))
-    return false;
-
-  if (! this->encodeContacts(flags, ctx, err))
-    return false;
-
-  if (! this->encodeAnalogContacts(flags, ctx, err))
-    return false;
-
-  if (! this->encodeRXGroupLists(flags, ctx, err))
-    return false;
-
-  if (! this->encodeZones(flags, ctx, err))
-    return false;
-
-  if (! this->encodeScanLists(flags, ctx, err))
-    return false;
-
-  if (! this->encodeGPSSystems(flags, ctx, err))
-    return false;
-
-  if (! this->encodeDMREncryptionKeys(flags, ctx, err))
-    return false;
-
-  return true;
+  // All sections are encoded into disjoint memory regions, they can be encoded in any order and
+  // concurrently, if enabled.
+  QVector<EncodeTask> tasks = {
+    [this, &flags, &ctx](const ErrorStack &err) { return this->encodeRadioID(flags, ctx, err); },
+    [this, &flags, &ctx](const ErrorStack &err) { return this->encodeGeneralSettings(flags, ctx, err); },
+    [this, &flags, &ctx](const ErrorStack &err) { return this->encodeSMSMessages(flags, ctx, err); },
+    [this, &flags, &ctx](const ErrorStack &err) { return this->encodeRepeaterOffsetFrequencies(flags, ctx, err); },
+    [this, &flags, &ctx](const ErrorStack &err) { return this->encodeBootSettings(flags, ctx, err); },
+    [this, &flags, &ctx](const ErrorStack &err) { return this->encodeChannels(flags, ctx, err); },
+    [this, &flags, &ctx](const ErrorStack &err) { return this->encodeContacts(flags, ctx, err); },
+    [this, &flags, &ctx](const ErrorStack &err) { return this->encodeAnalogContacts(flags, ctx, err); },
+    [this, &flags, &ctx](const ErrorStack &err) { return this->encodeRXGroupLists(flags, ctx, err); },
+    [this, &flags, &ctx](const ErrorStack &err) { return this->encodeZones(flags, ctx, err); },
+    [this, &flags, &ctx](const ErrorStack &err) { return this->encodeScanLists(flags, ctx, err); },
+    [this, &flags, &ctx](const ErrorStack &err) { return this->encodeGPSSystems(flags, ctx, err); },
+    [this, &flags, &ctx](const ErrorStack &err) { return this->encodeDMREncryptionKeys(flags, ctx, err); }
+  };
+
+  return encodeTasks(tasks, flags, ctx, err);
 }
 
 bool
@@ -1627,18 +1606,15 @@ D868UVCodeplug::allocateChannels() {
 
 bool
 D868UVCodeplug::encodeChannels(const Flags &flags, Context &ctx, const ErrorStack &err) {
-  Q_UNUSED(flags); Q_UNUSED(err)
-
   // Encode channels
-  for (unsigned int i=0; i<ctx.count<Channel>(); i++) {
+  return encodeRange(ctx.count<Channel>(), flags, [this, &ctx](unsigned int i, const ErrorStack &err) {
+    Q_UNUSED(err)
     // enable channel
     uint16_t bank = i/Limit::channelsPerBank(), idx = i%Limit::channelsPerBank();
     ChannelElement ch(data(Offset::channelBanks() + bank * Offset::betweenChannelBanks()
                            + idx * ChannelElement::size()));
-    if (! ch.fromChannelObj(ctx.get<Channel>(i), ctx))
-      return false;
-  }
-  return true;
+    return ch.fromChannelObj(ctx.get<Channel>(i), ctx);
+  }, err);
 }
 
 bool
@@ -1717,20 +1693,24 @@ D868UVCodeplug::allocateContacts() {
 
 bool
 D868UVCodeplug::encodeContacts(const Flags &flags, Context &ctx, const ErrorStack &err) {
-  Q_UNUSED(flags); Q_UNUSED(err)
-
   QVector<DMRContact*> contacts;
-  // Encode contacts and also collect id<->index map
-  for (unsigned int i=0; i<ctx.count<DigitalContact>(); i++) {
+  for (unsigned int i=0; i<ctx.count<DigitalContact>(); i++)
+    contacts.append(ctx.get<DMRContact>(i));
+
+  // Encode contacts
+  bool ok = encodeRange(contacts.size(), flags, [this, &ctx, &contacts](unsigned int i, const ErrorStack &err) {
+    Q_UNUSED(err)
     uint32_t bank_addr = Offset::contactBanks() + (i/Limit::contactsPerBank())*Offset::betweenContactBanks();
     uint32_t addr = bank_addr + (i%Limit::contactsPerBank())*ContactElement::size();
     ContactElement con(data(addr));
-    DMRContact *contact = ctx.get<DMRContact>(i);
-    if(! con.fromContactObj(contact, ctx))
+    if(! con.fromContactObj(contacts[i], ctx))
       return false;
     ((uint32_t *)data(Offset::contactIndex()))[i] = qToLittleEndian(i);
-    contacts.append(contact);
-  }
+    return true;
+  }, err);
+  if (! ok)
+    return false;
+
   // encode index map for contacts
   std::sort(contacts.begin(), contacts.end(),
             [](DMRContact *a, DMRContact *b) {
@@ -31,9 +31,10 @@ public:
   /** Constructor, does not allocate any memory yet. */
   explicit D878UV2CallsignDB(QObject *parent=nullptr);
 
-  /** Tries to encode as many entries of the given user-database. */
-  bool encode(UserDatabase *db, const Flags &selection=Flags(),
-              const ErrorStack &err=ErrorStack());
+  using D868UVCallsignDB::encode;
+  unsigned int maxEntries() const;
+  /** Streams up to @c maxEntries() users into the given sink. */
+  bool encode(UserIterator &users, Sink &sink, const ErrorStack &err=ErrorStack());
 
 public:
   /** Some limits of the call-sign DB. */
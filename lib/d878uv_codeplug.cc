@@ -4032,16 +4032,13 @@ D878UVCodeplug::encodeElements(const Flags &flags, Context &ctx, const ErrorStac
   if (! D868UVCodeplug::encodeElements(flags, ctx, err))
     return false;
 
-  if (! this->encodeRoaming(flags, ctx, err))
-    return false;
-
-  if (! this->encodeAESKeys(flags, ctx, err))
-    return false;
-
-  if (! this->encodeARC4Keys(flags, ctx, err))
-    return false;
+  QVector<EncodeTask> tasks = {
+    [this, &flags, &ctx](const ErrorStack &err) { return this->encodeRoaming(flags, ctx, err); },
+    [this, &flags, &ctx](const ErrorStack &err) { return this->encodeAESKeys(flags, ctx, err); },
+    [this, &flags, &ctx](const ErrorStack &err) { return this->encodeARC4Keys(flags, ctx, err); }
+  };
 
-  return true;
+  return encodeTasks(tasks, flags, ctx, err);
 }
 
 
@@ -4100,9 +4097,9 @@ D878UVCodeplug::allocateChannels() {
 
 bool
 D878UVCodeplug::encodeChannels(const Flags &flags, Context &ctx, const ErrorStack &err) {
-  Q_UNUSED(flags); Q_UNUSED(err)
   // Encode channels
-  for (unsigned int i=0; i<ctx.count<Channel>(); i++) {
+  return encodeRange(ctx.count<Channel>(), flags, [this, &ctx](unsigned int i, const ErrorStack &err) {
+    Q_UNUSED(err)
     // enable channel
     uint16_t bank = i/Limit::channelsPerBank(), idx = i%Limit::channelsPerBank();
     uint32_t addr = Offset::channelBanks() + bank*Offset::betweenChannelBanks()
@@ -4112,8 +4109,8 @@ D878UVCodeplug::encodeChannels(const Flags &flags, Context &ctx, const ErrorStac
     ch.fromChannelObj(ctx.get<Channel>(i), ctx);
     ChannelExtensionElement ext(data(addr + Offset::toChannelExtension()));
     ext.fromChannelObj(ctx.get<Channel>(i), ctx);
-  }
-  return true;
+    return true;
+  }, err);
 }
 
 bool
@@ -1,5 +1,6 @@
 #include "dfufile.hh"
 #include <QFile>
+#include <QFileInfo>
 #include <QtEndian>
 
 #include "crc32.hh"
@@ -39,6 +40,17 @@ typedef struct __attribute((packed)) {
 } element_prefix_t;
 
 
+/* ********************************************************************************************* *
+ * Implementation of DFUFile::Mapping
+ * ********************************************************************************************* */
+struct DFUFile::Mapping {
+  QFile file;       ///< The mapped file, the mapping is released when the file gets destroyed.
+  const char *data; ///< Pointer to the mapped file content.
+  qint64 size;      ///< Size of the mapped file.
+  QString path;     ///< Canonical path of the mapped file.
+};
+
+
 /* ********************************************************************************************* *
  * Implementation of DFUFile
  * ********************************************************************************************* */
@@ -106,23 +118,32 @@ DFUFile::isAligned(unsigned blocksize) const {
 
 bool
 DFUFile::read(const QString &filename, const ErrorStack &err) {
-  QFile file(filename);
+  QSharedPointer<Mapping> mapping(new Mapping());
+  QFile &file = mapping->file;
+  file.setFileName(filename);
 
   if (! file.open(QIODevice::ReadOnly)) {
     errMsg(err) << "Cannot read DFU file '" << filename << "': " << file.errorString() << ".";
     return false;
   }
 
-  if (! read(file, err)) {
-    file.close();
-    return false;
-  }
+  // Try to map the file, the elements then reference the mapped data instead of copies.
+  mapping->size = file.size();
+  mapping->data = (0 < mapping->size) ? (const char *)file.map(0, mapping->size) : nullptr;
+  mapping->path = QFileInfo(file).canonicalFilePath();
+  if (nullptr == mapping->data)
+    logDebug() << "Cannot map DFU file '" << filename << "', read it instead.";
 
-  return true;
+  return read(file, (nullptr != mapping->data) ? mapping : QSharedPointer<Mapping>(), err);
+}
+
+bool
+DFUFile::read(QFile &file, const ErrorStack &err) {
+  return read(file, QSharedPointer<Mapping>(), err);
 }
 
 bool
-DFUFile::read(QFile &file, const ErrorStack &err)
+DFUFile::read(QFile &file, const QSharedPointer<Mapping> &mapping, const ErrorStack &err)
 {
   CRC32 crc;
 
@@ -149,7 +170,7 @@ DFUFile::read(QFile &file, const ErrorStack &err)
 
   for (uint8_t i=0; i<n_images; i++) {
     Image img; QString errorMessage;
-    if (! img.read(file, crc, errorMessage)) {
+    if (! img.read(file, crc, errorMessage, mapping)) {
       errMsg(err) << errorMessage;
       return false;
     }
@@ -190,6 +211,15 @@ DFUFile::read(QFile &file, const ErrorStack &err)
 
 bool
 DFUFile::write(const QString &filename, const ErrorStack &err) {
+  // Writing into a mapped file would truncate it underneath the elements referencing it.
+  QString path = QFileInfo(filename).canonicalFilePath();
+  if (! path.isEmpty()) {
+    for (int i=0; i<_images.size(); i++)
+      for (int j=0; j<_images[i].numElements(); j++)
+        if (path == _images[i].element(j).mappedFile())
+          _images[i].element(j).detach();
+  }
+
   QFile file(filename);
   if (! file.open(QIODevice::WriteOnly)) {
     errMsg(err) << "Cannot create DFU file '" << filename << "': " << file.errorString() << ".";
@@ -202,8 +232,15 @@ DFUFile::write(const QString &filename, const ErrorStack &err) {
   return res;
 }
 
+void
+DFUFile::detach() {
+  for (int i=0; i<_images.size(); i++)
+    for (int j=0; j<_images[i].numElements(); j++)
+      _images[i].element(j).detach();
+}
+
 bool
-DFUFile::write(QFile &file, const ErrorStack &err) {
+DFUFile::write(QFileDevice &file, const ErrorStack &err) {
   file_prefix_t prefix;
   memcpy(prefix.signature, "DfuSe", 5);
   prefix.version = 0x01;
@@ -294,7 +331,7 @@ DFUFile::Element::Element(uint32_t addr, uint32_t size)
 }
 
 DFUFile::Element::Element(const Element &other)
-  : _address(other._address), _data(other._data)
+  : _address(other._address), _data(other._data), _mapping(other._mapping)
 {
   // pass...
 }
@@ -303,6 +340,7 @@ DFUFile::Element &
 DFUFile::Element::operator=(const Element &other) {
   _address = other._address;
   _data = other._data;
+  _mapping = other._mapping;
   return *this;
 }
 
@@ -338,11 +376,33 @@ DFUFile::Element::data() const {
 
 QByteArray &
 DFUFile::Element::data() {
+  // Copy on write
+  detach();
   return _data;
 }
 
 bool
-DFUFile::Element::read(QFile &file, CRC32 &crc, QString &errorMessage)
+DFUFile::Element::isMapped() const {
+  return ! _mapping.isNull();
+}
+
+QString
+DFUFile::Element::mappedFile() const {
+  if (_mapping.isNull())
+    return QString();
+  return _mapping->path;
+}
+
+void
+DFUFile::Element::detach() {
+  if (_mapping.isNull())
+    return;
+  _data = QByteArray(_data.constData(), _data.size());
+  _mapping.reset();
+}
+
+bool
+DFUFile::Element::read(QFile &file, CRC32 &crc, QString &errorMessage, const QSharedPointer<Mapping> &mapping)
 {
   // Read Element prefix:
   element_prefix_t prefix;
@@ -357,7 +417,15 @@ DFUFile::Element::read(QFile &file, CRC32 &crc, QString &errorMessage)
   uint32_t size = qFromLittleEndian(prefix.size);
 
   _data.clear();
-  _data = file.read(size);
+  _mapping.reset();
+  if (mapping.isNull()) {
+    _data = file.read(size);
+  } else if ((file.pos() + size) <= mapping->size) {
+    // Reference the mapped data and skip it
+    _data = QByteArray::fromRawData(mapping->data + file.pos(), size);
+    _mapping = mapping;
+    file.seek(file.pos() + size);
+  }
 
   if (size != uint32_t(_data.size())) {
     errorMessage = tr("Cannot read DFU file '%1': Cannot read element data: %2").arg(file.fileName()).arg(file.errorString());
@@ -370,7 +438,7 @@ DFUFile::Element::read(QFile &file, CRC32 &crc, QString &errorMessage)
 }
 
 bool
-DFUFile::Element::write(QFile &file, CRC32 &crc, QString &errorMessage) const {
+DFUFile::Element::write(QFileDevice &file, CRC32 &crc, QString &errorMessage) const {
   element_prefix_t prefix;
   prefix.address = qToLittleEndian(_address);
   prefix.size = qToLittleEndian(uint32_t(_data.size()));
@@ -541,7 +609,7 @@ DFUFile::Image::addElement(uint32_t addr, uint32_t size, int index) {
 void
 DFUFile::Image::addElement(const Element &element) {
   _elements.append(element);
-  _addressmap.add(element.address(), element.size());
+  _addressmap.add(element.address(), element.memSize());
 }
 
 void
@@ -570,7 +638,7 @@ DFUFile::Image::end() {
 
 
 bool
-DFUFile::Image::read(QFile &file, CRC32 &crc, QString &errorMessage)
+DFUFile::Image::read(QFile &file, CRC32 &crc, QString &errorMessage, const QSharedPointer<Mapping> &mapping)
 {
   image_prefix_t prefix;
   if (sizeof(image_prefix_t) != file.read((char *)&prefix, sizeof(image_prefix_t))) {
@@ -596,7 +664,7 @@ DFUFile::Image::read(QFile &file, CRC32 &crc, QString &errorMessage)
   uint32_t n_elements = qFromLittleEndian(prefix.n_elements);
   for (uint32_t i=0; i<n_elements; i++) {
     Element element;
-    if (! element.read(file, crc, errorMessage))
+    if (! element.read(file, crc, errorMessage, mapping))
       return false;
     this->addElement(element);
   }
@@ -611,7 +679,7 @@ DFUFile::Image::read(QFile &file, CRC32 &crc, QString &errorMessage)
 }
 
 bool
-DFUFile::Image::write(QFile &file, CRC32 &crc, QString &errorMessage) const {
+DFUFile::Image::write(QFileDevice &file, CRC32 &crc, QString &errorMessage) const {
   image_prefix_t prefix;
   memcpy(prefix.signature, "Target", 6);
   prefix.alternate_setting = _alternate_settings;
@@ -648,7 +716,17 @@ DFUFile::Image::sort() {
   // Rebuild address map
   _addressmap.clear();
   for (int i=0; i<_elements.size(); i++)
-    _addressmap.add(_elements[i].address(), _elements.size());
+    _addressmap.add(_elements[i].address(), _elements[i].memSize());
+}
+
+bool
+DFUFile::Image::hasFlatAddressMap() const {
+  return _addressmap.isFlat();
+}
+
+void
+DFUFile::Image::setFlatAddressMap(bool enable) {
+  _addressmap.setFlat(enable);
 }
 
 void
@@ -692,3 +770,137 @@ DFUFile::Image::data(uint32_t offset) const {
   return (unsigned char *)(element(idx).data().data()+
                            (offset-element(idx).address()));
 }
+
+
+/* ********************************************************************************************* *
+ * Implementation of DFUFile::StreamWriter
+ * ********************************************************************************************* */
+DFUFile::StreamWriter::StreamWriter(const QString &filename, const QString &imageName, uint8_t altSettings)
+  : _file(filename), _imageName(imageName), _alternateSettings(altSettings), _numElements(0)
+{
+  // pass...
+}
+
+DFUFile::StreamWriter::~StreamWriter() {
+  if (_file.isOpen())
+    close();
+}
+
+bool
+DFUFile::StreamWriter::open(const ErrorStack &err) {
+  // Need read access to compute the CRC on close.
+  if (! _file.open(QIODevice::ReadWrite | QIODevice::Truncate)) {
+    errMsg(err) << "Cannot create DFU file '" << _file.fileName() << "': "
+                << _file.errorString() << ".";
+    return false;
+  }
+
+  // Write place-holders for the file and image prefix, they get fixed on close.
+  _numElements = 0;
+  QByteArray placeholder(sizeof(file_prefix_t)+sizeof(image_prefix_t), 0x00);
+  if (placeholder.size() != _file.write(placeholder)) {
+    errMsg(err) << "Cannot write DFU prefix to '" << _file.fileName()
+                << "': " << _file.errorString() << ".";
+    _file.close();
+    return false;
+  }
+
+  return true;
+}
+
+bool
+DFUFile::StreamWriter::isOpen() const {
+  return _file.isOpen();
+}
+
+bool
+DFUFile::StreamWriter::write(uint32_t address, const QByteArray &data, const ErrorStack &err) {
+  if (! _file.isOpen()) {
+    errMsg(err) << "Cannot write element to DFU file '" << _file.fileName() << "': Not open.";
+    return false;
+  }
+
+  element_prefix_t prefix;
+  prefix.address = qToLittleEndian(address);
+  prefix.size = qToLittleEndian(uint32_t(data.size()));
+  if ((sizeof(element_prefix_t) != _file.write((const char *)&prefix, sizeof(element_prefix_t)))
+      || (data.size() != _file.write(data))) {
+    errMsg(err) << "Cannot write element to DFU file '" << _file.fileName()
+                << "': " << _file.errorString() << ".";
+    return false;
+  }
+
+  _numElements++;
+  return true;
+}
+
+bool
+DFUFile::StreamWriter::close(const ErrorStack &err) {
+  if (! _file.isOpen())
+    return true;
+
+  uint32_t fileSize = _file.pos();
+
+  file_prefix_t prefix;
+  memcpy(prefix.signature, "DfuSe", 5);
+  prefix.version = 0x01;
+  prefix.image_size = qToLittleEndian(fileSize);
+  prefix.n_targets = 1;
+
+  image_prefix_t imgPrefix;
+  memcpy(imgPrefix.signature, "Target", 6);
+  imgPrefix.alternate_setting = _alternateSettings;
+  imgPrefix.is_named = qToLittleEndian(uint32_t(_imageName.isEmpty() ? 0 : 1));
+  memset(imgPrefix.name, 0, 255);
+  if (! _imageName.isEmpty())
+    memcpy(imgPrefix.name, _imageName.toLocal8Bit().constData(),
+           std::min(qsizetype(255), _imageName.size()));
+  imgPrefix.size = qToLittleEndian(uint32_t(fileSize-sizeof(file_prefix_t)-sizeof(image_prefix_t)));
+  imgPrefix.n_elements = qToLittleEndian(_numElements);
+
+  // Fix prefixes
+  if ((! _file.seek(0))
+      || (sizeof(file_prefix_t) != _file.write((char *)&prefix, sizeof(file_prefix_t)))
+      || (sizeof(image_prefix_t) != _file.write((char *)&imgPrefix, sizeof(image_prefix_t)))) {
+    errMsg(err) << "Cannot update DFU prefix in '" << _file.fileName()
+                << "': " << _file.errorString() << ".";
+    _file.close();
+    return false;
+  }
+
+  // Compute CRC over the complete file, chunk by chunk
+  CRC32 crc;
+  _file.seek(0);
+  while (_file.pos() < fileSize) {
+    QByteArray chunk = _file.read(std::min(qint64(0x10000), qint64(fileSize)-_file.pos()));
+    if (chunk.isEmpty()) {
+      errMsg(err) << "Cannot read back DFU file '" << _file.fileName()
+                  << "': " << _file.errorString() << ".";
+      _file.close();
+      return false;
+    }
+    crc.update(chunk);
+  }
+
+  file_suffix_t suffix;
+  suffix.device_id = qToLittleEndian((uint16_t)0xffff);
+  suffix.product_id = qToLittleEndian((uint16_t)0xffff);
+  suffix.vendor_id = qToLittleEndian((uint16_t)0xffff);
+  suffix.DFUlo = 0x1a;
+  suffix.DFUhi = 0x01;
+  memcpy(suffix.signature, "UFD", 3);
+  suffix.size = 16;
+
+  crc.update((uint8_t *) &suffix, sizeof(file_suffix_t)-4);
+  suffix.crc = qToLittleEndian(crc.get());
+
+  if (sizeof(file_suffix_t) != _file.write((char *)&suffix, sizeof(file_suffix_t))) {
+    errMsg(err) << "Cannot write DFU suffix to '" << _file.fileName()
+                << "': " << _file.errorString() << ".";
+    _file.close();
+    return false;
+  }
+
+  _file.close();
+  return true;
+}
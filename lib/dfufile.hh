@@ -6,6 +6,7 @@
 #include <QByteArray>
 #include <QString>
 #include <QTextStream>
+#include <QSharedPointer>
 
 #include "addressmap.hh"
 #include "errorstack.hh"
@@ -73,8 +74,17 @@ class DFUFile: public QObject
 {
 	Q_OBJECT
 
+protected:
+  /** A read-only memory map of a DFU file, shared by all elements referencing it. */
+  struct Mapping;
+
 public:
-  /** Represents a single element within a @c Image. */
+  /** Represents a single element within a @c Image.
+   *
+   * Elements read from a file may reference the memory-mapped file instead of holding a copy of
+   * their data. The data is copied as soon as the element gets modified, that is, on any
+   * non-const access to the data (copy-on-write). Hence, copies of the data obtained through the
+   * const accessor must not outlive the element. */
   class Element {
   public:
     /** Empty constructor. */
@@ -98,13 +108,25 @@ public:
     bool isAligned(unsigned blocksize) const;
     /** Returns a reference to the data. */
     const QByteArray &data() const;
-    /** Returns a reference to the data. */
+    /** Returns a reference to the data. If the element references a memory-mapped file, the data
+     * gets copied first. */
     QByteArray &data();
 
-    /** Reads an element from the given file and updates the CRC. */
-    bool read(QFile &file, CRC32 &crc, QString &errorMessage);
+    /** Returns @c true if the element references a memory-mapped file. */
+    bool isMapped() const;
+    /** Returns the canonical path of the memory-mapped file, the element references. Returns an
+     * empty string if the element is not mapped. */
+    QString mappedFile() const;
+    /** Copies the data of a memory-mapped element, such that it does not reference the file
+     * anymore. */
+    void detach();
+
+    /** Reads an element from the given file and updates the CRC. If a mapping of the file is
+     * given, the element references the mapped data instead of reading it. */
+    bool read(QFile &file, CRC32 &crc, QString &errorMessage,
+              const QSharedPointer<Mapping> &mapping=QSharedPointer<Mapping>());
     /** Writes an element to the given file and updates the CRC. */
-    bool write(QFile &file, CRC32 &crc, QString &errorMessage) const;
+    bool write(QFileDevice &file, CRC32 &crc, QString &errorMessage) const;
 
     /** Dumps a textual representation of the element. */
     void dump(QTextStream &stream) const;
@@ -114,6 +136,8 @@ public:
     uint32_t _address;
     /** The data of the element. */
     QByteArray _data;
+    /** The memory-mapped file, the data references. @c nullptr if the data is owned. */
+    QSharedPointer<Mapping> _mapping;
   };
 
   /** Represents a single image within a @c DFUFile. */
@@ -172,10 +196,12 @@ public:
     /** Returns a pointer after the last element. */
     iterator end();
 
-    /** Reads an image from the given file and updates the CRC. */
-    bool read(QFile &file, CRC32 &crc, QString &errorMessage);
+    /** Reads an image from the given file and updates the CRC. If a mapping of the file is given,
+     * the elements reference the mapped data instead of reading it. */
+    bool read(QFile &file, CRC32 &crc, QString &errorMessage,
+              const QSharedPointer<Mapping> &mapping=QSharedPointer<Mapping>());
     /** Writes this image to the given file and updates the CRC. */
-    bool write(QFile &file, CRC32 &crc, QString &errorMessage) const;
+    bool write(QFileDevice &file, CRC32 &crc, QString &errorMessage) const;
 
     /** Prints a textual representation of the image into the given stream. */
     void dump(QTextStream &stream) const;
@@ -191,6 +217,14 @@ public:
     /** Sorts all elements with respect to their addresses. */
     void sort();
 
+    /** Returns @c true if the flat address map is enabled. */
+    bool hasFlatAddressMap() const;
+    /** Enables or disables the flat address map.
+     * If enabled, addresses are resolved by a page-table lookup in constant time instead of a
+     * binary search. This speeds up the access to images consisting of many elements at the
+     * expense of some memory. */
+    void setFlatAddressMap(bool enable);
+
   protected:
     /** Alternate settings byte. */
     uint8_t  _alternate_settings;
@@ -202,6 +236,39 @@ public:
     AddressMap _addressmap;
   };
 
+  /** Writes a DFU file consisting of a single image, element by element.
+   *
+   * In contrast to @c DFUFile::write, the image is never held in memory completely. This allows
+   * to write large images (e.g., call-sign DBs) with memory usage proportional to a single
+   * element. The sizes and the CRC are fixed-up when the file gets closed. */
+  class StreamWriter
+  {
+  public:
+    /** Constructs a writer for the given file and image name. */
+    StreamWriter(const QString &filename, const QString &imageName, uint8_t altSettings=1);
+    /** Destructor, closes the file if still open. */
+    virtual ~StreamWriter();
+
+    /** Creates the file and writes the headers. */
+    bool open(const ErrorStack &err=ErrorStack());
+    /** Returns @c true if the file is open. */
+    bool isOpen() const;
+    /** Appends an element with the given address and data to the image. */
+    bool write(uint32_t address, const QByteArray &data, const ErrorStack &err=ErrorStack());
+    /** Fixes the headers, appends the suffix and closes the file. */
+    bool close(const ErrorStack &err=ErrorStack());
+
+  protected:
+    /** The output file. */
+    QFile _file;
+    /** The name of the image. */
+    QString _imageName;
+    /** The alternate settings byte of the image. */
+    uint8_t _alternateSettings;
+    /** The number of elements written so far. */
+    uint32_t _numElements;
+  };
+
 public:
   /** Constructs an empty DFU file object. */
 	DFUFile(QObject *parent=nullptr);
@@ -228,6 +295,8 @@ public:
   bool isAligned(unsigned blocksize) const;
 
   /** Reads the specified DFU file.
+   * The file gets memory-mapped if possible. The elements then reference the mapped file until
+   * they are modified.
    * @return @c false on error. */
   bool read(const QString &filename, const ErrorStack &err=ErrorStack());
   /** Reads the specified DFU file.
@@ -237,9 +306,12 @@ public:
   /** Writes to the specified file.
    * @returns @c false on error. */
   bool write(const QString &filename, const ErrorStack &err=ErrorStack());
+  /** Copies the data of all elements referencing a memory-mapped file. Must be called before the
+   * file gets modified or removed. */
+  void detach();
   /** Writes to the specified file.
    * @returns @c false on error. */
-  bool write(QFile &file, const ErrorStack &err=ErrorStack());
+  bool write(QFileDevice &file, const ErrorStack &err=ErrorStack());
 
   /** Dumps a text representation of the DFU file structure to the specified text stream. */
 	void dump(QTextStream &stream) const;
@@ -252,6 +324,10 @@ public:
   /** Returns a const pointer to the encoded raw data at the specified offset. */
   virtual const unsigned char *data(uint32_t offset, uint32_t img=0) const;
 
+protected:
+  /** Reads the DFU file, the elements reference the given mapping of the file, if set. */
+  bool read(QFile &file, const QSharedPointer<Mapping> &mapping, const ErrorStack &err);
+
 protected:
   /// The list of images.
 	QVector<Image> _images;
@@ -2,6 +2,12 @@
 #include "dm32uv_limits.hh"
 #include "dm32uv_interface.hh"
 #include "logger.hh"
+#include "crc32.hh"
+#include <QSerialPortInfo>
+#include <QStandardPaths>
+#include <QDir>
+#include <QFileInfo>
+#include <QTextStream>
 
 
 /* ********************************************************************************************* *
@@ -46,6 +52,56 @@ DM32UV::AddressMap::toVirtual(uint32_t phys) const {
   return (_toVirtual[phys>>12]<<12) | offset;
 }
 
+bool
+DM32UV::AddressMap::isEmpty() const {
+  return _toVirtual.isEmpty();
+}
+
+bool
+DM32UV::AddressMap::load(const QString &filename, const ErrorStack &err) {
+  QFile file(filename);
+  if (! file.open(QIODevice::ReadOnly)) {
+    errMsg(err) << "Cannot open address map '" << filename << "': " << file.errorString();
+    return false;
+  }
+
+  _toVirtual.clear(); _toPhysical.clear();
+  QTextStream stream(&file);
+  while (! stream.atEnd()) {
+    QStringList pair = stream.readLine().simplified().split(' ', Qt::SkipEmptyParts);
+    if (pair.isEmpty())
+      continue;
+    bool okPhys = false, okVirt = false;
+    uint32_t phys = (2 == pair.size()) ? pair.at(0).toUInt(&okPhys, 16) : 0;
+    uint32_t virt = (2 == pair.size()) ? pair.at(1).toUInt(&okVirt, 16) : 0;
+    if ((! okPhys) || (! okVirt)) {
+      errMsg(err) << "Malformed address map '" << filename << "'.";
+      _toVirtual.clear(); _toPhysical.clear();
+      return false;
+    }
+    map(phys, virt);
+  }
+
+  return ! isEmpty();
+}
+
+bool
+DM32UV::AddressMap::save(const QString &filename, const ErrorStack &err) const {
+  QFile file(filename);
+  if (! file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+    errMsg(err) << "Cannot write address map '" << filename << "': " << file.errorString();
+    return false;
+  }
+
+  QTextStream stream(&file);
+  for (auto it=_toVirtual.constBegin(); it!=_toVirtual.constEnd(); it++)
+    stream << QString("%1 %2\n").arg(it.key()<<12, 8, 16, QChar('0')).arg(it.value()<<12, 8, 16, QChar('0'));
+  stream.flush();
+  file.close();
+
+  return true;
+}
+
 
 
 /* ********************************************************************************************* *
@@ -56,7 +112,8 @@ RadioLimits *DM32UV::_limits = nullptr;
 DM32UV::DM32UV(DM32UVInterface *dev, QObject *parent)
   : Radio{parent}, _dev(dev), _radioName("Baofeng DM-32UV"), _codeplug()
 {
-  // pass...
+  if (_dev)
+    _dev->setStats(&_stats);
 }
 
 DM32UV::~DM32UV() {
@@ -96,6 +153,16 @@ DM32UV::codeplug() {
   return _codeplug;
 }
 
+const CallsignDB *
+DM32UV::callsignDB() const {
+  return &_callsigns;
+}
+
+CallsignDB *
+DM32UV::callsignDB() {
+  return &_callsigns;
+}
+
 
 bool
 DM32UV::startDownload(const TransferFlags &flags, const ErrorStack &err) {
@@ -178,6 +245,8 @@ DM32UV::startUploadSatelliteConfig(SatelliteDatabase *db, const TransferFlags &f
 
 void
 DM32UV::run() {
+  TransferStats::Session session(_stats);
+
   if (StatusDownload == _task) {
     if ((nullptr==_dev) || (! _dev->isOpen())) {
       emit downloadError(this);
@@ -252,9 +321,25 @@ DM32UV::run() {
 
 bool
 DM32UV::download(const ErrorStack &err) {
-  // First, we need to get the codeplug address map
   DM32UV::AddressMap addressMap;
-  if (! _dev->getAddressMap(addressMap, err)) {
+  if (! readCodeplug(addressMap, false, true, err))
+    return false;
+
+  if (! _dev->read_finish(err)) {
+    errMsg(err) << "Cannot finish codeplug download.";
+    return false;
+  }
+
+  return true;
+}
+
+
+bool
+DM32UV::readCodeplug(AddressMap &addressMap, bool upload, bool useCache, const ErrorStack &err) {
+  // First, we need to get the codeplug address map. Try the one cached from the last transfer.
+  _stats.beginPhase("map");
+  bool cached = useCache && loadAddressMap(addressMap);
+  if ((! cached) && (! _dev->getAddressMap(addressMap, err))) {
     errMsg(err) << "Cannot read codeplug from device: Cannot get address map.";
     return false;
   }
@@ -266,6 +351,7 @@ DM32UV::download(const ErrorStack &err) {
       _codeplug.image(0).addElement(virtualBlockAddress, Offset::blockSize());
   }
 
+  _stats.beginPhase("read");
   if (! _dev->read_start(0, 0, err)) {
     errMsg(err) << "Cannot start reading codeplug.";
     return false;
@@ -274,63 +360,106 @@ DM32UV::download(const ErrorStack &err) {
   // Read all allocated memory regions (sorted by physical address).
   uint32_t blockCount = 0;
   foreach (uint32_t physicalBlockAddress, addressMap.mappedPhysical()) {
-    auto progress = (100*++blockCount)/addressMap.mappedPhysical().count();
-    emit downloadProgress(progress);
+    blockCount++;
+    if (upload)
+      emit uploadProgress((50*blockCount)/addressMap.mappedPhysical().count());
+    else
+      emit downloadProgress((100*blockCount)/addressMap.mappedPhysical().count());
     uint32_t virtualBlockAddress = addressMap.toVirtual(physicalBlockAddress);
     if (! codeplugMemoryRange.contains(virtualBlockAddress))
       continue;
-    if (! _dev->read(0, physicalBlockAddress, _codeplug.data(virtualBlockAddress), Offset::blockSize())) {
+    uint8_t *block = _codeplug.data(virtualBlockAddress);
+    if (! _dev->read(0, physicalBlockAddress, block, Offset::blockSize())) {
       errMsg(err) << "Cannot read codeplug block from "
                   << Qt::hex << physicalBlockAddress << "h (virt. "
                   << Qt::hex << virtualBlockAddress << "h).";
       return false;
     }
+    // The last byte of every block holds its virtual address prefix. Hence, the mapped pages of
+    // the cached map get validated while reading. Some unmapped ones were probed when loading it.
+    if (cached && (block[Offset::blockSize()-1] != (virtualBlockAddress>>12))) {
+      logWarn() << "Cached address map of " << name() << " is outdated at "
+                << Qt::hex << physicalBlockAddress << "h, rescan.";
+      clearAddressMapCache();
+      while (_codeplug.image(0).numElements())
+        _codeplug.image(0).remElement(0);
+      addressMap = AddressMap();
+      return readCodeplug(addressMap, upload, false, err);
+    }
   }
 
-  if (! _dev->read_finish(err)) {
-    errMsg(err) << "Cannot finish codeplug download.";
-    return false;
-  }
+  // Keep the validated map for the next transfer
+  if (! cached)
+    storeAddressMap(addressMap);
 
   return true;
 }
 
 
+QString
+DM32UV::addressMapCacheFile() const {
+  // Several radios may be connected at once, each one has its own map.
+  QSerialPortInfo port(*_dev);
+  CRC32 device; device.update(QString("%1@%2").arg(port.serialNumber(), port.systemLocation()).toUtf8());
+  QDir dir(QStandardPaths::writableLocation(QStandardPaths::CacheLocation));
+  return dir.absoluteFilePath(
+        QString("dm32uv-%1-%2-%3-%4.map")
+        .arg(QString::fromLatin1(_dev->firmwareVersion()))
+        .arg(_dev->codeplugMemory().first, 8, 16, QChar('0'))
+        .arg(_dev->codeplugMemory().second, 8, 16, QChar('0'))
+        .arg(device.get(), 8, 16, QChar('0')));
+}
+
 bool
-DM32UV::upload(const ErrorStack &err) {
-  // First, we need to get the codeplug address map
-  DM32UV::AddressMap addressMap;
-  if (! _dev->getAddressMap(addressMap, err)) {
-    errMsg(err) << "Cannot read codeplug from device: Cannot get address map.";
+DM32UV::loadAddressMap(AddressMap &addressMap) {
+  QString filename = addressMapCacheFile();
+  if (! QFileInfo::exists(filename))
     return false;
-  }
 
-  // Allocate all mapped memory regions:
-  static Range<unsigned int> codeplugMemoryRange = {0x3000, 0x68000};
-  foreach (uint32_t virtualBlockAddress, addressMap.mappedVirtual()) {
-    if (codeplugMemoryRange.contains(virtualBlockAddress))
-      _codeplug.image(0).addElement(virtualBlockAddress, Offset::blockSize());
+  ErrorStack loadErr;
+  if (! addressMap.load(filename, loadErr)) {
+    logWarn() << "Cannot load cached address map: " << loadErr.format();
+    addressMap = AddressMap();
+    return false;
   }
 
-  if (! _dev->read_start(0, 0, err)) {
-    errMsg(err) << "Cannot start reading codeplug.";
+  ErrorStack probeErr;
+  if (! _dev->verifyAddressMap(addressMap, ADDRESS_MAP_SAMPLES, probeErr)) {
+    if (! probeErr.isEmpty())
+      logWarn() << "Cannot verify cached address map: " << probeErr.format();
+    else
+      logDebug() << "Cached address map of " << name() << " does not match, rescan.";
+    clearAddressMapCache();
+    addressMap = AddressMap();
     return false;
   }
 
-  // Read all allocated memory regions (sorted by physical address).
-  uint32_t blockCount = 0;
-  foreach (uint32_t physicalBlockAddress, addressMap.mappedPhysical()) {
-    emit uploadProgress((50*++blockCount)/addressMap.mappedPhysical().count());
-    uint32_t virtualBlockAddress = addressMap.toVirtual(physicalBlockAddress);
-    if (! codeplugMemoryRange.contains(virtualBlockAddress))
-      continue;
-    if (! _dev->read(0, physicalBlockAddress, _codeplug.data(virtualBlockAddress), Offset::blockSize())) {
-      errMsg(err) << "Cannot read codeplug block from "
-                  << Qt::hex << physicalBlockAddress << "h (virt. "
-                  << Qt::hex << virtualBlockAddress << "h).";
-      return false;
-    }
+  logDebug() << "Use cached address map '" << filename << "'.";
+  return true;
+}
+
+void
+DM32UV::storeAddressMap(const AddressMap &addressMap) {
+  QString filename = addressMapCacheFile();
+  QDir dir = QFileInfo(filename).absoluteDir();
+  ErrorStack err;
+  if (((! dir.exists()) && (! dir.mkpath("."))) || (! addressMap.save(filename, err))) {
+    logWarn() << "Cannot store address map of " << name() << " in '" << filename << "': "
+              << err.format();
   }
+}
+
+void
+DM32UV::clearAddressMapCache() {
+  QFile::remove(addressMapCacheFile());
+}
+
+
+bool
+DM32UV::upload(const ErrorStack &err) {
+  DM32UV::AddressMap addressMap;
+  if (! readCodeplug(addressMap, true, true, err))
+    return false;
 
   if (! _dev->read_finish(err)) {
     errMsg(err) << "Cannot finish codeplug read.";
@@ -339,16 +468,26 @@ DM32UV::upload(const ErrorStack &err) {
 
   // Now, encode codeplug in physical address space, may override large portions and may also add
   // new portions to the codeplug.
+  _stats.beginPhase("encode");
   if (! _codeplug.encode(_config, _codeplugFlags, err)) {
     errMsg(err) << "Cannot encode codeplug from config.";
     return false;
   }
 
+  _stats.beginPhase("write");
   if (! _dev->write_start(0,0,err)) {
     errMsg(err) << "Cannot start codeplug write´.";
     return false;
   }
 
+  // The radio allocates pages for new blocks itself, hence the cached map becomes outdated.
+  for (int blk=0; blk<_codeplug.image(0).numElements(); blk++) {
+    if (! addressMap.virtualIsMapped(_codeplug.image(0).element(blk).address())) {
+      clearAddressMapCache();
+      break;
+    }
+  }
+
   // Now mark all blocks with their virtual address
   // and write them to the associated pyhsical address or to 0xff000 if not yet allocated.
   for (unsigned int blk=0; blk<(unsigned int)_codeplug.image(0).numElements(); blk++) {
@@ -377,6 +516,7 @@ DM32UV::upload(const ErrorStack &err) {
 
 bool
 DM32UV::uploadCallsigns(const ErrorStack &err) {
+  _stats.beginPhase("write");
   if (! _dev->write_start(0,0,err)) {
     errMsg(err) << "Cannot start codeplug write´.";
     return false;
@@ -47,6 +47,14 @@ public:
      * @c std::numeric_limits<uint32_t>::max() gets returned. */
     uint32_t toPhysical(uint32_t virt) const;
 
+    /** Returns @c true, if nothing is mapped. */
+    bool isEmpty() const;
+
+    /** Reads the map from the given file, written by @c save. */
+    bool load(const QString &filename, const ErrorStack &err=ErrorStack());
+    /** Writes the map into the given file. */
+    bool save(const QString &filename, const ErrorStack &err=ErrorStack()) const;
+
     /** Returns the map from physical to virtual addresses, sorted by physical addresses. */
     inline QList<uint32_t> mappedPhysical() const {
       QList<uint32_t> addrs;
@@ -88,6 +96,8 @@ public:
 
   const Codeplug &codeplug() const override;
   Codeplug &codeplug() override;
+  const CallsignDB *callsignDB() const override;
+  CallsignDB *callsignDB() override;
 
   bool startDownload(const TransferFlags &flags, const ErrorStack &err=ErrorStack()) override;
   bool startUpload(Config *config, const Codeplug::Flags &flags, const ErrorStack &err) override;
@@ -111,6 +121,27 @@ private:
   virtual bool upload(const ErrorStack &err=ErrorStack());
   virtual bool uploadCallsigns(const ErrorStack &err=ErrorStack());
 
+  /** Obtains the address map and reads all mapped blocks of the codeplug. If @c useCache is set,
+   * the address map cached from the last transfer is used, if it still matches the device. */
+  bool readCodeplug(AddressMap &addressMap, bool upload, bool useCache, const ErrorStack &err);
+
+  /** Returns the file name of the cached address map of the connected radio. The radio is
+   * identified by its firmware, memory layout, the serial number of its USB interface and the port
+   * it is connected to. */
+  QString addressMapCacheFile() const;
+  /** Loads the cached address map and verifies it against the device.
+   * @returns @c false if there is no cached map or if it does not match the device. */
+  bool loadAddressMap(AddressMap &addressMap);
+  /** Stores the address map in the cache. */
+  void storeAddressMap(const AddressMap &addressMap);
+  /** Removes the cached address map. */
+  void clearAddressMapCache();
+
+protected:
+  /** Number of mapped and of unmapped pages probed to verify a cached address map. Mapped pages
+   * are checked completely while reading. */
+  static const unsigned int ADDRESS_MAP_SAMPLES = 8;
+
 protected:
   /** Thread main routine, performs all blocking IO operations for codeplug up- and download. */
   void run() override;
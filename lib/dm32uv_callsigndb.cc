@@ -131,12 +131,12 @@ bool
 DM32UVCallsignDB::EntryElement::encode(const UserDatabase::User &user, const ErrorStack &err) {
   Q_UNUSED(err);
 
-  setName(user.name);
-  setCallsign(user.call);
-  setId(user.id);
-  setCity(user.city);
-  setCountry(user.country);
-  setRemark(user.comment);
+  setName(user.name());
+  setCallsign(user.call());
+  setId(user.id());
+  setCity(user.city());
+  setCountry(user.country());
+  setRemark(user.comment());
 
   return true;
 }
@@ -152,6 +152,11 @@ DM32UVCallsignDB::DM32UVCallsignDB(QObject *parent)
   addImage("Call-sign DB for Baofeng DM-32UV");
 }
 
+unsigned int
+DM32UVCallsignDB::maxEntries() const {
+  return Limit::entries();
+}
+
 bool
 DM32UVCallsignDB::encode(UserDatabase *db, const Flags &selection, const ErrorStack &err) {
   // Limit number of entries.
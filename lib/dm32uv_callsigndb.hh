@@ -121,6 +121,7 @@ public:
   explicit DM32UVCallsignDB(QObject *parent = nullptr);
 
   bool encode(UserDatabase *db, const Flags &selection,const ErrorStack &err=ErrorStack());
+  unsigned int maxEntries() const;
 
 public:
   /** Some limits for the DB. */
@@ -330,18 +330,12 @@ DM32UVInterface::getAddressMap(DM32UV::AddressMap &map, const ErrorStack &err, v
   _state = State::Program;
   logDebug() << "Enter PROG mode.";
 
-  // Map entire codeplug memory region
+  // Map entire codeplug memory region. The requests are sent back-to-back, each one as soon as
+  // the previous response arrived.
   for (uint32_t addr=_codeplugMemory.first; addr<_codeplugMemory.second; addr += 0x1000) {
-    QThread::msleep(100);
-    ReadRequest mapReq(addr+0xfff, 1);
-    ReadResponse mapRes;
-    if (! sendReceive(mapReq, mapRes, err)) {
-      errMsg(err) << "Cannot request codeplug memory map at address "
-                  << Qt::hex << (addr+0xfff) << "h.";
+    uint8_t prefix = 0;
+    if (! readPagePrefix(addr, prefix, err))
       return false;
-    }
-    // Unpack prefix
-    uint8_t prefix = (uint8_t)mapRes.payload()[0];
     // If prefix is invalid -> do not map
     if ((0x00 == prefix) || (0xff == prefix))
       continue;
@@ -357,6 +351,84 @@ DM32UVInterface::getAddressMap(DM32UV::AddressMap &map, const ErrorStack &err, v
 }
 
 
+bool
+DM32UVInterface::verifyAddressMap(const DM32UV::AddressMap &map, unsigned int samples, const ErrorStack &err) {
+  // If not yet in program mode -> enter
+  if ((State::Program != _state) && (! enter_program_mode(err))) {
+    errMsg(err) << "Cannot enter program mode.";
+    _state = State::Error;
+    return false;
+  }
+  _state = State::Program;
+
+  // Collect mapped and unmapped pages
+  QList<uint32_t> mapped, unmapped;
+  for (uint32_t addr=_codeplugMemory.first; addr<_codeplugMemory.second; addr += 0x1000) {
+    if (map.physicalIsMapped(addr))
+      mapped.append(addr);
+    else
+      unmapped.append(addr);
+  }
+  if (mapped.isEmpty())
+    return false;
+
+  // Probe a fixed number of evenly spaced mapped and unmapped pages, including the first and last
+  // one of each. This keeps the verification cheap, independent of the memory size. Any mismatch
+  // lets the caller obtain the complete map again.
+  QList<uint32_t> probes;
+  auto sample = [&probes, samples](const QList<uint32_t> &pages) {
+    unsigned int n = std::min((unsigned int)pages.size(), std::max(2U, samples));
+    for (unsigned int i=0; i<n; i++)
+      probes.append(pages.at((i*(pages.size()-1))/std::max(1U, n-1)));
+  };
+  sample(mapped);
+  sample(unmapped);
+
+  foreach (uint32_t addr, probes) {
+    uint8_t prefix = 0;
+    if (! readPagePrefix(addr, prefix, err))
+      return false;
+    bool valid = (0x00 != prefix) && (0xff != prefix);
+    if (valid != map.physicalIsMapped(addr)) {
+      logDebug() << "Address map mismatch at " << Qt::hex << addr << "h: page "
+                 << (valid ? "is" : "is not") << " mapped.";
+      return false;
+    }
+    if (valid && (map.toVirtual(addr) != (((uint32_t)prefix) << 12))) {
+      logDebug() << "Address map mismatch at " << Qt::hex << addr << "h: expected "
+                 << map.toVirtual(addr) << "h, got " << (((uint32_t)prefix) << 12) << "h.";
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
+const QByteArray &
+DM32UVInterface::firmwareVersion() const {
+  return _firmwareVersion;
+}
+
+const QPair<uint32_t, uint32_t> &
+DM32UVInterface::codeplugMemory() const {
+  return _codeplugMemory;
+}
+
+
+bool
+DM32UVInterface::readPagePrefix(uint32_t addr, uint8_t &prefix, const ErrorStack &err) {
+  ReadRequest mapReq(addr+0xfff, 1);
+  ReadResponse mapRes;
+  if (! sendReceive(mapReq, mapRes, err)) {
+    errMsg(err) << "Cannot request codeplug memory map at address "
+                << Qt::hex << (addr+0xfff) << "h.";
+    return false;
+  }
+  prefix = (uint8_t)mapRes.payload()[0];
+  return true;
+}
+
 
 bool
 DM32UVInterface::read_start(uint32_t bank, uint32_t address, const ErrorStack &err) {
@@ -381,6 +453,7 @@ DM32UVInterface::read(uint32_t bank, uint32_t address, uint8_t *data, int nbytes
   // align read with 1000h blocks
   if (address & 0xfff) {
     int n = std::min(nbytes, (int)(0x1000 - (address & 0xfff)));
+    TransferStats::Request request(_stats, TransferStats::Direction::Read, n);
     ReadRequest req(address, n);
     ReadResponse res;
     if (! sendReceive(req, res, err)) {
@@ -395,6 +468,7 @@ DM32UVInterface::read(uint32_t bank, uint32_t address, uint8_t *data, int nbytes
 
   while (nbytes > 0) {
     int n = std::min(nbytes, 0x1000);
+    TransferStats::Request request(_stats, TransferStats::Direction::Read, n);
     ReadRequest req(address, n);
     ReadResponse res;
     if (! sendReceive(req, res, err)) {
@@ -442,6 +516,7 @@ DM32UVInterface::write(uint32_t bank, uint32_t address, uint8_t *data, int nbyte
   // align with 1000h blocks
   if (address & 0xfff) {
     int n = std::min(nbytes, (int)(0x1000 - (address & 0xfff)));
+    TransferStats::Request request(_stats, TransferStats::Direction::Write, n);
     WriteRequest req(address, QByteArray((const char*)data, n));
     ACKResponse res;
     if (! sendReceive(req, res, err)) {
@@ -455,6 +530,7 @@ DM32UVInterface::write(uint32_t bank, uint32_t address, uint8_t *data, int nbyte
 
   while (nbytes > 0) {
     int n = std::min(nbytes, 0x1000);
+    TransferStats::Request request(_stats, TransferStats::Direction::Write, n);
     WriteRequest req(address, QByteArray((const char*)data, n));
     ACKResponse res;
     if (! sendReceive(req, res, err)) {
@@ -647,27 +723,15 @@ DM32UVInterface::send(const char *data, qint64 n, int timeout, const ErrorStack
 
 bool
 DM32UVInterface::receive(char *data, qint64 n, int timeout, const ErrorStack &err) {
-  if (bytesAvailable()) {
-    auto k = QSerialPort::read(data, n);
-    if (0 > k) {
-      errMsg(err) << "Cannot read from serial port: " << errorString() << ".";
-      return false;
-    }
-    n -= k; data += k;
+  if (! waitForResponse(n, timeout)) {
+    errMsg(err) << "QSerialPort: " << errorString() << ".";
+    errMsg(err) << "Cannot read from serial port, timeout.";
+    return false;
   }
 
-  while (n) {
-    if (! waitForReadyRead(timeout)) {
-      errMsg(err) << "QSerialPort: " << errorString() << ".";
-      errMsg(err) << "Cannot read from serial port, timeout.";
-      return false;
-    }
-    auto k = QSerialPort::read(data, n);
-    if (0 > k) {
-      errMsg(err) << "Cannot read from serial port: " << errorString() << ".";
-      return false;
-    }
-    n -= k; data += k;
+  if (n != QSerialPort::read(data, n)) {
+    errMsg(err) << "Cannot read from serial port: " << errorString() << ".";
+    return false;
   }
 
   return true;
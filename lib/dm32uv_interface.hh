@@ -3,6 +3,7 @@
 
 #include "usbserial.hh"
 #include <QObject>
+#include <QElapsedTimer>
 #include "dm32uv.hh"
 
 
@@ -250,9 +251,21 @@ public:
   /** Closes the interface. If in program mode, cycles DTR to reset the radio first. */
   void close() override;
 
-  /** Reads the obfuscation address map from the device. */
+  /** Reads the obfuscation address map from the device. That is, probes every page of the
+   * codeplug memory. */
   bool getAddressMap(DM32UV::AddressMap &map, const ErrorStack &err=ErrorStack(),
                      void (*progress)(unsigned int percent)=nullptr);
+  /** Checks a previously obtained address map against the device, by probing the given number of
+   * mapped and unmapped pages each. The remaining mapped pages must be checked by the caller,
+   * e.g., while reading them.
+   * @returns @c true if all probed pages match the map. */
+  bool verifyAddressMap(const DM32UV::AddressMap &map, unsigned int samples,
+                        const ErrorStack &err=ErrorStack());
+
+  /** Returns the firmware version of the radio. */
+  const QByteArray &firmwareVersion() const;
+  /** Returns the codeplug memory range. */
+  const QPair<uint32_t, uint32_t> &codeplugMemory() const;
 
   bool read_start(uint32_t bank, uint32_t address, const ErrorStack &err=ErrorStack()) override;
   bool read(uint32_t bank, uint32_t address, uint8_t *data, int nbytes, const ErrorStack &err=ErrorStack()) override;
@@ -273,12 +286,20 @@ protected:
   bool request_identifier(const ErrorStack &err = ErrorStack());
   /** Enters program mode. */
   bool enter_program_mode(const ErrorStack &err = ErrorStack());
+  /** Reads the virtual address prefix of the page at the given physical address. */
+  bool readPagePrefix(uint32_t addr, uint8_t &prefix, const ErrorStack &err = ErrorStack());
   /** Helper function to send a request and receives the associated response. */
   template<class Request, class Response>
   bool sendReceive(const Request &req, Response &res, const ErrorStack &err=ErrorStack()) {
+    QElapsedTimer timer; timer.start();
     if (! req.send(this, err))
       return false;
-    return res.receive(this, err);
+    if (! res.receive(this, err)) {
+      resetRoundTripTime();
+      return false;
+    }
+    addRoundTripSample(timer.nsecsElapsed()/1000);
+    return true;
   }
   /** Send some data. */
   bool send(const char *data, qint64 n, int timeout, const ErrorStack &err=ErrorStack());
@@ -2466,16 +2466,13 @@ DMR6X2UVCodeplug::encodeElements(const Flags &flags, Context &ctx, const ErrorSt
   if (! D868UVCodeplug::encodeElements(flags, ctx, err))
     return false;
 
-  if (! this->encodeRoaming(flags, ctx, err))
-    return false;
-
-  if (! this->encodeAESKeys(flags, ctx, err))
-    return false;
-
-  if (! this->encodeARC4Keys(flags, ctx, err))
-    return false;
+  QVector<EncodeTask> tasks = {
+    [this, &flags, &ctx](const ErrorStack &err) { return this->encodeRoaming(flags, ctx, err); },
+    [this, &flags, &ctx](const ErrorStack &err) { return this->encodeAESKeys(flags, ctx, err); },
+    [this, &flags, &ctx](const ErrorStack &err) { return this->encodeARC4Keys(flags, ctx, err); }
+  };
 
-  return true;
+  return encodeTasks(tasks, flags, ctx, err);
 }
 
 
@@ -2573,10 +2570,8 @@ DMR6X2UVCodeplug::allocateChannels() {
 
 bool
 DMR6X2UVCodeplug::encodeChannels(const Flags &flags, Context &ctx, const ErrorStack &err) {
-  Q_UNUSED(flags);
-
   // Encode channels
-  for (unsigned int i=0; i<ctx.count<Channel>(); i++) {
+  return encodeRange(ctx.count<Channel>(), flags, [this, &ctx](unsigned int i, const ErrorStack &err) {
     // enable channel
     uint16_t bank = i/Limit::channelsPerBank(), idx = i%Limit::channelsPerBank();
     uint32_t addr = Offset::channelBanks() + bank*Offset::betweenChannelBanks()+ idx*ChannelElement::size();
@@ -2584,10 +2579,8 @@ DMR6X2UVCodeplug::encodeChannels(const Flags &flags, Context &ctx, const ErrorSt
     if (! ch.fromChannelObj(ctx.get<Channel>(i), ctx))
       return false;
     ChannelExtensionElement ext(data(addr + Offset::toChannelExtension()));
-    if (! ext.fromChannelObj(ctx.get<Channel>(i), ctx, err))
-      return false;
-  }
-  return true;
+    return ext.fromChannelObj(ctx.get<Channel>(i), ctx, err);
+  }, err);
 }
 
 bool
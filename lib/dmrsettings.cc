@@ -45,7 +45,7 @@ DMRSettings::enablePrivateCallMatch(bool enable) {
   if (_privateCallMatch == enable)
     return;
   _privateCallMatch = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -58,7 +58,7 @@ DMRSettings::enableGroupCallMatch(bool enable) {
   if (_groupCallMatch == enable)
     return;
   _groupCallMatch = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -72,7 +72,7 @@ DMRSettings::setPrivateCallHangTime(const Interval &dur) {
   if (_privateCallHangTime == dur)
     return;
   _privateCallHangTime = dur;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -86,7 +86,7 @@ DMRSettings::setGroupCallHangTime(const Interval &dur) {
   if (_groupCallHangTime == dur)
     return;
   _groupCallHangTime = dur;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -100,7 +100,7 @@ DMRSettings::enableSendTalkerAlias(bool enable) {
   if (_sendTalkerAlias == enable)
     return;
   _sendTalkerAlias = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -114,7 +114,7 @@ DMRSettings::setTalkerAliasEncoding(TalkerAliasEncoding encoding) {
   if (_talkerAliasEncoding == encoding)
     return;
   _talkerAliasEncoding = encoding;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -128,6 +128,6 @@ DMRSettings::setPreamble(const Interval &dur) {
   if (_preamble == dur)
     return;
   _preamble = dur;
-  emit modified(this);
+  emitModified();
 }
 
@@ -8,6 +8,8 @@ RadioLimits * DR1801UV::_limits = nullptr;
 DR1801UV::DR1801UV(DR1801UVInterface *device, QObject *parent)
   : Radio(parent), _device(device), _name("Baofeng DR-1801UV")
 {
+  if (_device)
+    _device->setStats(&_stats);
   // Check if device is open
   if ((nullptr==_device) || (! _device->isOpen())) {
     _task = StatusError;
@@ -111,6 +113,8 @@ DR1801UV::startUploadSatelliteConfig(SatelliteDatabase *db, const TransferFlags
 
 void
 DR1801UV::run() {
+  TransferStats::Session session(_stats);
+
   if (StatusDownload == _task) {
     if ((nullptr==_device) || (! _device->isOpen())) {
       emit downloadError(this);
@@ -165,6 +169,7 @@ DR1801UV::run() {
 
 bool
 DR1801UV::download() {
+  _stats.beginPhase("read");
   if (! _device->readCodeplug(_codeplug, [this](unsigned int n, unsigned int total){
                               emit downloadProgress(float(n*100)/total); }, _errorStack)) {
     errMsg(_errorStack) << "Cannot read codeplug from device.";
@@ -177,6 +182,7 @@ DR1801UV::download() {
 bool
 DR1801UV::upload() {
   // First, read codeplug from the device
+  _stats.beginPhase("read");
   if (! _device->readCodeplug(_codeplug, [this](unsigned int n, unsigned int total) {
                               emit uploadProgress(float(n*50)/total); }, _errorStack))
   {
@@ -185,10 +191,12 @@ DR1801UV::upload() {
   }
 
   // Encode config into codeplug
+  _stats.beginPhase("encode");
   _codeplug.encode(_config, _codeplugFlags);
   _codeplug.data(0x304)[0] = 0;
 
   // Write codeplug back to the device
+  _stats.beginPhase("write");
   if (! _device->writeCodeplug(_codeplug, [this](unsigned int n, unsigned int total) {
                                emit uploadProgress(50+float(n*50)/total); }, _errorStack)) {
     errMsg(_errorStack) << "Cannot write codeplug to the device.";
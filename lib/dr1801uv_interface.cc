@@ -159,6 +159,7 @@ DR1801UVInterface::readCodeplug(
   unsigned int offset = 0;
   while (bytesToTransfer) {
     unsigned n = std::min(256U, bytesToTransfer);
+    TransferStats::Request request(_stats, TransferStats::Direction::Read, n);
     if (! AuctusA6Interface::read(codeplug.image(0).data(offset), n, 2000, err)) {
       errMsg(err) << "Cannot read from device '" << portName() << "'.";
       _state = ERROR;
@@ -175,6 +176,7 @@ DR1801UVInterface::readCodeplug(
     errMsg(err) << "Cannot set baud-rate of serial port '" << portName() << "'.";
     return false;
   }
+  // Give the device some time to switch back.
   QThread::msleep(250);
 
   _state = IDLE;
@@ -223,6 +225,7 @@ DR1801UVInterface::writeCodeplug(
   logDebug() << "Write codeplug...";
   while (bytesToTransfer) {
     uint32_t n = std::min(200U, bytesToTransfer);
+    TransferStats::Request request(_stats, TransferStats::Direction::Write, n);
     if (! QSerialPort::write((char*)codeplug.data(offset), n)) {
       errMsg(err) << "Cannot write codeplug to device.";
       return false;
@@ -42,7 +42,7 @@ EncryptionKey::setKey(const QByteArray &key, const ErrorStack &err) {
     return true;
 
   _key = key;
-  emit modified(this);
+  emitModified();
 
   return true;
 }
@@ -10,12 +10,15 @@
 RadioLimits * GD73::_limits = nullptr;
 
 
-GD73::GD73(GD73Interface *device, QObject *parent)
+GD73::GD73(RadioInterface *device, QObject *parent)
   : Radio(parent), _name("Radioddity GD-73"), _dev(device), _codeplugFlags(), _config(nullptr),
     _codeplug()
 {
+  // All interfaces are QObjects, the radio takes ownership of it.
+  if (QObject *obj = dynamic_cast<QObject *>(_dev))
+    obj->setParent(this);
   if (_dev)
-    _dev->setParent(this);
+    _dev->setStats(&_stats);
 }
 
 const QString &
@@ -105,6 +108,8 @@ GD73::startUploadSatelliteConfig(SatelliteDatabase *db, const TransferFlags &fla
 
 void
 GD73::run() {
+  TransferStats::Session session(_stats);
+
   if (StatusDownload == _task) {
     if ((nullptr==_dev) || (! _dev->isOpen())) {
       emit downloadError(this);
@@ -168,6 +173,7 @@ GD73::run() {
 bool
 GD73::download() {
   emit downloadStarted();
+  _stats.beginPhase("read");
 
   unsigned btot = 0;
   for (int n=0; n<codeplug().image(0).numElements(); n++) {
@@ -206,6 +212,7 @@ GD73::upload() {
 
   unsigned bcount = 0;
   if (_codeplugFlags.updateCodeplug()) {
+    _stats.beginPhase("read");
     if (! _dev->read_start(0,0,_errorStack))
       return false;
 
@@ -228,11 +235,13 @@ GD73::upload() {
   }
 
   // Encode config into codeplug
+  _stats.beginPhase("encode");
   if (! codeplug().encode(_config, _codeplugFlags, _errorStack)) {
     errMsg(_errorStack) << "Codeplug upload failed.";
     return false;
   }
 
+  _stats.beginPhase("write");
   if (! _dev->write_start(0, 0, _errorStack))
     return false;
 
@@ -24,7 +24,7 @@ class GD73 : public Radio
 
 public:
   /** Do not construct this class directly, rather use @c Radio::detect. */
-  explicit GD73(GD73Interface *device=nullptr, QObject *parent=nullptr);
+  explicit GD73(RadioInterface *device=nullptr, QObject *parent=nullptr);
 
   const QString &name() const;
   const RadioLimits &limits() const;
@@ -63,8 +63,8 @@ protected:
   /** The device identifier. */
   QString _name;
 
-  /** The interface to the radio. */
-  GD73Interface *_dev;
+  /** The interface to the radio. Usually a @c GD73Interface. */
+  RadioInterface *_dev;
   /** Holds the flags to control assembly and upload of code-plugs. */
   Codeplug::Flags _codeplugFlags;
   /** The generic configuration. */
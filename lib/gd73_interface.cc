@@ -45,6 +45,7 @@ GD73Interface::write_start(uint32_t bank, uint32_t addr, const ErrorStack &err)
 
 bool
 GD73Interface::write(uint32_t bank, uint32_t addr, uint8_t *data, int nbytes, const ErrorStack &err) {
+  TransferStats::Request request(_stats, TransferStats::Direction::Write, nbytes);
   Q_UNUSED(bank);
 
   if ((addr%BLOCK_SIZE) || (nbytes!=BLOCK_SIZE)) {
@@ -81,6 +82,7 @@ GD73Interface::read_start(uint32_t bank, uint32_t addr, const ErrorStack &err) {
 
 bool
 GD73Interface::read(uint32_t bank, uint32_t addr, uint8_t *data, int nbytes, const ErrorStack &err) {
+  TransferStats::Request request(_stats, TransferStats::Direction::Read, nbytes);
   Q_UNUSED(bank);
 
   if ((addr%BLOCK_SIZE) || (nbytes!=BLOCK_SIZE)) {
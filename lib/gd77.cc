@@ -10,7 +10,7 @@
 RadioLimits * GD77::_limits = nullptr;
 
 
-GD77::GD77(RadioddityInterface *device, QObject *parent)
+GD77::GD77(RadioInterface *device, QObject *parent)
   : RadioddityRadio(device, parent), _name("Radioddity GD-77"), _codeplug(), _callsigns()
 {
   // pass...
@@ -38,6 +38,16 @@ GD77::codeplug() {
   return _codeplug;
 }
 
+const CallsignDB *
+GD77::callsignDB() const {
+  return &_callsigns;
+}
+
+CallsignDB *
+GD77::callsignDB() {
+  return &_callsigns;
+}
+
 RadioInfo
 GD77::defaultRadioInfo() {
   return RadioInfo(
@@ -88,6 +98,7 @@ GD77::uploadCallsigns()
   }
 
   logDebug() << "Call-sign DB upload started...";
+  _stats.beginPhase("write");
 
   size_t totb = _callsigns.memSize();
   unsigned bcount = 0;
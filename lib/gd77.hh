@@ -24,12 +24,14 @@ class GD77 : public RadioddityRadio
 
 public:
 	/** Do not construct this class directly, rather use @c Radio::detect. */
-  explicit GD77(RadioddityInterface *device=nullptr, QObject *parent=nullptr);
+  explicit GD77(RadioInterface *device=nullptr, QObject *parent=nullptr);
 
 	const QString &name() const;
   const RadioLimits &limits() const;
   const Codeplug &codeplug() const;
   Codeplug &codeplug();
+  const CallsignDB *callsignDB() const;
+  CallsignDB *callsignDB();
 
   /** Returns the default radio information. The actual instance may have different properties
    * due to variants of the same radio. */
@@ -45,8 +45,8 @@ GD77CallsignDB::userdb_entry_t::setName(const QString &name) {
 void
 GD77CallsignDB::userdb_entry_t::fromEntry(const UserDatabase::User &user) {
   clear();
-  setNumber(user.id);
-  setName(user.call);
+  setNumber(user.id());
+  setName(user.call());
 }
 
 
@@ -82,6 +82,11 @@ GD77CallsignDB::~GD77CallsignDB() {
   // pass...
 }
 
+unsigned int
+GD77CallsignDB::maxEntries() const {
+  return USERDB_MAX_ENTRIES;
+}
+
 bool
 GD77CallsignDB::encode(UserDatabase *calldb, const Flags &selection, const ErrorStack &err) {
   Q_UNUSED(err)
@@ -101,7 +106,7 @@ GD77CallsignDB::encode(UserDatabase *calldb, const Flags &selection, const Error
     users.append(calldb->user(i));
   logDebug() << "Sort selected w.r.t their ID in ascending order.";
   std::sort(users.begin(), users.end(),
-            [](const UserDatabase::User &a, const UserDatabase::User &b) { return a.id < b.id; });
+            [](const UserDatabase::User &a, const UserDatabase::User &b) { return a.id() < b.id(); });
 
   // Allocate segment for user db if requested
   size_t size = align_size(sizeof(userdb_t)+n*sizeof(userdb_entry_t), BLOCK_SIZE);
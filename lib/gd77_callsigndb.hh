@@ -78,6 +78,7 @@ public:
   /** Encodes as many entries as possible of the given user-database. */
   virtual bool encode(UserDatabase *calldb, const Flags &selection=Flags(),
                       const ErrorStack &err=ErrorStack());
+  unsigned int maxEntries() const;
 };
 
 #endif // GD77CALLSIGNDB_HH
@@ -31,7 +31,7 @@ GNSSSettings::enableFixedPosition(bool use) {
   if (_fixedPositionEnabled == use)
     return;
   _fixedPositionEnabled = use;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -45,7 +45,7 @@ GNSSSettings::setFixedPosition(const QGeoCoordinate &pos) {
   if (_fixedPosition == pos)
     return;
   _fixedPosition = pos;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -70,7 +70,7 @@ GNSSSettings::setSystems(Systems systems) {
   if (_systems == systems)
     return;
   _systems = systems;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -84,5 +84,5 @@ GNSSSettings::setUnits(Units units) {
   if (_units == units)
     return;
   _units = units;
-  emit modified(this);
+  emitModified();
 }
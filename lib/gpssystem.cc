@@ -40,7 +40,7 @@ PositionReportingSystem::setPeriod(const Interval &period) {
   if (_period == period)
     return;
   _period = period;
-  emit modified(this);
+  emitModified();
 }
 
 void
@@ -92,7 +92,7 @@ PositionReportingSystem::link(const YAML::Node &node, const Context &ctx, const
 
 void
 PositionReportingSystem::onReferenceModified() {
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -396,7 +396,7 @@ FMAPRSSystem::message() const {
 void
 FMAPRSSystem::setMessage(const QString &msg) {
   _message = msg;
-  emit modified(this);
+  emitModified();
 }
 
 AnytoneFMAPRSSettingsExtension *
@@ -0,0 +1,123 @@
+#include "imagecache.hh"
+#include <QStandardPaths>
+#include <QDir>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QRegularExpression>
+#include "crc32.hh"
+#include "logger.hh"
+
+
+/* ********************************************************************************************* *
+ * Implementation of ImageCache
+ * ********************************************************************************************* */
+ImageCache::ImageCache(const QString &name, const QString &version, const QString &device)
+  : _name(name), _version(version), _device(device), _image(), _elements()
+{
+  // pass...
+}
+
+bool
+ImageCache::load(uint32_t fingerprint, const ErrorStack &err) {
+  _elements.clear();
+
+  QFileInfo info(filename(fingerprint));
+  if (! info.isFile()) {
+    logDebug() << "No cached image for " << _name << " (" << _version << ") with fingerprint "
+                << QString::number(fingerprint, 16) << "h.";
+    return false;
+  }
+
+  if (! _image.read(info.absoluteFilePath(), err)) {
+    errMsg(err) << "Cannot read cached image '" << info.absoluteFilePath() << "'.";
+    return false;
+  }
+
+  if (0 == _image.numImages())
+    return false;
+
+  for (int i=0; i<_image.image(0).numElements(); i++)
+    _elements.insert(_image.image(0).element(i).address(), i);
+
+  logDebug() << "Loaded cached image for " << _name << " (" << _version << ") from '"
+             << info.absoluteFilePath() << "'.";
+  return true;
+}
+
+bool
+ImageCache::isLoaded() const {
+  return ! _elements.isEmpty();
+}
+
+const uint8_t *
+ImageCache::data(uint32_t address, uint32_t size) const {
+  if (! _elements.contains(address))
+    return nullptr;
+  const DFUFile::Element &el = _image.image(0).element(_elements[address]);
+  if (el.memSize() < size)
+    return nullptr;
+  return (const uint8_t *)el.data().constData();
+}
+
+bool
+ImageCache::store(const DFUFile::Image &image, uint32_t fingerprint, const ErrorStack &err) {
+  QDir dir(QStandardPaths::writableLocation(QStandardPaths::CacheLocation));
+  if ((! dir.exists()) && (! dir.mkpath("."))) {
+    errMsg(err) << "Cannot create cache directory '" << dir.absolutePath() << "'.";
+    return false;
+  }
+
+  // The loaded image may still reference a cached file, which gets replaced or removed below.
+  _image.detach();
+
+  // Write the image atomically, such that concurrent transfers or an interrupted write never
+  // leave a truncated image behind.
+  QString path = filename(fingerprint);
+  QSaveFile file(path);
+  if (! file.open(QIODevice::WriteOnly)) {
+    errMsg(err) << "Cannot create cached image '" << path << "': " << file.errorString() << ".";
+    return false;
+  }
+  DFUFile dfu;
+  dfu.addImage(image);
+  if ((! dfu.write(file, err)) || (! file.commit())) {
+    errMsg(err) << "Cannot store image of " << _name << " (" << _version << ") in cache.";
+    return false;
+  }
+
+  // Remove any previously cached image of this particular radio
+  foreach (QString name, dir.entryList(QStringList() << (prefix()+"*.dfu"), QDir::Files)) {
+    if (dir.absoluteFilePath(name) != path)
+      dir.remove(name);
+  }
+
+  logDebug() << "Stored image of " << _name << " (" << _version << ") in '" << path << "'.";
+  return true;
+}
+
+uint32_t
+ImageCache::fingerprint(const DFUFile::Image &image, const QVector<Region> &regions) {
+  CRC32 crc;
+  foreach (const Region &region, regions) {
+    const unsigned char *ptr = image.data(region.address);
+    if (nullptr != ptr)
+      crc.update(ptr, region.size);
+  }
+  return crc.get();
+}
+
+QString
+ImageCache::prefix() const {
+  static QRegularExpression invalid("[^A-Za-z0-9.]");
+  // The device identifier may contain arbitrary characters, hence its CRC is used.
+  CRC32 device; device.update(_device.toUtf8());
+  return QString("%1_%2_%3_").arg(QString(_name).replace(invalid, "_"))
+      .arg(QString(_version).replace(invalid, "_"))
+      .arg(device.get(), 8, 16, QChar('0'));
+}
+
+QString
+ImageCache::filename(uint32_t fingerprint) const {
+  QDir dir(QStandardPaths::writableLocation(QStandardPaths::CacheLocation));
+  return dir.absoluteFilePath(prefix() + QString("%1.dfu").arg(fingerprint, 8, 16, QChar('0')));
+}
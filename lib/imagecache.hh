@@ -0,0 +1,77 @@
+#ifndef IMAGECACHE_HH
+#define IMAGECACHE_HH
+
+#include <QHash>
+#include <QVector>
+#include "dfufile.hh"
+#include "errorstack.hh"
+
+/** Implements a persistent local cache of the last known codeplug image of a radio.
+ *
+ * The cache is keyed by the radio name and version, an identifier of the particular device (e.g.,
+ * the USB serial number) as well as a cheap fingerprint read from the radio (e.g., a CRC over all
+ * bitmaps). Hence several radios of the same model do not share their cached images. The key must
+ * not depend on how the radio is connected, like the port, otherwise re-plugging the radio would
+ * invalidate the cache.
+ *
+ * The cached image must not be trusted blindly. Before using any element from the cache, a few
+ * sample blocks should be read from the device and compared with the cached data. Even then, the
+ * cached data may be outdated and must not serve as a reference of the device memory, e.g., to
+ * decide which blocks need to be written. Hence, only reading a codeplug benefits from the cache.
+ *
+ * The images are stored as DFU files within the application cache directory.
+ *
+ * @ingroup util */
+class ImageCache
+{
+public:
+  /** A memory region within an image. */
+  struct Region {
+    uint32_t address; ///< Start address of the region.
+    uint32_t size;    ///< Size of the region in bytes.
+  };
+
+public:
+  /** Constructs a cache for the radio identified by the given name and version. The @c device
+   * identifies the particular radio of that model. */
+  ImageCache(const QString &name, const QString &version, const QString &device);
+
+  /** Loads the cached image matching the given fingerprint.
+   * @returns @c false if there is no matching image. */
+  bool load(uint32_t fingerprint, const ErrorStack &err=ErrorStack());
+  /** Returns @c true if an image has been loaded. */
+  bool isLoaded() const;
+
+  /** Returns a pointer to the cached data of the element at the given address, if the cached
+   * element has at least the specified size. Otherwise @c nullptr is returned. */
+  const uint8_t *data(uint32_t address, uint32_t size) const;
+
+  /** Stores the given image under the given fingerprint. Any previously cached image of the radio
+   * gets replaced. The image is written atomically, hence a concurrent or interrupted store never
+   * leaves a truncated image behind. */
+  bool store(const DFUFile::Image &image, uint32_t fingerprint, const ErrorStack &err=ErrorStack());
+
+public:
+  /** Computes the fingerprint, that is the CRC32 over the given regions of the image. */
+  static uint32_t fingerprint(const DFUFile::Image &image, const QVector<Region> &regions);
+
+protected:
+  /** Returns the file name prefix for cached images of this radio. */
+  QString prefix() const;
+  /** Returns the file name of the cached image with the given fingerprint. */
+  QString filename(uint32_t fingerprint) const;
+
+protected:
+  /** The name of the radio. */
+  QString _name;
+  /** The version of the radio. */
+  QString _version;
+  /** The identifier of the particular radio. */
+  QString _device;
+  /** The cached image. */
+  DFUFile _image;
+  /** Maps element addresses to element indices of the cached image. */
+  QHash<uint32_t, int> _elements;
+};
+
+#endif // IMAGECACHE_HH
@@ -1,4 +1,5 @@
 #include "intermediaterepresentation.hh"
+#include "config.hh"
 #include "configobject.hh"
 #include "zone.hh"
 #include "encryptionextension.hh"
@@ -14,6 +15,12 @@ ZoneSplitVisitor::ZoneSplitVisitor()
   // pass...
 }
 
+bool
+ZoneSplitVisitor::process(Config *config, const ErrorStack &err) {
+  Config::UpdateGuard update(config);
+  return Visitor::process(config, err);
+}
+
 bool
 ZoneSplitVisitor::processItem(ConfigItem *item, const ErrorStack &err) {
   // Skip non-zones
@@ -54,6 +61,12 @@ ZoneMergeVisitor::ZoneMergeVisitor()
   // pass...
 }
 
+bool
+ZoneMergeVisitor::process(Config *config, const ErrorStack &err) {
+  Config::UpdateGuard update(config);
+  return Visitor::process(config, err);
+}
+
 bool
 ZoneMergeVisitor::processList(AbstractConfigObjectList *list, const ErrorStack &err) {
   if (nullptr == qobject_cast<ZoneList *>(list))
@@ -118,6 +131,12 @@ AbstractObjectFilterVisitor::AbstractObjectFilterVisitor()
   // pass...
 }
 
+bool
+AbstractObjectFilterVisitor::process(Config *config, const ErrorStack &err) {
+  Config::UpdateGuard update(config);
+  return Visitor::process(config, err);
+}
+
 bool
 AbstractObjectFilterVisitor::processProperty(ConfigItem *item, const QMetaProperty &prop, const ErrorStack &err) {
   if (! propIsInstance<ConfigItem>(prop))
@@ -24,6 +24,8 @@ public:
   /** Constructor. */
   explicit ZoneSplitVisitor();
 
+  /** Traverses the configuration within a single batch update. */
+  bool process(Config *config, const ErrorStack &err=ErrorStack());
   bool processItem(ConfigItem *item, const ErrorStack &err);
 };
 
@@ -37,6 +39,8 @@ public:
   /** Constructor. */
   explicit ZoneMergeVisitor();
 
+  /** Traverses the configuration within a single batch update. */
+  bool process(Config *config, const ErrorStack &err=ErrorStack());
   bool processList(AbstractConfigObjectList *list, const ErrorStack &err);
   bool processItem(ConfigItem *item, const ErrorStack &err);
 
@@ -61,6 +65,8 @@ protected:
   explicit AbstractObjectFilterVisitor();
 
 public:
+  /** Traverses the configuration within a single batch update. */
+  bool process(Config *config, const ErrorStack &err=ErrorStack());
   bool processProperty(ConfigItem *item, const QMetaProperty &prop, const ErrorStack &err);
   bool processList(AbstractConfigObjectList *list, const ErrorStack &err);
 
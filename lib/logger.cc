@@ -2,27 +2,36 @@
 #include <QFileInfo>
 #include <QDir>
 #include <QDateTime>
+#include <QThread>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+/** Number of slots in the ring buffer, must be a power of two. */
+#define BUFFER_SIZE 4096
 
 
 /* ********************************************************************************************* *
  * Implementation of LogMessage
  * ********************************************************************************************* */
 LogMessage::LogMessage(Level level, const QString &file, int line, const QString &message)
-  : QTextStream(), _level(level), _file(file), _line(line), _message(message)
+  : QTextStream(), _level(level), _file(file), _line(line), _message(message), _forward(true)
 {
   this->setString(&_message);
   this->seek(_message.size());
 }
 
 LogMessage::LogMessage(const LogMessage &other)
-  : QTextStream(), _level(other._level), _file(other._file), _line(other._line), _message(other._message)
+  : QTextStream(), _level(other._level), _file(other._file), _line(other._line), _message(other._message),
+    _forward(other._forward)
 {
   this->setString(&_message);
   this->seek(_message.size());
 }
 
 LogMessage::~LogMessage() {
-  Logger::get().log(*this);
+  if (_forward)
+    Logger::get().log(*this);
 }
 
 LogMessage::Level
@@ -59,28 +68,50 @@ LogHandler::~LogHandler() {
   // pass...
 }
 
+LogMessage::Level
+LogHandler::minLevel() const {
+  return LogMessage::TRACE;
+}
+
 
 /* ********************************************************************************************* *
  * Implementation of Logger
  * ********************************************************************************************* */
 Logger *Logger::_instance = nullptr;
+QAtomicInt Logger::_minLevel(LogMessage::FATAL);
 
 Logger::Logger()
-  : QObject(nullptr), _handler(), _lock()
+  : QObject(nullptr), _handler(), _lock(), _slots(new Slot[BUFFER_SIZE]), _head(0), _tail(0),
+    _written(0), _pending(0), _writer(nullptr), _running(0), _droppedSinceReport(0), _dropped(0)
 {
-  // pass...
+  for (size_t i=0; i<BUFFER_SIZE; i++)
+    _slots[i].sequence.store(i, std::memory_order_relaxed);
 }
 
 Logger::~Logger() {
+  setAsynchronous(false);
   _handler.clear();
+  delete[] _slots;
 }
 
 void
 Logger::log(const LogMessage &msg) {
-  _lock.lock();
-  foreach (LogHandler *handler, _handler) {
-    handler->handle(msg);
+  if (_running.loadAcquire() && (LogMessage::FATAL != msg.level())) {
+    if (! enqueue(msg)) {
+      _droppedSinceReport.fetchAndAddRelaxed(1);
+      _dropped.fetchAndAddRelaxed(1);
+      return;
+    }
+    _pending.release();
+    return;
   }
+
+  // Keep order, if a fatal message is logged in asynchronous mode
+  if (LogMessage::FATAL == msg.level())
+    flush();
+
+  _lock.lock();
+  dispatch(msg);
   _lock.unlock();
 }
 
@@ -91,22 +122,173 @@ Logger::addHandler(LogHandler *handler) {
   if (_handler.contains(handler))
     return;
   handler->setParent(this);
+  _lock.lock();
   _handler.append(handler);
+  _lock.unlock();
   connect(handler, SIGNAL(destroyed(QObject*)), this, SLOT(onHandlerDeleted(QObject*)));
+  updateMinLevel();
 }
 
 void
 Logger::remHandler(LogHandler *handler) {
+  // Pass pending messages to the handler before removing it
+  flush();
   if (_handler.contains(handler)) {
     handler->setParent(nullptr);
     disconnect(handler, SIGNAL(destroyed(QObject*)), this, SLOT(onHandlerDeleted(QObject*)));
   }
+  _lock.lock();
   _handler.removeAll(handler);
+  _lock.unlock();
+  updateMinLevel();
+}
+
+bool
+Logger::isAsynchronous() const {
+  return nullptr != _writer;
+}
+
+void
+Logger::setAsynchronous(bool enable) {
+  if (enable == isAsynchronous())
+    return;
+
+  if (enable) {
+    // Make sure, pending messages are handled if the application exits early.
+    static bool atExitRegistered = false;
+    if (! atExitRegistered)
+      atExitRegistered = (0 == std::atexit([]() { Logger::get().setAsynchronous(false); }));
+    _running.storeRelease(1);
+    _writer = QThread::create([this]() { this->drain(); });
+    _writer->start(QThread::LowPriority);
+    return;
+  }
+
+  // Stop writer thread, once the buffer is empty
+  _running.storeRelease(0);
+  _pending.release();
+  _writer->wait();
+  delete _writer;
+  _writer = nullptr;
+
+  // Handle messages, that got into the buffer while stopping
+  Record record;
+  _lock.lock();
+  while (dequeue(record)) {
+    LogMessage msg(record.level, record.file, record.line, record.message);
+    msg._forward = false;
+    dispatch(msg);
+  }
+  reportDropped();
+  _lock.unlock();
+}
+
+void
+Logger::flush() {
+  if ((! isAsynchronous()) || (QThread::currentThread() == _writer))
+    return;
+  size_t head = _head.load(std::memory_order_acquire);
+  while (_written.load(std::memory_order_acquire) < head)
+    QThread::yieldCurrentThread();
+}
+
+unsigned int
+Logger::dropped() const {
+  return _dropped.loadRelaxed();
+}
+
+void
+Logger::updateMinLevel() {
+  int minLevel = LogMessage::FATAL;
+  _lock.lock();
+  foreach (LogHandler *handler, _handler)
+    minLevel = std::min(minLevel, int(handler->minLevel()));
+  _lock.unlock();
+  _minLevel.storeRelaxed(minLevel);
+}
+
+bool
+Logger::enqueue(const LogMessage &msg) {
+  // Bounded multi-producer queue, see D. Vyukov, "Bounded MPMC queue".
+  size_t pos = _head.load(std::memory_order_relaxed);
+  Slot *slot = nullptr;
+  while (true) {
+    slot = &_slots[pos & (BUFFER_SIZE-1)];
+    size_t seq = slot->sequence.load(std::memory_order_acquire);
+    intptr_t diff = intptr_t(seq) - intptr_t(pos);
+    if (0 == diff) {
+      if (_head.compare_exchange_weak(pos, pos+1, std::memory_order_relaxed))
+        break;
+    } else if (0 > diff) {
+      return false;
+    } else {
+      pos = _head.load(std::memory_order_relaxed);
+    }
+  }
+
+  slot->record = Record{msg.level(), msg.file(), msg.line(), msg.message()};
+  slot->sequence.store(pos+1, std::memory_order_release);
+  return true;
+}
+
+bool
+Logger::dequeue(Record &record) {
+  Slot &slot = _slots[_tail & (BUFFER_SIZE-1)];
+  if (slot.sequence.load(std::memory_order_acquire) != (_tail+1))
+    return false;
+  record = std::move(slot.record);
+  slot.record = Record();
+  slot.sequence.store(_tail+BUFFER_SIZE, std::memory_order_release);
+  _tail++;
+  return true;
+}
+
+void
+Logger::drain() {
+  Record record;
+  while (true) {
+    _pending.acquire();
+    // The slot may be reserved but not written yet, wait for it.
+    while (! dequeue(record)) {
+      if (! _running.loadAcquire())
+        return;
+      QThread::yieldCurrentThread();
+    }
+    LogMessage msg(record.level, record.file, record.line, record.message);
+    msg._forward = false;
+    _lock.lock();
+    reportDropped();
+    dispatch(msg);
+    _lock.unlock();
+    _written.fetch_add(1, std::memory_order_release);
+  }
+}
+
+void
+Logger::dispatch(const LogMessage &msg) {
+  foreach (LogHandler *handler, _handler) {
+    handler->handle(msg);
+  }
+}
+
+void
+Logger::reportDropped() {
+  unsigned int n = _droppedSinceReport.fetchAndStoreRelaxed(0);
+  if (0 == n)
+    return;
+  LogMessage msg(LogMessage::WARNING, __FILE__, __LINE__);
+  msg._forward = false;
+  msg << "Log buffer overflow: " << n << " messages dropped.";
+  dispatch(msg);
 }
 
 void
 Logger::onHandlerDeleted(QObject *obj) {
-  _handler.removeAll(dynamic_cast<LogHandler*>(obj));
+  _lock.lock();
+  // The handler is already destroyed, do not cast dynamically.
+  _handler.removeAll(static_cast<LogHandler*>(obj));
+  _lock.unlock();
+  updateMinLevel();
 }
 
 Logger &
@@ -135,6 +317,7 @@ StreamLogHandler::minLevel() const {
 void
 StreamLogHandler::setMinLevel(LogMessage::Level minLevel) {
   _minLevel = minLevel;
+  Logger::get().updateMinLevel();
 }
 
 void
@@ -224,6 +407,7 @@ FileLogHandler::minLevel() const {
 void
 FileLogHandler::setMinLevel(LogMessage::Level minLevel) {
   _minLevel = minLevel;
+  Logger::get().updateMinLevel();
 }
 
 void
@@ -7,13 +7,24 @@
 #include <QTextStream>
 #include <QList>
 #include <QMutex>
+#include <QAtomicInteger>
+#include <QSemaphore>
+#include <atomic>
 
-/** Constructs a trace message. */
-#define logTrace() LogMessage(LogMessage::TRACE, __FILE__, __LINE__)
-/** Constructs a debug message. */
-#define logDebug() LogMessage(LogMessage::DEBUG, __FILE__, __LINE__)
-/** Constructs an info message. */
-#define logInfo()  LogMessage(LogMessage::INFO, __FILE__, __LINE__)
+class QThread;
+
+/** Constructs a trace message. The message is not assembled at all, if no log-handler accepts
+ * trace messages. */
+#define logTrace() (! Logger::isEnabled(LogMessage::TRACE)) ? (void)0 : \
+  LogMessageVoidify() & LogMessage(LogMessage::TRACE, __FILE__, __LINE__)
+/** Constructs a debug message. The message is not assembled at all, if no log-handler accepts
+ * debug messages. */
+#define logDebug() (! Logger::isEnabled(LogMessage::DEBUG)) ? (void)0 : \
+  LogMessageVoidify() & LogMessage(LogMessage::DEBUG, __FILE__, __LINE__)
+/** Constructs an info message. The message is not assembled at all, if no log-handler accepts
+ * info messages. */
+#define logInfo()  (! Logger::isEnabled(LogMessage::INFO)) ? (void)0 : \
+  LogMessageVoidify() & LogMessage(LogMessage::INFO, __FILE__, __LINE__)
 /** Constructs a warning message. */
 #define logWarn()  LogMessage(LogMessage::WARNING, __FILE__, __LINE__)
 /** Constructs an error message. */
@@ -74,6 +85,20 @@ protected:
   int _line;
   /** The log message content. */
   QString _message;
+  /** If @c true, the message is passed to the @c Logger upon destruction. */
+  bool _forward;
+
+  friend class Logger;
+};
+
+
+/** Helper to turn a filtered log-message expression into a @c void expression.
+ * Used by the @c logTrace, @c logDebug and @c logInfo macros.
+ * @ingroup log */
+struct LogMessageVoidify
+{
+  /** Swallows the log-message. Binds weaker than @c <<. */
+  void operator&(const QTextStream &) {}
 };
 
 
@@ -90,10 +115,20 @@ public:
   virtual ~LogHandler();
   /** Callback to handle log messages. */
   virtual void handle(const LogMessage &message) = 0;
+  /** Returns the minimum log level, this handler accepts. Messages below the minimum level of
+   * all handlers are not assembled at all. */
+  virtual LogMessage::Level minLevel() const;
 };
 
 
 /** Singleton class to process log messages.
+ *
+ * By default, messages are passed to the handlers synchronously. In asynchronous mode (see
+ * @c setAsynchronous), messages are put into a fixed-size ring buffer instead and get passed to
+ * the handlers by a dedicated writer thread. Hence, threads talking to a radio do not stall on
+ * console or file I/O. If the buffer is full, messages are dropped and counted rather than
+ * blocking the logging thread. Fatal messages are always handled synchronously.
+ *
  * @ingroup log */
 class Logger: public QObject
 {
@@ -114,10 +149,58 @@ public:
   /** Removes a log-handler from the logger. The ownership is transferred back to the caller. */
   void remHandler(LogHandler *handler);
 
+  /** Returns @c true if messages are handled by a separate writer thread. */
+  bool isAsynchronous() const;
+  /** Enables or disables the asynchronous mode. Disabling it, passes all pending messages to the
+   * handlers first. Disable the asynchronous mode before destroying any stream used by a
+   * handler. */
+  void setAsynchronous(bool enable);
+  /** Blocks until all pending messages are passed to the handlers. */
+  void flush();
+  /** Returns the total number of messages dropped due to a full buffer. */
+  unsigned int dropped() const;
+
+  /** Recomputes the minimum log level of all handlers. Gets called by the handlers, whenever
+   * their minimum level changes. */
+  void updateMinLevel();
+
+  /** Returns @c true, if any handler accepts messages of the given level. */
+  static inline bool isEnabled(LogMessage::Level level) {
+    return int(level) >= _minLevel.loadRelaxed();
+  }
+
 protected slots:
   /** Internal callback to handle deleted handler objects. */
   void onHandlerDeleted(QObject *obj);
 
+protected:
+  /** Content of a buffered log message. */
+  struct Record {
+    LogMessage::Level level; ///< The log level.
+    QString file;            ///< The source file.
+    int line;                ///< The source line.
+    QString message;         ///< The message content.
+  };
+
+  /** A slot of the ring buffer. */
+  struct Slot {
+    std::atomic<size_t> sequence; ///< Sequence number, tells if the slot is free or filled.
+    Record record;                ///< The buffered message.
+  };
+
+  /** Puts the message into the ring buffer. Returns @c false if the buffer is full. May be called
+   * from any thread. */
+  bool enqueue(const LogMessage &msg);
+  /** Takes the next message from the ring buffer. Returns @c false, if the buffer is empty or the
+   * next message is not completely written yet. Must only be called by a single thread. */
+  bool dequeue(Record &record);
+  /** Main loop of the writer thread. */
+  void drain();
+  /** Passes the message to all handlers, the lock must be held. */
+  void dispatch(const LogMessage &msg);
+  /** Reports the messages dropped since the last report, the lock must be held. */
+  void reportDropped();
+
 public:
   /** Factory method to get the singleton instance. */
   static Logger &get();
@@ -125,10 +208,31 @@ public:
 protected:
   /** The singleton instance. */
   static Logger *_instance;
+  /** The minimum log-level of all handlers. */
+  static QAtomicInt _minLevel;
   /** The list of registered log-handler. */
   QList<LogHandler *> _handler;
   /** Some mutex to prevent issues with log messages from different threads. */
   QMutex _lock;
+
+  /** The ring buffer. */
+  Slot *_slots;
+  /** The next position to write to. */
+  alignas(64) std::atomic<size_t> _head;
+  /** The next position to read from, only accessed by the writer thread. */
+  alignas(64) size_t _tail;
+  /** Number of messages passed to the handlers by the writer thread. */
+  std::atomic<size_t> _written;
+  /** Counts the buffered messages. */
+  QSemaphore _pending;
+  /** The writer thread, @c nullptr in synchronous mode. */
+  QThread *_writer;
+  /** If @c false, the writer thread stops once the buffer is empty. */
+  QAtomicInt _running;
+  /** Number of messages dropped since the last report. */
+  QAtomicInteger<unsigned int> _droppedSinceReport;
+  /** Total number of messages dropped. */
+  QAtomicInteger<unsigned int> _dropped;
 };
 
 
@@ -83,7 +83,7 @@ Melody::setBPM(unsigned int bpm) {
   if (_bpm == bpm)
     return;
   _bpm = bpm;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -98,7 +98,7 @@ Melody::fromLilypond(const QString &melody) {
     _melody.append(n);
   }
 
-  emit modified(this);
+  emitModified();
   return true;
 }
 
@@ -141,7 +141,7 @@ Melody::infer(const QVector<QPair<double, unsigned int> > &tones) {
     _melody.append(note);
   }
 
-  emit modified(this);
+  emitModified();
   return true;
 }
 
@@ -30,6 +30,7 @@ public:
   /** Encodes as many entries as possible of the given user-database. */
   bool encode(UserDatabase *calldb, const Flags &selection=Flags(),
               const ErrorStack &err=ErrorStack());
+  unsigned int maxEntries() const;
 
 public:
   /** Some limits of the callsign DB. */
@@ -170,7 +170,7 @@ OpenGD77FMAPRSSystemExtension::enableTransmitQSY(bool enable) {
   if (_transmitQSY == enable)
     return;
   _transmitQSY = enable;
-  emit modified(this);
+  emitModified();
 }
 
 unsigned int
@@ -183,6 +183,6 @@ OpenGD77FMAPRSSystemExtension::setBaudRate(unsigned int baudRate) {
   if (_baudRate == baudRate)
     return;
   _baudRate = baudRate;
-  emit modified(this);
+  emitModified();
 }
 
@@ -4,6 +4,8 @@
 #include <QtEndian>
 #include <QDateTime>
 #include <QTimeZone>
+#include <QThread>
+#include <algorithm>
 
 
 #define USB_VID 0x1fc9
@@ -14,6 +16,13 @@
 #define ALIGN_BLOCK_SIZE(n) ((0==((n)%BLOCK_SIZE)) ? (n) : (n)+(BLOCK_SIZE-((n)%BLOCK_SIZE)))
 
 #define TIMEOUT -1 // ms
+#define TRANSFER_TIMEOUT 1000 // ms
+#define DRAIN_TIMEOUT 50 // ms
+
+#define MAX_RETRIES 4
+#define GROW_AFTER  16   // consecutive successful blocks
+#define SLOWDOWN    100  // us, initial delay after a failed block
+#define MAX_DELAY   5000 // us
 
 
 /* ********************************************************************************************* *
@@ -71,8 +80,8 @@ OpenGD77Interface::ReadRequest::initReadFirmwareInfo() {
  * ********************************************************************************************* */
 bool
 OpenGD77Interface::WriteRequest::initWriteEEPROM(Variant variant, uint32_t addr, const uint8_t *data, uint16_t size) {
-  if (size > 32)
-    size = 32;
+  if (size > MAX_BLOCK_SIZE)
+    size = MAX_BLOCK_SIZE;
   this->type = (Variant::GD77 == variant) ? 'W' : 'X';
   this->command = WRITE_EEPROM;
   this->payload.address = qToBigEndian(addr);
@@ -95,8 +104,8 @@ OpenGD77Interface::WriteRequest::initSetFlashSector(Variant variant, uint32_t ad
 
 bool
 OpenGD77Interface::WriteRequest::initWriteFlash(Variant variant, uint32_t addr, const uint8_t *data, uint16_t size) {
-  if (size > 32)
-    size = 32;
+  if (size > MAX_BLOCK_SIZE)
+    size = MAX_BLOCK_SIZE;
   this->type = (Variant::GD77 == variant) ? 'W' : 'X';
   this->command = WRITE_SECTOR_BUFFER;
   logDebug() << "Send WRITE_FLASH_BUFFER (" << this->type << ") @ " << Qt::hex << addr << ".";
@@ -204,8 +213,9 @@ OpenGD77Interface::CommandRequest::initSetDateTime(const QDateTime &dt) {
  * Implementation of OpenGD77Interface
  * ********************************************************************************************* */
 OpenGD77Interface::OpenGD77Interface(const USBDeviceDescriptor &descr, const ErrorStack &err, QObject *parent)
-  : USBSerial(descr, QSerialPort::Baud115200, err, parent), _extendedCallsignDB(false),
-  _sector(-1)
+  : USBSerial(descr, QSerialPort::Baud115200, err, parent), _protocolVariant(Variant::GD77),
+    _extendedCallsignDB(false), _sector(-1), _blockSize(BLOCK_SIZE), _maxBlockSize(BLOCK_SIZE),
+    _confirmedBlockSize(0), _delay(0), _successes(0)
 {
   // pass...
 }
@@ -301,7 +311,6 @@ OpenGD77Interface::write_start(uint32_t bank, uint32_t addr, const ErrorStack &e
   //logDebug() << "Send save settings and VFOs ...";
   if (! sendCommand(CommandRequest::SAVE_SETTINGS_AND_VFOS, err))
     return false;
-
   if (EEPROM == bank) {
     if (_sector >= 0) {
       if (! finishWriteFlash(err))
@@ -321,40 +330,52 @@ OpenGD77Interface::write_start(uint32_t bank, uint32_t addr, const ErrorStack &e
 bool
 OpenGD77Interface::write(uint32_t bank, uint32_t addr, uint8_t *data, int nbytes, const ErrorStack &err)
 {
+  unsigned retries = 0;
+
   if (EEPROM == bank) {
     if ((0 <= _sector) && (! finishWriteFlash(err)))
       return false;
-    for (int i=0; i<nbytes; i+=BLOCK_SIZE) {
-      if (! writeEEPROM(addr+i, data+i, BLOCK_SIZE, err)) {
-        _sector = -1;
-        return false;
+    _sector = -1;
+    // Writing the same block to the EEPROM again is harmless, hence failed blocks are retried
+    for (int i=0; i<nbytes;) {
+      TransferStats::Request request(_stats, TransferStats::Direction::Write, BLOCK_SIZE);
+      ErrorStack attempt;
+      if (! writeEEPROM(addr+i, data+i, BLOCK_SIZE, attempt)) {
+        if (! transferFailed(retries, attempt, err))
+          return false;
+        continue;
       }
+      retries = 0; i += BLOCK_SIZE;
+      transferSucceeded();
     }
     return true;
   }
 
-start:
-  int32_t sector = addr/SECTOR_SIZE;
-
-  if (0 > _sector) {
-    if (! setFlashSector(addr))
-      return false;
-    _sector = sector;
-  }
-
-  if (sector == _sector) {
-    for (int i=0; i<nbytes; i+=BLOCK_SIZE) {
-      if (! writeFlash(addr+i, data+i, BLOCK_SIZE)) {
+  for (int i=0; i<nbytes;) {
+    int32_t sector = (addr+i)/SECTOR_SIZE;
+    if (sector != _sector) {
+      if (0 <= _sector) {
         _sector = -1;
-        return false;
+        if (! finishWriteFlash(err))
+          return false;
       }
+      if (! setFlashSector(addr+i, err))
+        return false;
+      _sector = sector;
     }
-  } else {
-    _sector = -1;
-    if (! finishWriteFlash()) {
+
+    // Flash writes stay at the known-good block size and never cross a sector boundary
+    uint16_t len = std::min({int(BLOCK_SIZE), nbytes-i, int((sector+1)*SECTOR_SIZE-(addr+i))});
+    TransferStats::Request request(_stats, TransferStats::Direction::Write, len);
+    if (! writeFlash(addr+i, data+i, len, err)) {
+      // The firmware may have taken the block partially, hence it is not sent again. The sector
+      // is dropped without finishing it, leaving its content in the flash memory unchanged.
+      errMsg(err) << "Cannot write flash at " << Qt::hex << addr+i << "h: Sector "
+                  << Qt::dec << sector << " discarded.";
+      _sector = -1;
       return false;
     }
-    goto start;
+    i += len;
   }
 
   return true;
@@ -367,6 +388,7 @@ OpenGD77Interface::write_finish(const ErrorStack &err) {
   _sector = -1;
   if (! finishWriteFlash(err))
     return false;
+  logTransferParameters();
   if (! sendCloseScreen(err))
     return false;
   return true;
@@ -392,6 +414,8 @@ OpenGD77Interface::read_start(uint32_t bank, uint32_t addr, const ErrorStack &er
     return false;
   if (! sendCommand(CommandRequest::SAVE_SETTINGS_AND_VFOS, err))
     return false;
+  if (! probeBlockSize(err))
+    return false;
 
   return true;
 }
@@ -403,21 +427,34 @@ OpenGD77Interface::read(uint32_t bank, uint32_t addr, uint8_t *data, int nbytes,
     return false;
   }
 
-  for (int i=0; i<nbytes; i+=BLOCK_SIZE) {
+  if ((EEPROM != bank) && (FLASH != bank)) {
+    errMsg(err) << "Cannot read from bank " << bank << ": Unknown memory bank.";
+    return false;
+  }
+
+  unsigned retries = 0;
+  for (int i=0; i<nbytes;) {
+    uint16_t requested = std::min(int(_blockSize), nbytes-i), len = requested;
+    TransferStats::Request request(_stats, TransferStats::Direction::Read, requested);
+    ErrorStack attempt;
     bool ok;
     if (EEPROM == bank)
-      ok = readEEPROM(addr+i, data+i, BLOCK_SIZE, err);
-    else if (FLASH == bank)
-      ok = readFlash(addr+i, data+i, BLOCK_SIZE, err);
-    else {
-      errMsg(err) << "Cannot read from bank " << bank << ": Unknown memory bank.";
-      return false;
-    }
+      ok = readEEPROM(addr+i, data+i, len, attempt);
+    else
+      ok = readFlash(addr+i, data+i, len, attempt);
 
     if (! ok) {
+      if (transferFailed(retries, attempt, err))
+        continue;
       errMsg(err) << "Cannot read from bank " << bank << ", addr " << Qt::hex << addr+i << "h.";
       return false;
     }
+
+    // The firmware may return less than requested, this is its maximum block size then
+    if (len < requested)
+      limitBlockSize(len);
+    retries = 0; i += len;
+    transferSucceeded();
   }
 
   return true;
@@ -425,6 +462,7 @@ OpenGD77Interface::read(uint32_t bank, uint32_t addr, uint8_t *data, int nbytes,
 
 bool
 OpenGD77Interface::read_finish(const ErrorStack &err) {
+  logTransferParameters();
   if (! sendCloseScreen(err))
     return false;
 
@@ -456,48 +494,34 @@ OpenGD77Interface::reboot(const ErrorStack &err) {
 
 
 bool
-OpenGD77Interface::readEEPROM(uint32_t addr, uint8_t *data, uint16_t len, const ErrorStack &err) {
-  Q_UNUSED(len)
-
+OpenGD77Interface::readEEPROM(uint32_t addr, uint8_t *data, uint16_t &len, const ErrorStack &err) {
   if (! isOpen()) {
     errMsg(err) << "Cannot read block: Device not open!";
     return false;
   }
 
-  ReadRequest req; req.initReadEEPROM(addr, BLOCK_SIZE);
+  ReadRequest req; req.initReadEEPROM(addr, len);
   if (sizeof(ReadRequest) != QSerialPort::write((const char *)&req, sizeof(ReadRequest))) {
     errMsg(err) << "Cannot write to serial port.";
     return false;
   }
 
-  if (! waitForReadyRead(TIMEOUT)) {
-    errMsg(err) << "Cannot read from serial port: Timeout!";
-    return false;
-  }
-
   ReadResponse resp;
-  int retlen = QSerialPort::read((char *)&resp, sizeof(ReadResponse));
-
-  if (0 > retlen) {
-    errMsg(err) << "Cannot read from serial port";
-    return false;
-  } else if (0 == retlen) {
-    errMsg(err) << "Cannot read from serial port: Device returned empty message.";
+  if (! receiveReadResponse(resp, TRANSFER_TIMEOUT, err))
     return false;
-  }
 
   if ('R' != resp.type) {
     errMsg(err) << "Cannot read from device: Device returned error '" << resp.type << "'.";
     return false;
   }
 
-  if (qFromBigEndian(req.length) != qFromBigEndian(resp.length)) {
-    errMsg(err) << "Cannot read from device: Device returned invalid length " <<
-                qFromBigEndian(resp.length) << ".";
+  uint16_t respLen = qFromBigEndian(resp.length);
+  if ((0 == respLen) || (respLen > len)) {
+    errMsg(err) << "Cannot read from device: Device returned invalid length " << respLen << ".";
     return false;
   }
 
-  uint16_t respLen = qFromBigEndian(resp.length);
+  len = respLen;
   memcpy(data, resp.data, respLen);
   logTrace() << "EEPROM read 0x" << QString::number(addr, 16) << " (" << respLen
              << " bytes): " << QByteArray((const char *)data, respLen).toHex(' ');
@@ -515,7 +539,7 @@ OpenGD77Interface::writeEEPROM(uint32_t addr, const uint8_t *data, uint16_t len,
     return false;
   }
 
-  if (! waitForReadyRead(TIMEOUT)) {
+  if (! waitForReadyRead(TRANSFER_TIMEOUT)) {
     errMsg(err) << "Cannot read from serial port: Timeout!";
     return false;
   }
@@ -541,52 +565,36 @@ OpenGD77Interface::writeEEPROM(uint32_t addr, const uint8_t *data, uint16_t len,
 
 
 bool
-OpenGD77Interface::readFlash(uint32_t addr, uint8_t *data, uint16_t len, const ErrorStack &err) {
-  Q_UNUSED(len)
-
+OpenGD77Interface::readFlash(uint32_t addr, uint8_t *data, uint16_t &len, const ErrorStack &err) {
   if (! isOpen()) {
     errMsg(err) << "Cannot read block: Device not open!";
     return false;
   }
 
   ReadRequest req;
-  req.initReadFlash(addr, BLOCK_SIZE);
+  req.initReadFlash(addr, len);
   if (sizeof(ReadRequest) != QSerialPort::write((const char *)&req, sizeof(ReadRequest))) {
     errMsg(err) << QSerialPort::errorString();
     errMsg(err) << "Cannot write to serial port.";
     return false;
   }
 
-  if (! waitForReadyRead(TIMEOUT)) {
-    errMsg(err) << QSerialPort::errorString();
-    errMsg(err) << "Cannot read from serial port: Timeout!";
-    return false;
-  }
-
   ReadResponse resp;
-  int retlen = QSerialPort::read((char *)&resp, sizeof(ReadResponse));
-
-  if (0 > retlen) {
-    errMsg(err) << QSerialPort::errorString();
-    errMsg(err) << "Cannot read from serial port.";
+  if (! receiveReadResponse(resp, TRANSFER_TIMEOUT, err))
     return false;
-  } else if (0 == retlen) {
-    errMsg(err) << "Cannot read from serial port: Device returned empty message.";
-    return false;
-  }
 
   if ('R' != resp.type) {
     errMsg(err) << "Cannot read from device: Device returned error " << resp.type << ".";
     return false;
   }
 
-  if (qFromBigEndian(req.length) != qFromBigEndian(resp.length)) {
-    errMsg(err) << "Cannot read from device: Device returned invalid length "
-                << qFromBigEndian(resp.length) << ".";
+  uint16_t respLen = qFromBigEndian(resp.length);
+  if ((0 == respLen) || (respLen > len)) {
+    errMsg(err) << "Cannot read from device: Device returned invalid length " << respLen << ".";
     return false;
   }
 
-  uint16_t respLen = qFromBigEndian(resp.length);
+  len = respLen;
   memcpy(data, resp.data, respLen);
   logTrace() << "FLASH read 0x" << QString::number(addr, 16) << " (" << respLen
              << " bytes): " << QByteArray((const char *)data, respLen).toHex(' ');
@@ -640,7 +648,7 @@ OpenGD77Interface::writeFlash(uint32_t addr, const uint8_t *data, uint16_t len,
     return false;
   }
 
-  if (! waitForReadyRead(TIMEOUT)) {
+  if (! waitForReadyRead(TRANSFER_TIMEOUT)) {
     errMsg(err) << QSerialPort::errorString();
     errMsg(err) << "Cannot read from serial port: Timeout!";
     return false;
@@ -739,6 +747,115 @@ OpenGD77Interface::readFirmwareInfo(OpenGD77Interface::FirmwareInfo &radioInfo,
   return true;
 }
 
+bool
+OpenGD77Interface::receiveReadResponse(ReadResponse &resp, int timeout, const ErrorStack &err) {
+  char *buffer = (char *)&resp;
+  int received = 0, expected = 3;
+  while (received < expected) {
+    if ((0 == bytesAvailable()) && (! waitForReadyRead(timeout))) {
+      errMsg(err) << "Cannot read from serial port: Timeout!";
+      return false;
+    }
+    int retlen = QSerialPort::read(buffer+received, sizeof(ReadResponse)-received);
+    if (0 > retlen) {
+      errMsg(err) << QSerialPort::errorString();
+      errMsg(err) << "Cannot read from serial port.";
+      return false;
+    }
+    received += retlen;
+    // An error response consists of the type only
+    if ((1 <= received) && ('R' != resp.type))
+      break;
+    // Once the header is complete, the payload size is known
+    if (3 <= received)
+      expected = 3 + std::min(int(qFromBigEndian(resp.length)), int(MAX_BLOCK_SIZE));
+  }
+  return true;
+}
+
+bool
+OpenGD77Interface::probeBlockSize(const ErrorStack &err) {
+  Q_UNUSED(err);
+
+  if (_confirmedBlockSize)
+    return true;
+
+  // Request the largest block and halve on failure. A firmware limiting the block size returns
+  // a short response, which is then taken as the maximum.
+  uint8_t buffer[MAX_BLOCK_SIZE];
+  for (uint16_t size=MAX_BLOCK_SIZE; size>BLOCK_SIZE; size/=2) {
+    uint16_t len = size;
+    if (readFlash(0, buffer, len)) {
+      _confirmedBlockSize = _maxBlockSize = std::max(uint16_t(BLOCK_SIZE), len);
+      break;
+    }
+    while (waitForReadyRead(DRAIN_TIMEOUT))
+      QSerialPort::readAll();
+  }
+  if (0 == _confirmedBlockSize)
+    _confirmedBlockSize = _maxBlockSize = BLOCK_SIZE;
+
+  _blockSize = BLOCK_SIZE; _delay = 0; _successes = 0;
+  logInfo() << "OpenGD77 (" << ((Variant::GD77 == _protocolVariant) ? "GD77" : "UV380")
+            << " protocol): Maximum transfer block size " << _maxBlockSize << "b.";
+  return true;
+}
+
+void
+OpenGD77Interface::transferSucceeded() {
+  if (_delay)
+    QThread::usleep(_delay);
+
+  if (++_successes < GROW_AFTER)
+    return;
+  _successes = 0;
+
+  if (_delay) {
+    _delay = (_delay > SLOWDOWN) ? _delay/2 : 0;
+  } else if (_blockSize < _maxBlockSize) {
+    _blockSize = std::min(uint16_t(2*_blockSize), _maxBlockSize);
+    logDebug() << "Increased block size to " << _blockSize << "b.";
+  }
+}
+
+bool
+OpenGD77Interface::transferFailed(unsigned &retries, const ErrorStack &attempt, const ErrorStack &err) {
+  _successes = 0;
+  _blockSize = std::max(uint16_t(BLOCK_SIZE), uint16_t(_blockSize/2));
+  _delay = _delay ? std::min(2*_delay, unsigned(MAX_DELAY)) : SLOWDOWN;
+  logDebug() << "Block transfer failed: " << attempt.format() << " Back off to block size "
+             << _blockSize << "b, delay " << _delay << "us.";
+
+  // Drop any late response, otherwise it would be taken as the response to the next request
+  while (waitForReadyRead(DRAIN_TIMEOUT))
+    QSerialPort::readAll();
+
+  if (++retries <= MAX_RETRIES) {
+    if (_stats)
+      _stats->addRetry();
+    return true;
+  }
+
+  err.take(attempt);
+  return false;
+}
+
+void
+OpenGD77Interface::limitBlockSize(uint16_t len) {
+  if (len >= _maxBlockSize)
+    return;
+  _maxBlockSize = _blockSize = std::max(uint16_t(BLOCK_SIZE), len);
+  logDebug() << "Device limits block size to " << _maxBlockSize << "b.";
+}
+
+void
+OpenGD77Interface::logTransferParameters() const {
+  logInfo() << "OpenGD77 (" << ((Variant::GD77 == _protocolVariant) ? "GD77" : "UV380")
+            << " protocol) transfer parameters: block size " << _blockSize << "b (max. "
+            << _maxBlockSize << "b), delay "
+            << _delay << "us.";
+}
+
 bool
 OpenGD77Interface::sendShowCPSScreen(const ErrorStack &err) {
   CommandRequest req;
@@ -150,6 +150,13 @@
  *
  * @section ogd77write Write requests
  *
+ * @section ogd77flow Flow control
+ * Reads and flash writes are not sent in fixed 32-byte blocks. Once the CPS screen is shown, the
+ * interface probes the largest block the firmware answers in full. Starting at 32 bytes, the block
+ * size then grows up to that maximum as long as the round-trips succeed. On a NAK, a short response
+ * or a timeout, the block is retried with half the block size and an increasing delay between
+ * blocks. EEPROM writes are always sent in 32-byte blocks.
+ *
  * @ingroup ogd77 */
 class OpenGD77Interface : public USBSerial
 {
@@ -166,6 +173,9 @@ public:
     GD77, UV380
   };
 
+  /** The largest block size ever requested from the firmware. */
+  static const uint16_t MAX_BLOCK_SIZE = 1024;
+
 public:
   /** Constructs a new interface to a specific OpenGD77 device.  */
   explicit OpenGD77Interface(const USBDeviceDescriptor &descr,
@@ -266,7 +276,7 @@ protected:
     uint16_t length;
     /// Payload
     union {
-      uint8_t data[32];    ///< Data payload.
+      uint8_t data[MAX_BLOCK_SIZE]; ///< Data payload.
       FirmwareInfo info;   ///< Firmware information struct.
     };
   };
@@ -297,7 +307,7 @@ protected:
         /** Payload length. */
         uint16_t length;
         /** Payload data. */
-        uint8_t data[32];
+        uint8_t data[MAX_BLOCK_SIZE];
       } payload;
     };
 
@@ -391,13 +401,15 @@ protected:
   };
 
 protected:
-  /** Read some data from EEPROM at the given address. */
-  bool readEEPROM(uint32_t addr, uint8_t *data, uint16_t len, const ErrorStack &err=ErrorStack());
+  /** Read some data from EEPROM at the given address. On exit, @c len holds the number of bytes
+   * actually returned by the device, which may be less than requested. */
+  bool readEEPROM(uint32_t addr, uint8_t *data, uint16_t &len, const ErrorStack &err=ErrorStack());
   /** Write some data to EEPROM at the given address. */
   bool writeEEPROM(uint32_t addr, const uint8_t *data, uint16_t len, const ErrorStack &err=ErrorStack());
 
-  /** Read some data from Flash at the given address. */
-  bool readFlash(uint32_t addr, uint8_t *data, uint16_t len, const ErrorStack &err=ErrorStack());
+  /** Read some data from Flash at the given address. On exit, @c len holds the number of bytes
+   * actually returned by the device, which may be less than requested. */
+  bool readFlash(uint32_t addr, uint8_t *data, uint16_t &len, const ErrorStack &err=ErrorStack());
   /** Select the correct Flash sector for the given address.
    * This command must be sent before writing to the flash memory. */
   bool setFlashSector(uint32_t addr, const ErrorStack &err=ErrorStack());
@@ -409,6 +421,22 @@ protected:
 
   /** Read radio info struct. */
   bool readFirmwareInfo(FirmwareInfo &radioInfo, const ErrorStack &err=ErrorStack());
+  /** Receives a read response, which may arrive in several chunks. */
+  bool receiveReadResponse(ReadResponse &resp, int timeout, const ErrorStack &err=ErrorStack());
+
+  /** Determines the largest block the firmware answers in full. Only done once per connection. */
+  bool probeBlockSize(const ErrorStack &err=ErrorStack());
+  /** Registers a successful block transfer. After some consecutive successes, the delay between
+   * blocks is reduced first, then the block size is doubled. */
+  void transferSucceeded();
+  /** Registers a failed block transfer (NAK or timeout). Halves the block size, increases the
+   * delay between blocks and drains any late response. Returns @c false, if the transfer should
+   * not be retried. In this case, the errors of the last attempt are put onto @c err. */
+  bool transferFailed(unsigned &retries, const ErrorStack &attempt, const ErrorStack &err);
+  /** Limits the block size to the given number of bytes returned by the firmware. */
+  void limitBlockSize(uint16_t len);
+  /** Logs the current transfer parameters. */
+  void logTransferParameters() const;
 
   /** Send a "show CPS screen" message. */
   bool sendShowCPSScreen(const ErrorStack &err=ErrorStack());
@@ -433,6 +461,16 @@ protected:
   bool _extendedCallsignDB;
   /** The current Flash sector, set to -1 if none is currently selected. */
   int32_t _sector;
+  /** The current block size for reads. */
+  uint16_t _blockSize;
+  /** The largest block size accepted by the firmware. */
+  uint16_t _maxBlockSize;
+  /** The largest block size confirmed by a complete read response, 0 if not probed yet. */
+  uint16_t _confirmedBlockSize;
+  /** Delay between blocks in micro seconds. */
+  unsigned _delay;
+  /** Number of consecutive successful block transfers. */
+  unsigned _successes;
 };
 
 #endif // OPENGD77INTERFACE_HH
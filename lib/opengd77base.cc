@@ -3,10 +3,11 @@
 #include "opengd77_limits.hh"
 #include "logger.hh"
 #include "config.hh"
+#include <algorithm>
 
 
 #define BSIZE 32
-#define SLOWDOWN 100 // us
+#define CHUNK 1024 // bytes per transfer request, split into blocks by the interface
 
 
 RadioLimits *OpenGD77Base::_limits = nullptr;
@@ -14,7 +15,8 @@ RadioLimits *OpenGD77Base::_limits = nullptr;
 OpenGD77Base::OpenGD77Base(OpenGD77Interface *device, QObject *parent)
   : Radio(parent), _dev(device), _flags(), _config(nullptr), _satelliteConfig(nullptr)
 {
-  // pass...
+  if (_dev)
+    _dev->setStats(&_stats);
 }
 
 OpenGD77Base::~OpenGD77Base() {
@@ -163,6 +165,8 @@ OpenGD77Base::startUploadSatelliteConfig(SatelliteDatabase *db, const TransferFl
 
 void
 OpenGD77Base::run() {
+  TransferStats::Session session(_stats);
+
   if (StatusDownload == _task) {
     if ((nullptr==_dev) || (! _dev->isOpen())) {
       emit downloadError(this);
@@ -272,6 +276,7 @@ OpenGD77Base::download()
   }
 
   // Then download codeplug
+  _stats.beginPhase("read");
   size_t bcount = 0;
   for (int image=0; image<codeplug().numImages(); image++) {
     uint32_t bank = (0 == image) ? OpenGD77BaseCodeplug::EEPROM : OpenGD77BaseCodeplug::FLASH;
@@ -279,15 +284,14 @@ OpenGD77Base::download()
     for (int n=0; n<codeplug().image(image).numElements(); n++) {
       unsigned addr = codeplug().image(image).element(n).address();
       unsigned size = codeplug().image(image).element(n).data().size();
-      unsigned b0 = addr/BSIZE, nb = size/BSIZE;
       logDebug() << "Read " << size << "h bytes from bank " << bank
                  << " @ addr " << Qt::hex << addr << "h.";
-      for (unsigned b=0; b<nb; b++, bcount+=BSIZE) {
-        if (! _dev->read(bank, (b0+b)*BSIZE, codeplug().data((b0+b)*BSIZE, image), BSIZE, _errorStack)) {
-          errMsg(_errorStack) << "Cannot read block " << (b0+b) << ".";
+      for (unsigned o=0, len=0; o<size; o+=len, bcount+=len) {
+        len = std::min(unsigned(CHUNK), size-o);
+        if (! _dev->read(bank, addr+o, codeplug().data(addr+o, image), len, _errorStack)) {
+          errMsg(_errorStack) << "Cannot read block " << (addr+o)/BSIZE << ".";
           return false;
         }
-        QThread::usleep(SLOWDOWN);
         emit downloadProgress(float(bcount*100)/totb);
       }
     }
@@ -331,6 +335,7 @@ OpenGD77Base::upload()
   }
 
   // Then download codeplug
+  _stats.beginPhase("read");
   size_t bcount = 0;
   for (int image=0; image<codeplug().numImages(); image++) {
     uint32_t bank = ( (0 == image) ? OpenGD77BaseCodeplug::EEPROM : OpenGD77BaseCodeplug::FLASH );
@@ -338,15 +343,14 @@ OpenGD77Base::upload()
     for (int n=0; n<codeplug().image(image).numElements(); n++) {
       unsigned addr = codeplug().image(image).element(n).address();
       unsigned size = codeplug().image(image).element(n).data().size();
-      unsigned b0 = addr/BSIZE, nb = size/BSIZE;
       logDebug() << "Read " << size << "h bytes from bank " << bank
                  << " @ addr " << Qt::hex << addr << "h.";
-      for (unsigned b=0; b<nb; b++, bcount+=BSIZE) {
-        if (! _dev->read(bank, (b0+b)*BSIZE, codeplug().data((b0+b)*BSIZE, image), BSIZE, _errorStack)) {
-          errMsg(_errorStack) << "Cannot read block " << Qt::hex << (b0+b) << "h.";
+      for (unsigned o=0, len=0; o<size; o+=len, bcount+=len) {
+        len = std::min(unsigned(CHUNK), size-o);
+        if (! _dev->read(bank, addr+o, codeplug().data(addr+o, image), len, _errorStack)) {
+          errMsg(_errorStack) << "Cannot read block " << Qt::hex << (addr+o)/BSIZE << "h.";
           return false;
         }
-        QThread::usleep(SLOWDOWN);
         emit uploadProgress(float(bcount*50)/totb);
       }
     }
@@ -356,6 +360,7 @@ OpenGD77Base::upload()
   }
 
   // Encode config into codeplug
+  _stats.beginPhase("encode");
   codeplug().encode(_config);
 
   if (! _dev->write_start(0,0, _errorStack)) {
@@ -364,21 +369,21 @@ OpenGD77Base::upload()
   }
 
   // Then upload codeplug
+  _stats.beginPhase("write");
   for (int image=0; image<codeplug().numImages(); image++) {
     uint32_t bank = (0 == image) ? OpenGD77BaseCodeplug::EEPROM : OpenGD77BaseCodeplug::FLASH;
 
     for (int n=0; n<codeplug().image(image).numElements(); n++) {
       unsigned addr = codeplug().image(image).element(n).address();
       unsigned size = codeplug().image(image).element(n).data().size();
-      unsigned b0 = addr/BSIZE, nb = size/BSIZE;
       logDebug() << "Write " << size << "h bytes from bank " << bank
                  << " @ addr " << Qt::hex << addr << "h.";
-      for (unsigned b=0; b<nb; b++, bcount+=BSIZE) {
-        if (! _dev->write(bank, (b0+b)*BSIZE, codeplug().data((b0+b)*BSIZE, image), BSIZE, _errorStack)) {
-          errMsg(_errorStack) << "Cannot write block " << (b0+b) << ".";
+      for (unsigned o=0, len=0; o<size; o+=len, bcount+=len) {
+        len = std::min(unsigned(CHUNK), size-o);
+        if (! _dev->write(bank, addr+o, codeplug().data(addr+o, image), len, _errorStack)) {
+          errMsg(_errorStack) << "Cannot write block " << (addr+o)/BSIZE << ".";
           return false;
         }
-        QThread::usleep(SLOWDOWN);
         emit uploadProgress(float(bcount*50)/totb);
       }
     }
@@ -415,15 +420,16 @@ OpenGD77Base::uploadCallsigns()
 
   unsigned bcount = 0;
   // Then upload callsign DB
+  _stats.beginPhase("write");
   for (int n=0; n<callsignDB()->image(0).numElements(); n++) {
     unsigned addr = callsignDB()->image(0).element(n).address();
     unsigned size = callsignDB()->image(0).element(n).data().size();
-    unsigned b0 = addr/BSIZE, nb = size/BSIZE;
-    for (unsigned b=0; b<nb; b++, bcount+=BSIZE) {
-      if (! _dev->write(OpenGD77BaseCodeplug::FLASH, (b0+b)*BSIZE,
-                        callsignDB()->data((b0+b)*BSIZE, 0), BSIZE, _errorStack))
+    for (unsigned o=0, len=0; o<size; o+=len, bcount+=len) {
+      len = std::min(unsigned(CHUNK), size-o);
+      if (! _dev->write(OpenGD77BaseCodeplug::FLASH, addr+o,
+                        callsignDB()->data(addr+o, 0), len, _errorStack))
       {
-        errMsg(_errorStack) << "Cannot write block " << (b0+b) << ".";
+        errMsg(_errorStack) << "Cannot write block " << (addr+o)/BSIZE << ".";
         return false;
       }
       emit uploadProgress(float(bcount*100)/totb);
@@ -458,17 +464,17 @@ OpenGD77Base::uploadSatellites()
   }
 
   // Then download satellite config
+  _stats.beginPhase("read");
   size_t bcount = 0;
   for (int n=0; n<_satelliteConfig->image(OpenGD77BaseSatelliteConfig::FLASH).numElements(); n++) {
     unsigned addr = _satelliteConfig->image(OpenGD77BaseSatelliteConfig::FLASH).element(n).address();
       unsigned size = _satelliteConfig->image(OpenGD77BaseSatelliteConfig::FLASH).element(n).data().size();
-      unsigned b0 = addr/BSIZE, nb = size/BSIZE;
-      for (unsigned b=0; b<nb; b++, bcount+=BSIZE) {
-        if (! _dev->read(OpenGD77BaseSatelliteConfig::FLASH, (b0+b)*BSIZE, _satelliteConfig->data((b0+b)*BSIZE, OpenGD77BaseSatelliteConfig::FLASH), BSIZE, _errorStack)) {
-          errMsg(_errorStack) << "Cannot read block " << (b0+b) << ".";
+      for (unsigned o=0, len=0; o<size; o+=len, bcount+=len) {
+        len = std::min(unsigned(CHUNK), size-o);
+        if (! _dev->read(OpenGD77BaseSatelliteConfig::FLASH, addr+o, _satelliteConfig->data(addr+o, OpenGD77BaseSatelliteConfig::FLASH), len, _errorStack)) {
+          errMsg(_errorStack) << "Cannot read block " << (addr+o)/BSIZE << ".";
           return false;
         }
-        QThread::usleep(SLOWDOWN);
         emit uploadProgress(float(bcount*50)/totb);
       }
   }
@@ -482,6 +488,7 @@ OpenGD77Base::uploadSatellites()
   }
 
   // Encode config into codeplug
+  _stats.beginPhase("encode");
   if (! _satelliteConfig->encode(_satelliteDatabase, _errorStack)) {
     errMsg(_errorStack) << "Cannot encode satellite config.";
     return false;
@@ -493,17 +500,16 @@ OpenGD77Base::uploadSatellites()
   }
 
   // Then upload satellite config
+  _stats.beginPhase("write");
   for (int n=0; n<_satelliteConfig->image(OpenGD77BaseSatelliteConfig::FLASH).numElements(); n++) {
     unsigned addr = _satelliteConfig->image(OpenGD77BaseSatelliteConfig::FLASH).element(n).address();
     unsigned size = _satelliteConfig->image(OpenGD77BaseSatelliteConfig::FLASH).element(n).data().size();
-    unsigned b0 = addr/BSIZE, nb = size/BSIZE;
-
-    for (unsigned b=0; b<nb; b++, bcount+=BSIZE) {
-      if (! _dev->write(OpenGD77BaseSatelliteConfig::FLASH, (b0+b)*BSIZE, _satelliteConfig->data((b0+b)*BSIZE, OpenGD77BaseSatelliteConfig::FLASH), BSIZE, _errorStack)) {
-        errMsg(_errorStack) << "Cannot write block " << (b0+b) << ".";
+    for (unsigned o=0, len=0; o<size; o+=len, bcount+=len) {
+      len = std::min(unsigned(CHUNK), size-o);
+      if (! _dev->write(OpenGD77BaseSatelliteConfig::FLASH, addr+o, _satelliteConfig->data(addr+o, OpenGD77BaseSatelliteConfig::FLASH), len, _errorStack)) {
+        errMsg(_errorStack) << "Cannot write block " << (addr+o)/BSIZE << ".";
         return false;
       }
-      QThread::usleep(SLOWDOWN);
       emit uploadProgress(float(bcount*50)/totb);
     }
   }
@@ -50,17 +50,17 @@ OpenGD77BaseCallsignDB::DatabaseEntryElement::setText(const QString &text) {
 bool
 OpenGD77BaseCallsignDB::DatabaseEntryElement::fromEntry(const UserDatabase::User &user) {
   clear();
-  setId(user.id);
+  setId(user.id());
 
   QString txt;
   QTextStream stream(&txt);
-  stream << user.call << " " << user.name;
-  if (! user.city.isEmpty())
-    stream << " " << user.city;
-  if (! user.state.isEmpty())
-    stream << " " << user.state;
-  if (! user.country.isEmpty())
-    stream << " " << user.country;
+  stream << user.call() << " " << user.name();
+  if (! user.city().isEmpty())
+    stream << " " << user.city();
+  if (! user.state().isEmpty())
+    stream << " " << user.state();
+  if (! user.country().isEmpty())
+    stream << " " << user.country();
   setText(txt);
 
   return true;
@@ -40,6 +40,11 @@ OpenUV380CallsignDB::OpenUV380CallsignDB(bool extended, QObject *parent)
 }
 
 
+unsigned int
+OpenUV380CallsignDB::maxEntries() const {
+  return Limit::entries();
+}
+
 bool
 OpenUV380CallsignDB::encode(UserDatabase *calldb, const Flags &selection, const ErrorStack &err) {
   Q_UNUSED(err)
@@ -59,11 +64,11 @@ OpenUV380CallsignDB::encode(UserDatabase *calldb, const Flags &selection, const
   for (unsigned i=0; i<n; i++)
     users.append(calldb->user(i));
   std::sort(users.begin(), users.end(),
-            [](const UserDatabase::User &a, const UserDatabase::User &b) { return a.id < b.id; });
+            [](const UserDatabase::User &a, const UserDatabase::User &b) { return a.id() < b.id(); });
   if (n)
     logDebug() << "Store " << n << " entries for OpenUV380 starting from "
-               << users.front().id << ":" << users.front().call << ", " << users.front().name << " in " << users.front().city
-               << " to " << users.back().id << ":" << users.back().call << ", " << users.back().name << " in " << users.back().city;
+               << users.front().id() << ":" << users.front().call() << ", " << users.front().name() << " in " << users.front().city()
+               << " to " << users.back().id() << ":" << users.back().call() << ", " << users.back().name() << " in " << users.back().city();
 
   // Allocate segment0 for user db if requested
   unsigned size = align_size(DatabaseHeaderElement::size()+n0*DatabaseEntryElement::size(),
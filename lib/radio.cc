@@ -264,3 +264,8 @@ const ErrorStack &
 Radio::errorStack() const {
   return _errorStack;
 }
+
+const TransferStats &
+Radio::stats() const {
+  return _stats;
+}
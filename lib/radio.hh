@@ -16,6 +16,7 @@
 #include "callsigndb.hh"
 #include "errorstack.hh"
 #include "config.hh"
+#include "transferstats.hh"
 
 class RadioLimits;
 
@@ -75,6 +76,8 @@ public:
   /** Returns the error stack, passed to @c startDownload, @c startUpload or
    * @c startUploadCallsignDB. It contains the error messages from the upload/download process. */
   const ErrorStack &errorStack() const;
+  /** Returns the telemetry of the current or last transfer. */
+  const TransferStats &stats() const;
 
 public:
   /** Tries to detect the radio connected to the specified interface or constructs the specified
@@ -127,6 +130,8 @@ protected:
   Status _task;
   /** The error stack. */
   ErrorStack _errorStack;
+  /** Telemetry of the current or last transfer. */
+  TransferStats _stats;
 };
 
 #endif // RADIO_HH
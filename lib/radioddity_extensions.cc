@@ -31,7 +31,7 @@ RadioddityButtonSettingsExtension::setLongPressDuration(Interval interval) {
   if (interval == _longPressDuration)
     return;
   _longPressDuration = interval;
-  emit modified(this);
+  emitModified();
 }
 
 RadioddityButtonSettingsExtension::Function
@@ -43,7 +43,7 @@ RadioddityButtonSettingsExtension::setFuncKey1Short(Function func) {
   if (func == _funcKey1Short)
     return;
   _funcKey1Short = func;
-  emit modified(this);
+  emitModified();
 }
 RadioddityButtonSettingsExtension::Function
 RadioddityButtonSettingsExtension::funcKey1Long() const {
@@ -54,7 +54,7 @@ RadioddityButtonSettingsExtension::setFuncKey1Long(Function func) {
   if (func == _funcKey1Long)
     return;
   _funcKey1Long = func;
-  emit modified(this);
+  emitModified();
 }
 
 RadioddityButtonSettingsExtension::Function
@@ -66,7 +66,7 @@ RadioddityButtonSettingsExtension::setFuncKey2Short(Function func) {
   if (func == _funcKey2Short)
     return;
   _funcKey2Short = func;
-  emit modified(this);
+  emitModified();
 }
 RadioddityButtonSettingsExtension::Function
 RadioddityButtonSettingsExtension::funcKey2Long() const {
@@ -77,7 +77,7 @@ RadioddityButtonSettingsExtension::setFuncKey2Long(Function func) {
   if (func == _funcKey2Long)
     return;
   _funcKey2Long = func;
-  emit modified(this);
+  emitModified();
 }
 
 RadioddityButtonSettingsExtension::Function
@@ -89,7 +89,7 @@ RadioddityButtonSettingsExtension::setFuncKey3Short(Function func) {
   if (func == _funcKey3Short)
     return;
   _funcKey3Short = func;
-  emit modified(this);
+  emitModified();
 }
 RadioddityButtonSettingsExtension::Function
 RadioddityButtonSettingsExtension::funcKey3Long() const {
@@ -100,7 +100,7 @@ RadioddityButtonSettingsExtension::setFuncKey3Long(Function func) {
   if (func == _funcKey3Long)
     return;
   _funcKey3Long = func;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -134,7 +134,7 @@ RadioddityToneSettingsExtension::enableLowBatteryWarn(bool enable) {
   if (enable == _lowBatteryWarn)
     return;
   _lowBatteryWarn = enable;
-  emit modified(this);
+  emitModified();
 }
 
 Interval
@@ -146,7 +146,7 @@ RadioddityToneSettingsExtension::setLowBatteryWarnInterval(Interval sec) {
   if (_lowBatteryWarnInterval == sec)
     return;
   _lowBatteryWarnInterval = sec;
-  emit modified(this);
+  emitModified();
 }
 
 unsigned int
@@ -159,7 +159,7 @@ RadioddityToneSettingsExtension::setLowBatteryWarnVolume(unsigned int volume) {
   if (volume == _lowBatteryWarnVolume)
     return;
   _lowBatteryWarnVolume = volume;
-  emit modified(this);
+  emitModified();
 }
 
 Interval
@@ -171,7 +171,7 @@ RadioddityToneSettingsExtension::setCallAlertDuration(Interval sec) {
   if (_callAlertDuration == sec)
     return;
   _callAlertDuration = sec;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -183,7 +183,7 @@ RadioddityToneSettingsExtension::enableUnknownNumberTone(bool enable) {
   if (_unknownNumberTone == enable)
     return;
   _unknownNumberTone = enable;
-  emit modified(this);
+  emitModified();
 }
 
 RadioddityToneSettingsExtension::ARTSTone
@@ -195,7 +195,7 @@ RadioddityToneSettingsExtension::setARTSToneMode(ARTSTone mode) {
   if (_artsToneMode == mode)
     return;
   _artsToneMode = mode;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -207,7 +207,7 @@ RadioddityToneSettingsExtension::enableSelftestTone(bool enable) {
   if (_selftestTone == enable)
     return;
   _selftestTone = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -240,7 +240,7 @@ RadioddityBootSettingsExtension::setProgPassword(const QString &pwd) {
   if (_progPasswd == pwd)
     return;
   _progPasswd = pwd;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -283,7 +283,7 @@ RadiodditySettingsExtension::setMonitorType(MonitorType type) {
   if (_monitorType == type)
     return;
   _monitorType = type;
-  emit modified(this);
+  emitModified();
 }
 
 Interval
@@ -295,7 +295,7 @@ RadiodditySettingsExtension::setLoneWorkerResponseTime(Interval min) {
   if (_loneWorkerResponseTime == min)
     return;
   _loneWorkerResponseTime = min;
-  emit modified(this);
+  emitModified();
 }
 
 Interval
@@ -307,7 +307,7 @@ RadiodditySettingsExtension::setLoneWorkerReminderPeriod(Interval sec) {
   if (_loneWorkerReminderPeriod == sec)
     return;
   _loneWorkerReminderPeriod = sec;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -320,7 +320,7 @@ RadiodditySettingsExtension::enableDownChannelModeVFO(bool enable) {
   if (_downChannelModeVFO == enable)
     return;
   _downChannelModeVFO = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -332,7 +332,7 @@ RadiodditySettingsExtension::enableUpChannelModeVFO(bool enable) {
   if (_upChannelModeVFO == enable)
     return;
   _upChannelModeVFO = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -344,7 +344,7 @@ RadiodditySettingsExtension::enablePowerSaveMode(bool enable) {
   if (_powerSaveMode == enable)
     return;
   _powerSaveMode = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -356,7 +356,7 @@ RadiodditySettingsExtension::enableWakeupPreamble(bool enable) {
   if (_wakeupPreamble == enable)
     return;
   _wakeupPreamble = enable;
-  emit modified(this);
+  emitModified();
 }
 
 Interval
@@ -368,7 +368,7 @@ RadiodditySettingsExtension::setPowerSaveDelay(Interval interv) {
   if (interv == _powerSaveDelay)
     return;
   _powerSaveDelay = interv;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -380,7 +380,7 @@ RadiodditySettingsExtension::disableAllLEDs(bool disable) {
   if (_disableAllLEDs == disable)
     return;
   _disableAllLEDs = disable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -392,7 +392,7 @@ RadiodditySettingsExtension::inhibitQuickKeyOverride(bool inhibit) {
   if (_quickKeyOverrideInhibited == inhibit)
     return;
   _quickKeyOverrideInhibited = inhibit;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -404,7 +404,7 @@ RadiodditySettingsExtension::enableTXOnActiveChannel(bool enable) {
   if (_txOnActiveChannel == enable)
     return;
   _txOnActiveChannel = enable;
-  emit modified(this);
+  emitModified();
 }
 
 RadiodditySettingsExtension::ScanMode
@@ -416,7 +416,7 @@ RadiodditySettingsExtension::setScanMode(ScanMode mode) {
   if (_scanMode == mode)
     return;
   _scanMode = mode;
-  emit modified(this);
+  emitModified();
 }
 
 Interval
@@ -428,7 +428,7 @@ RadiodditySettingsExtension::setRepeaterEndDelay(Interval delay) {
   if (_repeaterEndDelay == delay)
     return;
   _repeaterEndDelay = delay;
-  emit modified(this);
+  emitModified();
 }
 
 Interval
@@ -440,7 +440,7 @@ RadiodditySettingsExtension::setRepeaterSTE(Interval ste) {
   if (_repeaterSTE == ste)
     return;
   _repeaterSTE = ste;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -452,7 +452,7 @@ RadiodditySettingsExtension::enableTXInterrupt(bool enable) {
   if (enable == _txInterrupt)
     return;
   _txInterrupt = enable;
-  emit modified(this);
+  emitModified();
 }
 
 RadiodditySettingsExtension::Language
@@ -464,7 +464,7 @@ RadiodditySettingsExtension::setLanguage(Language lang) {
   if (lang == _language)
     return;
   _language = lang;
-  emit modified(this);
+  emitModified();
 }
 
 RadioddityButtonSettingsExtension *
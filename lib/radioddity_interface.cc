@@ -141,6 +141,7 @@ RadioddityInterface::read(uint32_t bank, uint32_t addr, unsigned char *data, int
 
   // send data
   for (n=0; n<nbytes; n+=32) {
+    TransferStats::Request request(_stats, TransferStats::Direction::Read, 32);
     cmd[0] = CMD_READ[0];
     cmd[1] = (addr + n) >> 8;
     cmd[2] = addr + n;
@@ -202,6 +203,7 @@ RadioddityInterface::write(uint32_t bank, uint32_t addr, unsigned char *data, in
   // send data
   unsigned int count=0;
   for (int n=0; n<nbytes; n+=32) {
+    TransferStats::Request request(_stats, TransferStats::Direction::Write, 32);
     cmd[0] = CMD_WRITE[0];
     cmd[1] = (addr + n) >> 8;
     cmd[2] = addr + n;
@@ -218,6 +220,8 @@ RadioddityInterface::write(uint32_t bank, uint32_t addr, unsigned char *data, in
         errMsg(err) << "Maximum retry count reached. Abort.";
         return false;
       }
+      if (_stats)
+        _stats->addRetry();
     } else {
       count = 0;
     }
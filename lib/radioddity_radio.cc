@@ -6,10 +6,11 @@
 #define BSIZE           32
 
 
-RadioddityRadio::RadioddityRadio(RadioddityInterface *device, QObject *parent)
+RadioddityRadio::RadioddityRadio(RadioInterface *device, QObject *parent)
   : Radio(parent), _dev(device), _codeplugFlags(), _config(nullptr)
 {
-  // pass...
+  if (_dev)
+    _dev->setStats(&_stats);
 }
 
 RadioddityRadio::~RadioddityRadio() {
@@ -19,7 +20,11 @@ RadioddityRadio::~RadioddityRadio() {
     _dev->close();
   }
   if (_dev) {
-    _dev->deleteLater();
+    // All interfaces are QObjects, which may still be used by the event loop of their thread.
+    if (QObject *obj = dynamic_cast<QObject *>(_dev))
+      obj->deleteLater();
+    else
+      delete _dev;
     _dev = nullptr;
   }
 }
@@ -88,6 +93,8 @@ RadioddityRadio::startUploadSatelliteConfig(SatelliteDatabase *db, const Transfe
 
 void
 RadioddityRadio::run() {
+  TransferStats::Session session(_stats);
+
   if (StatusDownload == _task) {
     if ((nullptr==_dev) || (! _dev->isOpen())) {
       emit downloadError(this);
@@ -151,6 +158,7 @@ RadioddityRadio::run() {
 bool
 RadioddityRadio::download() {
   emit downloadStarted();
+  _stats.beginPhase("read");
 
   unsigned btot = 0;
   for (int n=0; n<codeplug().image(0).numElements(); n++) {
@@ -191,6 +199,7 @@ RadioddityRadio::upload() {
   unsigned bcount = 0;
   if (_codeplugFlags.updateCodeplug()) {
     // If codeplug gets updated, download codeplug from device first:
+    _stats.beginPhase("read");
     for (int n=0; n<codeplug().image(0).numElements(); n++) {
       int b0 = codeplug().image(0).element(n).address()/BSIZE;
       int nb = codeplug().image(0).element(n).data().size()/BSIZE;
@@ -210,12 +219,14 @@ RadioddityRadio::upload() {
   }
 
   // Encode config into codeplug
+  _stats.beginPhase("encode");
   if (! codeplug().encode(_config, _codeplugFlags, _errorStack)) {
     errMsg(_errorStack) << "Codeplug upload failed.";
     return false;
   }
 
   // then, upload modified codeplug
+  _stats.beginPhase("write");
   bcount = 0;
   for (int n=0; n<codeplug().image(0).numElements(); n++) {
     int b0 = codeplug().image(0).element(n).address()/BSIZE;
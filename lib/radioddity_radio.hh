@@ -17,7 +17,7 @@ class RadioddityRadio: public Radio
 
 public:
   /** Do not construct this class directly, rather use @c Radio::detect. */
-  explicit RadioddityRadio(RadioddityInterface *device=nullptr, QObject *parent=nullptr);
+  explicit RadioddityRadio(RadioInterface *device=nullptr, QObject *parent=nullptr);
 
   virtual ~RadioddityRadio();
 
@@ -42,8 +42,9 @@ private:
   virtual bool uploadCallsigns();
 
 protected:
-  /** The interface to the radio. */
-  RadioddityInterface *_dev;
+  /** The interface to the radio. Usually a @c RadioddityInterface, but any interface serving the
+   * memory banks of a @c RadioddityInterface will do. */
+  RadioInterface *_dev;
   /** Holds the flags to control assembly and upload of code-plugs. */
   Codeplug::Flags _codeplugFlags;
   /** The generic configuration. */
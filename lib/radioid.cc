@@ -56,7 +56,7 @@ DMRRadioID::setNumber(uint32_t id) {
   if (id == _number)
     return;
   _number = id;
-  emit modified(this);
+  emitModified();
 }
 
 YAML::Node
@@ -155,7 +155,7 @@ M17RadioID::setCall(const QString &call) {
   if (call == _call)
     return;
   _call = M17Contact::normalizeCall(call);
-  emit modified(this);
+  emitModified();
 }
 
 YAML::Node
@@ -234,7 +234,7 @@ DTMFRadioID::setNumber(const QString &number) {
   if (! validDTMFNumber(number))
     return;
   _number = number.simplified();
-  emit modified(this);
+  emitModified();
   return;
 }
 
@@ -4,11 +4,13 @@
 #include "opengd77_interface.hh"
 #include "radioddity_interface.hh"
 #include "tyt_interface.hh"
+#include "logger.hh"
 
 /* ********************************************************************************************* *
  * Implementation of RadioInterface
  * ********************************************************************************************* */
 RadioInterface::RadioInterface()
+  : _stats(nullptr), _rttSmoothed(0), _rttVariance(0), _rttSamples(0)
 {
 	// pass...
 }
@@ -34,3 +36,52 @@ RadioInterface::setDateTime(const QDateTime &datetime, const ErrorStack &err) {
   Q_UNUSED(datetime); Q_UNUSED(err);
   return true;
 }
+
+TransferStats *
+RadioInterface::stats() const {
+  return _stats;
+}
+
+void
+RadioInterface::setStats(TransferStats *stats) {
+  _stats = stats;
+}
+
+qint64
+RadioInterface::roundTripTime() const {
+  if (MIN_ROUND_TRIP_SAMPLES > _rttSamples)
+    return -1;
+  return _rttSmoothed;
+}
+
+int
+RadioInterface::responseTimeout(int fallback) const {
+  if (MIN_ROUND_TRIP_SAMPLES > _rttSamples)
+    return fallback;
+  // Like the TCP retransmission timeout (RFC 6298), with an additional safety factor of 2 to
+  // account for USB scheduling jitter.
+  qint64 timeout = (2*(_rttSmoothed + 4*_rttVariance) + 999)/1000;
+  return qBound(qint64(fallback/4), timeout, qint64(fallback));
+}
+
+void
+RadioInterface::addRoundTripSample(qint64 us) {
+  if (0 == _rttSamples) {
+    _rttSmoothed = us;
+    _rttVariance = us/2;
+  } else {
+    qint64 dev = (us > _rttSmoothed) ? (us - _rttSmoothed) : (_rttSmoothed - us);
+    _rttVariance = (3*_rttVariance + dev)/4;
+    _rttSmoothed = (7*_rttSmoothed + us)/8;
+  }
+  _rttSamples++;
+
+  if (MIN_ROUND_TRIP_SAMPLES == _rttSamples)
+    logDebug() << "Measured round-trip time of " << _rttSmoothed << "us.";
+}
+
+void
+RadioInterface::resetRoundTripTime() {
+  _rttSmoothed = _rttVariance = 0;
+  _rttSamples = 0;
+}
@@ -8,6 +8,7 @@
 #include "usbdevice.hh"
 #include "radioinfo.hh"
 #include "errorstack.hh"
+#include "transferstats.hh"
 
 /** Abstract radio interface.
  * A radion interface must provide means to communicate with the device. That is, open a connection
@@ -97,6 +98,42 @@ public:
    * @param datetime [in] Specifies the timestamp to set.
    * @param err Passes an error stack to put error messages on. */
   virtual bool setDateTime(const QDateTime &datetime, const ErrorStack &err=ErrorStack());
+
+  /** Returns the statistics, the requests are recorded into. May be @c nullptr. */
+  TransferStats *stats() const;
+  /** Sets the statistics to record the requests into. The ownership is not taken. */
+  void setStats(TransferStats *stats);
+
+  /** Returns the smoothed round-trip time of a request in us or -1, if not enough requests were
+   * timed yet. The estimate is obtained from the requests issued while connecting to the device
+   * and gets updated with every further request. */
+  qint64 roundTripTime() const;
+  /** Returns the time in ms, a response of the device is expected within. As long as the
+   * round-trip time is unknown, the given conservative @c fallback is returned. Otherwise, the
+   * time is derived from the round-trip time and its variance, but never exceeds the fallback nor
+   * gets shorter than a quarter of it. A response taking longer indicates, that the device got
+   * slower (e.g., while writing its flash). */
+  int responseTimeout(int fallback) const;
+
+protected:
+  /** Records the round-trip time of a request in us. */
+  void addRoundTripSample(qint64 us);
+  /** Discards the round-trip time estimate, e.g., after a timeout. Until enough requests are
+   * timed again, the conservative fallbacks are used. */
+  void resetRoundTripTime();
+
+protected:
+  /** Minimum number of samples, before the round-trip time estimate is used. */
+  static const unsigned int MIN_ROUND_TRIP_SAMPLES = 2;
+
+  /** A weak reference to the transfer statistics. */
+  TransferStats *_stats;
+  /** The smoothed round-trip time in us. */
+  qint64 _rttSmoothed;
+  /** The smoothed mean deviation of the round-trip time in us. */
+  qint64 _rttVariance;
+  /** Number of round-trip time samples taken. */
+  unsigned int _rttSamples;
 };
 
 #endif // RADIOINFERFACE_HH
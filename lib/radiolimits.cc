@@ -1,8 +1,18 @@
 #include "radiolimits.hh"
 #include "configobject.hh"
 #include "config.hh"
+#include "configreference.hh"
 #include <QMetaProperty>
 #include <QRegularExpression>
+#include <QReadLocker>
+#include <QWriteLocker>
+#include <QMutexLocker>
+#include <QThreadPool>
+#include <QtConcurrent>
+#include <algorithm>
+
+/** Minimum number of list elements verified by one thread. */
+#define MIN_SHARD_SIZE 64
 
 // Utility function to check string content for ASCII encoding
 inline bool qstring_is_ascii(const QString &text) {
@@ -83,15 +93,28 @@ RadioLimitIssue::format() const {
 /* ********************************************************************************************* *
  * Implementation of RadioLimitContext
  * ********************************************************************************************* */
+QString
+RadioLimitContext::Frame::format() const {
+  switch (type) {
+  case Type::Text: return text;
+  case Type::Property: return QString("In property '%1'").arg(name);
+  case Type::List: return QString("In list '%1'").arg(name);
+  case Type::Object: return QString("In object '%1'").arg(object->name());
+  case Type::Element: return QString("In element %1 ('%2')").arg(index).arg(object->name());
+  }
+  return QString();
+}
+
 RadioLimitContext::RadioLimitContext(bool ignoreFrequencyLimits)
-  : _stack(), _ignoreFrequencyLimits(ignoreFrequencyLimits), _maxSeverity(RadioLimitIssue::Silent)
+  : _stack(), _recordings(), _cache(nullptr), _origins(),
+    _ignoreFrequencyLimits(ignoreFrequencyLimits), _maxSeverity(RadioLimitIssue::Silent), _jobs(1)
 {
   // pass...
 }
 
 RadioLimitIssue &
 RadioLimitContext::newMessage(RadioLimitIssue::Severity severity) {
-  _messages.push_back(RadioLimitIssue(severity, _stack));
+  _messages.push_back(RadioLimitIssue(severity, stack()));
   if (severity > _maxSeverity)
     _maxSeverity = severity;
   return _messages.back();
@@ -109,7 +132,27 @@ RadioLimitContext::message(int n) const {
 
 void
 RadioLimitContext::push(const QString &element) {
-  _stack.append(element);
+  _stack.append(Frame{Frame::Type::Text, element, nullptr, nullptr, 0});
+}
+
+void
+RadioLimitContext::pushProperty(const char *name) {
+  _stack.append(Frame{Frame::Type::Property, QString(), name, nullptr, 0});
+}
+
+void
+RadioLimitContext::pushList(const char *name) {
+  _stack.append(Frame{Frame::Type::List, QString(), name, nullptr, 0});
+}
+
+void
+RadioLimitContext::pushObject(const ConfigObject *obj) {
+  _stack.append(Frame{Frame::Type::Object, QString(), nullptr, obj, 0});
+}
+
+void
+RadioLimitContext::pushElement(int idx, const ConfigObject *obj) {
+  _stack.append(Frame{Frame::Type::Element, QString(), nullptr, obj, idx});
 }
 
 void
@@ -117,6 +160,15 @@ RadioLimitContext::pop() {
   _stack.pop_back();
 }
 
+QStringList
+RadioLimitContext::stack() const {
+  QStringList res;
+  res.reserve(_stack.size());
+  foreach (const Frame &frame, _stack)
+    res.append(frame.format());
+  return res;
+}
+
 bool
 RadioLimitContext::ignoreFrequencyLimits() const {
   return _ignoreFrequencyLimits;
@@ -131,6 +183,247 @@ RadioLimitContext::maxSeverity() const {
   return _maxSeverity;
 }
 
+unsigned
+RadioLimitContext::jobs() const {
+  return _jobs;
+}
+
+void
+RadioLimitContext::setJobs(unsigned n) {
+  _jobs = std::max(1U, n);
+}
+
+RadioLimitContext
+RadioLimitContext::fork() const {
+  RadioLimitContext ctx(_ignoreFrequencyLimits);
+  ctx._stack = _stack;
+  ctx._cache = _cache;
+  ctx._origins = _origins;
+  return ctx;
+}
+
+void
+RadioLimitContext::merge(const RadioLimitContext &other) {
+  _messages.append(other._messages);
+  if (other._maxSeverity > _maxSeverity)
+    _maxSeverity = other._maxSeverity;
+}
+
+RadioLimitCache *
+RadioLimitContext::cache() const {
+  return _cache;
+}
+
+void
+RadioLimitContext::setCache(RadioLimitCache *cache) {
+  _cache = cache;
+}
+
+void
+RadioLimitContext::setOrigins(const QHash<const ConfigObject *, const ConfigObject *> &origins) {
+  _origins = origins;
+}
+
+const ConfigObject *
+RadioLimitContext::cacheKey(const ConfigObject *obj) const {
+  if (_origins.isEmpty())
+    return obj;
+  return _origins.value(obj, nullptr);
+}
+
+bool
+RadioLimitContext::restoreObject(const ConfigObject *obj, bool &success) {
+  QList<RadioLimitIssue> issues;
+  if (nullptr == _cache)
+    return false;
+  const ConfigObject *key = cacheKey(obj);
+  if ((nullptr == key) || (! _cache->lookup(key, success, issues)))
+    return false;
+
+  QStringList prefix = stack();
+  foreach (const RadioLimitIssue &issue, issues) {
+    RadioLimitIssue restored(issue.severity(), prefix + issue.stack());
+    restored = issue.message();
+    _messages.push_back(restored);
+    if (issue.severity() > _maxSeverity)
+      _maxSeverity = issue.severity();
+  }
+
+  return true;
+}
+
+void
+RadioLimitContext::beginObject() {
+  if (nullptr == _cache)
+    return;
+  _recordings.push_back(Recording{(int)_messages.count(), (int)_stack.count()});
+}
+
+void
+RadioLimitContext::endObject(const ConfigObject *obj, bool success) {
+  if ((nullptr == _cache) || _recordings.isEmpty())
+    return;
+
+  Recording rec = _recordings.takeLast();
+  const ConfigObject *key = cacheKey(obj);
+  if (nullptr == key)
+    return;
+
+  QList<RadioLimitIssue> issues;
+  for (int i=rec.firstMessage; i<_messages.count(); i++) {
+    const RadioLimitIssue &issue = _messages.at(i);
+    RadioLimitIssue relative(issue.severity(), issue.stack().mid(rec.depth));
+    relative = issue.message();
+    issues.append(relative);
+  }
+  _cache->store(key, success, issues);
+}
+
+
+/* ********************************************************************************************* *
+ * Implementation of RadioLimitCache
+ * ********************************************************************************************* */
+RadioLimitCache::RadioLimitCache(QObject *parent)
+  : QObject(parent), _mutex(), _entries(), _owners(), _watched(), _limits(nullptr),
+    _ignoreFrequencyLimits(false), _hits(0), _misses(0)
+{
+  // pass...
+}
+
+int
+RadioLimitCache::count() const {
+  QMutexLocker locker(&_mutex);
+  return _entries.count();
+}
+
+bool
+RadioLimitCache::contains(const ConfigObject *obj) const {
+  QMutexLocker locker(&_mutex);
+  return _entries.contains(obj);
+}
+
+void
+RadioLimitCache::invalidate(const ConfigObject *obj) {
+  QMutexLocker locker(&_mutex);
+  invalidateLocked(obj);
+}
+
+void
+RadioLimitCache::clear() {
+  QMutexLocker locker(&_mutex);
+  _entries.clear();
+  for (auto watched=_owners.begin(); watched!=_owners.end(); watched++)
+    disconnect(watched.key(), nullptr, this, nullptr);
+  _owners.clear();
+  _watched.clear();
+}
+
+unsigned
+RadioLimitCache::hits() const {
+  QMutexLocker locker(&_mutex);
+  return _hits;
+}
+
+unsigned
+RadioLimitCache::misses() const {
+  QMutexLocker locker(&_mutex);
+  return _misses;
+}
+
+void
+RadioLimitCache::prepare(const RadioLimits *limits, bool ignoreFrequencyLimits) {
+  if ((limits->metaObject() != _limits) || (ignoreFrequencyLimits != _ignoreFrequencyLimits))
+    clear();
+  QMutexLocker locker(&_mutex);
+  _limits = limits->metaObject();
+  _ignoreFrequencyLimits = ignoreFrequencyLimits;
+  _hits = _misses = 0;
+}
+
+bool
+RadioLimitCache::lookup(const ConfigObject *obj, bool &success, QList<RadioLimitIssue> &issues) {
+  QMutexLocker locker(&_mutex);
+  auto entry = _entries.constFind(obj);
+  if (_entries.constEnd() == entry) {
+    _misses++;
+    return false;
+  }
+  _hits++;
+  success = entry->success;
+  issues = entry->issues;
+  return true;
+}
+
+void
+RadioLimitCache::store(const ConfigObject *obj, bool success, const QList<RadioLimitIssue> &issues) {
+  QMutexLocker locker(&_mutex);
+  _entries.insert(obj, Entry{success, issues});
+  if (! _watched.contains(obj))
+    watch(obj);
+}
+
+void
+RadioLimitCache::watch(const ConfigObject *obj) {
+  QList<const QObject *> senders;
+  senders.append(obj);
+  connect(obj, SIGNAL(modified(ConfigItem*)), this, SLOT(onWatchedModified()));
+  if (0 <= obj->metaObject()->indexOfSignal("modified()"))
+    connect(obj, SIGNAL(modified()), this, SLOT(onWatchedModified()));
+  connect(obj, SIGNAL(destroyed(QObject*)), this, SLOT(onWatchedDestroyed(QObject*)));
+
+  // Also watch owned items, references and reference lists, as their modification affects the
+  // verification of the object.
+  const QMetaObject *meta = obj->metaObject();
+  for (int p=QObject::staticMetaObject.propertyCount(); p<meta->propertyCount(); p++) {
+    QMetaProperty prop = meta->property(p);
+    if ((! prop.isReadable()) || (! (QMetaType::PointerToQObject & prop.metaType().flags())))
+      continue;
+    QObject *value = prop.read(obj).value<QObject *>();
+    if ((nullptr == value) || _owners.contains(value))
+      continue;
+    if (ConfigItem *item = qobject_cast<ConfigItem *>(value)) {
+      connect(item, SIGNAL(modified(ConfigItem*)), this, SLOT(onWatchedModified()));
+    } else if (AbstractConfigObjectList *list = qobject_cast<AbstractConfigObjectList *>(value)) {
+      connect(list, SIGNAL(elementAdded(int)), this, SLOT(onWatchedModified()));
+      connect(list, SIGNAL(elementModified(int)), this, SLOT(onWatchedModified()));
+      connect(list, SIGNAL(elementRemoved(int)), this, SLOT(onWatchedModified()));
+    } else if (ConfigObjectReference *ref = qobject_cast<ConfigObjectReference *>(value)) {
+      connect(ref, SIGNAL(modified()), this, SLOT(onWatchedModified()));
+    } else {
+      continue;
+    }
+    _owners.insert(value, obj);
+    senders.append(value);
+  }
+
+  _owners.insert(obj, obj);
+  _watched.insert(obj, senders);
+}
+
+void
+RadioLimitCache::invalidateLocked(const ConfigObject *obj) {
+  _entries.remove(obj);
+  foreach (const QObject *sender, _watched.value(obj)) {
+    disconnect(sender, nullptr, this, nullptr);
+    _owners.remove(sender);
+  }
+  _watched.remove(obj);
+}
+
+void
+RadioLimitCache::onWatchedModified() {
+  QMutexLocker locker(&_mutex);
+  if (const ConfigObject *obj = _owners.value(sender(), nullptr))
+    invalidateLocked(obj);
+}
+
+void
+RadioLimitCache::onWatchedDestroyed(QObject *obj) {
+  QMutexLocker locker(&_mutex);
+  if (const ConfigObject *owner = _owners.value(obj, nullptr))
+    invalidateLocked(owner);
+}
+
 
 /* ********************************************************************************************* *
  * Implementation of RadioLimitElement
@@ -658,6 +951,8 @@ RadioLimitItem::add(const QString &prop, RadioLimitElement *structure) {
     return false;
   _elements.insert(prop, structure);
   structure->setParent(this);
+  QWriteLocker locker(&_bindingsLock);
+  _bindings.clear();
   return true;
 }
 
@@ -678,7 +973,7 @@ RadioLimitItem::verify(const ConfigItem *item, const QMetaProperty &prop, RadioL
   if (prop.read(item).isNull())
     return true;
 
-  context.push(QString("In property '%1'").arg(prop.name()));
+  context.pushProperty(prop.name());
   bool success = verifyItem(prop.read(item).value<ConfigItem*>(), context);
   context.pop();
   return success;
@@ -686,21 +981,39 @@ RadioLimitItem::verify(const ConfigItem *item, const QMetaProperty &prop, RadioL
 
 bool
 RadioLimitItem::verifyItem(const ConfigItem *item, RadioLimitContext &context) const {
-  const QMetaObject *meta = item->metaObject();
+  foreach (const Binding &binding, bindings(item->metaObject())) {
+    if (! binding.element->verify(item, binding.property, context))
+      return false;
+  }
+
+  return true;
+}
+
+QVector<RadioLimitItem::Binding>
+RadioLimitItem::bindings(const QMetaObject *meta) const {
+  {
+    QReadLocker locker(&_bindingsLock);
+    auto cached = _bindings.constFind(meta);
+    if (_bindings.constEnd() != cached)
+      return cached.value();
+  }
+
+  QVector<Binding> res;
   for (int p=QObject::staticMetaObject.propertyCount(); p<meta->propertyCount(); p++) {
     // This property
     QMetaProperty prop = meta->property(p);
     // Should never happen
     if (! prop.isValid())
       continue;
-    // Verify property
-    if (_elements.contains(prop.name())) {
-      if (! _elements[prop.name()]->verify(item, prop, context))
-        return false;
-    }
+    // Has limits?
+    auto element = _elements.constFind(prop.name());
+    if (_elements.constEnd() != element)
+      res.append(Binding{prop, element.value()});
   }
 
-  return true;
+  QWriteLocker locker(&_bindingsLock);
+  _bindings.insert(meta, res);
+  return res;
 }
 
 
@@ -721,9 +1034,15 @@ RadioLimitObject::RadioLimitObject(const PropList &list, QObject *parent)
 
 bool
 RadioLimitObject::verifyObject(const ConfigObject *item, RadioLimitContext &context) const {
-  context.push(QString("In object '%1'").arg(item->name()));
-  bool success = verifyItem(item, context);
+  bool success = true;
+  if (context.restoreObject(item, success))
+    return success;
+
+  context.beginObject();
+  context.pushObject(item);
+  success = verifyItem(item, context);
   context.pop();
+  context.endObject(item, success);
   return success;
 }
 
@@ -742,13 +1061,28 @@ RadioLimitObjects::RadioLimitObjects(const TypeList &list, QObject *parent)
 
 bool
 RadioLimitObjects::verifyItem(const ConfigItem *item, RadioLimitContext &context) const {
-  if (! _types.contains(item->metaObject()->className())) {
+  const QMetaObject *meta = item->metaObject();
+  RadioLimitObject *type = nullptr;
+  bool found = false;
+  {
+    QReadLocker locker(&_dispatchLock);
+    auto cached = _dispatch.constFind(meta);
+    if ((found = (_dispatch.constEnd() != cached)))
+      type = cached.value();
+  }
+  if (! found) {
+    type = _types.value(meta->className(), nullptr);
+    QWriteLocker locker(&_dispatchLock);
+    _dispatch.insert(meta, type);
+  }
+
+  if (nullptr == type) {
     auto &msg = context.newMessage(RadioLimitIssue::Critical);
-    msg << "Cannot check item of type " << item->metaObject()->className()
+    msg << "Cannot check item of type " << meta->className()
         << ". Unexpected type. Expected one of " << QStringList(_types.keys()).join(", ") << ".";
     return false;
   }
-  return _types[item->metaObject()->className()]->verifyItem(item, context);
+  return type->verifyItem(item, context);
 }
 
 
@@ -877,30 +1211,34 @@ RadioLimitList::verify(const ConfigItem *item, const QMetaProperty &prop, RadioL
   foreach (QString type, _elements.keys())
     counts.insert(type,0);
 
-  context.push(QString("In list '%1'").arg(prop.name()));
+  context.pushList(prop.name());
 
-  // Check type and structure
+  // Check types, up to the first unexpected element
+  QVector<RadioLimitObject *> limits; limits.reserve(plist->count());
+  int unexpected = -1;
   for (int i=0; i<plist->count(); i++) {
-    // Check type
-    ConfigObject *obj = plist->get(i);
-    QString className = findClassName(*(obj->metaObject()));
+    QString className = findClassName(*(plist->get(i)->metaObject()));
     if (className.isEmpty()) {
-      auto &msg = context.newMessage(RadioLimitIssue::Critical);
-      msg << "Unexpected element type '" << obj->metaObject()->className()
-          << "'. Expected one of " << _elements.keys().join(", ") << ".";
-      context.pop();
-      return false;
+      unexpected = i;
+      break;
     }
-
     counts[className]++;
+    limits.append(_elements[className]);
+  }
 
-    context.push(QString("In element %1 ('%2')").arg(i).arg(obj->name()));
-    if (! _elements[className]->verifyObject(obj, context)) {
-      context.pop();
-      context.pop();
-      return false;
-    }
+  // Check structure of all elements preceding the unexpected one
+  if (! verifyElements(plist, limits, context)) {
+    context.pop();
+    return false;
+  }
+
+  if (0 <= unexpected) {
+    ConfigObject *obj = plist->get(unexpected);
+    auto &msg = context.newMessage(RadioLimitIssue::Critical);
+    msg << "Unexpected element type '" << obj->metaObject()->className()
+        << "'. Expected one of " << _elements.keys().join(", ") << ".";
     context.pop();
+    return false;
   }
 
   // Check counts
@@ -922,13 +1260,68 @@ RadioLimitList::verify(const ConfigItem *item, const QMetaProperty &prop, RadioL
   return true;
 }
 
+bool
+RadioLimitList::verifyElements(const ConfigObjectList *list, const QVector<RadioLimitObject *> &limits,
+                               RadioLimitContext &context) const
+{
+  int n = limits.size();
+  if ((1 >= context.jobs()) || (n < 2*MIN_SHARD_SIZE)) {
+    for (int i=0; i<n; i++) {
+      ConfigObject *obj = list->get(i);
+      context.pushElement(i, obj);
+      bool ok = limits[i]->verifyObject(obj, context);
+      context.pop();
+      if (! ok)
+        return false;
+    }
+    return true;
+  }
+
+  // Each shard gets its own context, they get merged in order afterwards. A shard stops at the
+  // first failing element, like the serial verification does.
+  struct Shard { int first, last; RadioLimitContext context; bool ok; };
+  int shardSize = std::max(MIN_SHARD_SIZE, int((n + context.jobs() - 1)/context.jobs()));
+  QVector<Shard> shards;
+  for (int i=0; i<n; i+=shardSize)
+    shards.append(Shard{i, std::min(n, i+shardSize), context.fork(), true});
+
+  QThreadPool pool;
+  pool.setMaxThreadCount(context.jobs());
+  QtConcurrent::blockingMap(&pool, shards, [list, &limits](Shard &shard) {
+    for (int i=shard.first; shard.ok && (i<shard.last); i++) {
+      ConfigObject *obj = list->get(i);
+      shard.context.pushElement(i, obj);
+      shard.ok = limits[i]->verifyObject(obj, shard.context);
+      shard.context.pop();
+    }
+  });
+
+  for (const auto &shard: shards) {
+    context.merge(shard.context);
+    if (! shard.ok)
+      return false;
+  }
+  return true;
+}
+
 QString
 RadioLimitList::findClassName(const QMetaObject &type) const {
-  if (_elements.contains(type.className()))
-    return type.className();
-  if (const QMetaObject *super = type.superClass())
-    return findClassName(*super);
-  return "";
+  {
+    QReadLocker locker(&_classNamesLock);
+    auto cached = _classNames.constFind(&type);
+    if (_classNames.constEnd() != cached)
+      return cached.value();
+  }
+
+  QString className;
+  for (const QMetaObject *meta = &type; meta && className.isEmpty(); meta = meta->superClass()) {
+    if (_elements.contains(meta->className()))
+      className = meta->className();
+  }
+
+  QWriteLocker locker(&_classNamesLock);
+  _classNames.insert(&type, className);
+  return className;
 }
 
 
@@ -1135,5 +1528,8 @@ RadioLimits::verifyConfig(const Config *config, RadioLimitContext &context) cons
              "missing or are not well tested.");
   }
 
+  if (RadioLimitCache *cache = context.cache())
+    cache->prepare(this, context.ignoreFrequencyLimits());
+
   return verifyItem(config, context);
 }
@@ -33,7 +33,11 @@
 #include <QRegularExpression>
 #include <QTextStream>
 #include <QMetaType>
+#include <QMetaProperty>
 #include <QSet>
+#include <QHash>
+#include <QMutex>
+#include <QReadWriteLock>
 
 #include "frequency.hh"
 #include "ranges.hh"
@@ -42,7 +46,10 @@
 class Config;
 class ConfigItem;
 class ConfigObject;
+class ConfigObjectList;
 class RadioLimits;
+class RadioLimitCache;
+class RadioLimitObject;
 
 
 /** Represents a single issue found during verification.
@@ -110,8 +117,19 @@ public:
   /** Push a property name/element index onto the stack.
    * This method is used to track the origin of an issue. */
   void push(const QString &element);
+  /** Pushes a property onto the stack. Unlike @c push, the frame is only formatted if an issue
+   * gets reported. The name must outlive the frame. */
+  void pushProperty(const char *name);
+  /** Pushes a list property onto the stack. */
+  void pushList(const char *name);
+  /** Pushes an object onto the stack. */
+  void pushObject(const ConfigObject *obj);
+  /** Pushes an element of a list onto the stack. */
+  void pushElement(int idx, const ConfigObject *obj);
   /** Pops the top-most property name/element index from the stack. */
   void pop();
+  /** Returns the current item stack. */
+  QStringList stack() const;
 
   /** If @c true, frequency limit voilations are warnings. */
   bool ignoreFrequencyLimits() const;
@@ -121,15 +139,169 @@ public:
   /** Returns the highest severity of the messages. */
   RadioLimitIssue::Severity maxSeverity() const;
 
+  /** Returns the maximum number of threads used to verify the elements of a list. */
+  unsigned jobs() const;
+  /** Sets the maximum number of threads used to verify the elements of a list.
+   * The issues are reported in the same order as for a serial verification. */
+  void setJobs(unsigned n);
+
+  /** Returns a context with the same settings and item stack but without any issues. Used to
+   * verify a part of the configuration in a separate thread. */
+  RadioLimitContext fork() const;
+  /** Appends the issues of a forked context. */
+  void merge(const RadioLimitContext &other);
+
+  /** Returns the cache used for incremental verification, @c nullptr if not set. */
+  RadioLimitCache *cache() const;
+  /** Sets the cache used for incremental verification.
+   * If set, the issues of objects that were not modified since their last verification are
+   * taken from the cache. The ownership of the cache is not taken. */
+  void setCache(RadioLimitCache *cache);
+  /** Sets the originals of the verified objects. If the verified configuration is an intermediate
+   * representation (see @c Codeplug::preprocessWithOrigins), the cached issues are keyed on the
+   * originals. This way, the cache survives the intermediate representation. Objects without an
+   * original are always verified. */
+  void setOrigins(const QHash<const ConfigObject *, const ConfigObject *> &origins);
+
+  /** Takes the issues of the given object from the cache, if present.
+   * @returns @c true if the object was found in the cache. In this case, @c success holds the
+   *          cached verification result. */
+  bool restoreObject(const ConfigObject *obj, bool &success);
+  /** Starts recording the issues of an object verified next. */
+  void beginObject();
+  /** Stores the issues recorded since the matching @c beginObject in the cache. */
+  void endObject(const ConfigObject *obj, bool success);
+
+protected:
+  /** Returns the object, the cached issues of the given object are keyed on. Returns @c nullptr
+   * if the object has no original. */
+  const ConfigObject *cacheKey(const ConfigObject *obj) const;
+
+protected:
+  /** A single frame of the item stack. */
+  struct Frame {
+    /** Possible frame types. */
+    enum class Type { Text, Property, List, Object, Element };
+    Type type;                  ///< The frame type.
+    QString text;               ///< Preformatted text for text frames.
+    const char *name;           ///< Property name for property and list frames.
+    const ConfigObject *object; ///< The object for object and element frames.
+    int index;                  ///< The index for element frames.
+    /** Formats the frame. */
+    QString format() const;
+  };
+
+  /** An object, whose issues are recorded. */
+  struct Recording {
+    int firstMessage; ///< Index of the first issue of the object.
+    int depth;        ///< Stack depth at the start of the object verification.
+  };
+
 protected:
   /** The current item stack. */
-  QStringList _stack;
+  QVector<Frame> _stack;
+  /** The stack of objects, whose issues are recorded for the cache. */
+  QVector<Recording> _recordings;
+  /** A weak reference to the cache. */
+  RadioLimitCache *_cache;
+  /** Maps the verified objects to their originals, the cache is keyed on. */
+  QHash<const ConfigObject *, const ConfigObject *> _origins;
   /** The list of issues found. */
   QList<RadioLimitIssue> _messages;
   /** If @c true, any frequency range voilation is a warning. */
   bool _ignoreFrequencyLimits;
   /** Holds the highest severity of all messages. */
   RadioLimitIssue::Severity _maxSeverity;
+  /** The maximum number of threads. */
+  unsigned _jobs;
+};
+
+
+/** Caches the issues found for each object during verification.
+ *
+ * Set an instance with @c RadioLimitContext::setCache to verify a configuration incrementally.
+ * The cache connects to the modification signals of all verified objects (including their
+ * reference lists). Only objects that were modified since their last verification are verified
+ * again, the issues of all other objects are taken from the cache. Issues concerning the
+ * configuration as a whole (e.g., the number of elements in a list) are always checked.
+ *
+ * The cache is bound to the type of limits and the settings it was filled with. Verifying with
+ * another type of limits clears it. This way, the cache survives the radio instance. If limits of
+ * the same type are set up differently (e.g., other frequency ranges), clear the cache explicitly.
+ *
+ * When verifying an intermediate representation, set its originals with
+ * @c RadioLimitContext::setOrigins. The cache then keeps the issues and watches the objects of
+ * the original configuration.
+ *
+ * @ingroup limits */
+class RadioLimitCache: public QObject
+{
+  Q_OBJECT
+
+public:
+  /** Empty constructor. */
+  explicit RadioLimitCache(QObject *parent=nullptr);
+
+  /** Returns the number of objects with cached issues. */
+  int count() const;
+  /** Returns @c true if the issues of the given object are cached. */
+  bool contains(const ConfigObject *obj) const;
+  /** Drops the cached issues of the given object. */
+  void invalidate(const ConfigObject *obj);
+  /** Drops all cached issues. */
+  void clear();
+
+  /** Returns the number of objects taken from the cache during the last verification. */
+  unsigned hits() const;
+  /** Returns the number of objects verified during the last verification. */
+  unsigned misses() const;
+
+  /** Prepares the cache for the verification with the given limits and settings.
+   * If the type of limits or the settings differ from the previous verification, the cache is
+   * cleared. */
+  void prepare(const RadioLimits *limits, bool ignoreFrequencyLimits);
+  /** Looks up the cached issues of the given object. The stack of the issues is relative to the
+   * object. */
+  bool lookup(const ConfigObject *obj, bool &success, QList<RadioLimitIssue> &issues);
+  /** Stores the issues of the given object. The stack of the issues must be relative to the
+   * object. */
+  void store(const ConfigObject *obj, bool success, const QList<RadioLimitIssue> &issues);
+
+private slots:
+  /** Gets called if a watched object or one of its references is modified. */
+  void onWatchedModified();
+  /** Gets called if a watched object gets deleted. */
+  void onWatchedDestroyed(QObject *obj);
+
+protected:
+  /** Connects to all signals of the given object indicating a modification. */
+  void watch(const ConfigObject *obj);
+  /** Drops the cached issues of the given object, the mutex must be locked. */
+  void invalidateLocked(const ConfigObject *obj);
+
+protected:
+  /** Cached verification result of an object. */
+  struct Entry {
+    bool success;                  ///< The verification result.
+    QList<RadioLimitIssue> issues; ///< The issues found.
+  };
+
+  /** Protects the cache. */
+  mutable QMutex _mutex;
+  /** The cached verification results. */
+  QHash<const ConfigObject *, Entry> _entries;
+  /** Maps the watched objects and their references to the object. */
+  QHash<const QObject *, const ConfigObject *> _owners;
+  /** Holds the signal senders for each watched object. */
+  QHash<const ConfigObject *, QList<const QObject *>> _watched;
+  /** The type of limits the cache was filled with. */
+  const QMetaObject *_limits;
+  /** The settings the cache was filled with. */
+  bool _ignoreFrequencyLimits;
+  /** Number of cache hits. */
+  unsigned _hits;
+  /** Number of cache misses. */
+  unsigned _misses;
 };
 
 
@@ -515,9 +687,24 @@ public:
   /** Verifies the properties of the given item. */
   virtual bool verifyItem(const ConfigItem *item, RadioLimitContext &context) const;
 
+protected:
+  /** A property of a class together with its limits. */
+  struct Binding {
+    QMetaProperty property;      ///< The property.
+    RadioLimitElement *element;  ///< The limits of the property.
+  };
+
+  /** Returns the properties of the given class having limits, in the order of their declaration.
+   * The list is assembled once for each class. */
+  QVector<Binding> bindings(const QMetaObject *meta) const;
+
 protected:
   /** Holds the property <-> limits map. */
   QHash<QString, RadioLimitElement *> _elements;
+  /** Precompiled class -> (property, limits) lookup. */
+  mutable QHash<const QMetaObject *, QVector<Binding>> _bindings;
+  /** Protects the precompiled lookup. */
+  mutable QReadWriteLock _bindingsLock;
 };
 
 
@@ -603,6 +790,10 @@ public:
 protected:
   /** Maps class-names to object limits. */
   QHash<QString,  RadioLimitObject *> _types;
+  /** Precompiled class -> object limits lookup. */
+  mutable QHash<const QMetaObject *, RadioLimitObject *> _dispatch;
+  /** Protects the precompiled lookup. */
+  mutable QReadWriteLock _dispatchLock;
 };
 
 
@@ -700,10 +891,18 @@ public:
 protected:
   /** Searches for the specified type or one of its super-clsases in the set of allowed types. */
   QString findClassName(const QMetaObject &type) const;
+  /** Verifies the first @c limits.size() elements of the list, serially or concurrently,
+   * depending on the number of jobs set in the context. */
+  bool verifyElements(const ConfigObjectList *list, const QVector<RadioLimitObject *> &limits,
+                      RadioLimitContext &context) const;
 
 protected:
   /** Maps typename to element definition. */
   QHash<QString, RadioLimitObject *> _elements;
+  /** Precompiled class -> allowed typename lookup. */
+  mutable QHash<const QMetaObject *, QString> _classNames;
+  /** Protects the precompiled lookup. */
+  mutable QReadWriteLock _classNamesLock;
   /** Maps typename to minimum count. */
   QHash<QString, qint64> _minCount;
   /** Maps typename to maximum count. */
@@ -61,7 +61,7 @@ RadioSettings::power() const {
 void
 RadioSettings::setPower(Channel::Power power) {
   _power = power;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -80,7 +80,7 @@ RadioSettings::setTOT(const Interval &sec) {
   if (_transmitTimeOut == sec)
     return;
   _transmitTimeOut = sec;
-  emit modified(this);
+  emitModified();
 }
 
 void
@@ -145,7 +145,7 @@ RadioSettings::setTyTExtension(TyTSettingsExtension *ext) {
     _tytExtension->setParent(this);
     connect(_tytExtension, SIGNAL(modified(ConfigItem*)), this, SLOT(onExtensionModified()));
   }
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -165,7 +165,7 @@ RadioSettings::setRadioddityExtension(RadiodditySettingsExtension *ext) {
     _radioddityExtension->setParent(this);
     connect(_radioddityExtension, SIGNAL(modified(ConfigItem*)), this, SLOT(onExtensionModified()));
   }
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -185,13 +185,13 @@ RadioSettings::setAnytoneExtension(AnytoneSettingsExtension *ext) {
     _anytoneExtension->setParent(this);
     connect(_anytoneExtension, SIGNAL(modified(ConfigItem*)), this, SLOT(onExtensionModified()));
   }
-  emit modified(this);
+  emitModified();
 }
 
 
 void
 RadioSettings::onExtensionModified() {
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -8,7 +8,7 @@
 
 RadioLimits *RD5R::_limits = nullptr;
 
-RD5R::RD5R(RadioddityInterface *device, QObject *parent)
+RD5R::RD5R(RadioInterface *device, QObject *parent)
   : RadioddityRadio(device, parent), _name("Baofeng/Radioddity RD-5R"), _codeplug()
 {
   // pass...
@@ -41,7 +41,7 @@ public:
   /** Constructor.
    * Do not call this constructor directly. Consider using the factory method
    * @c Radio::detect. */
-  RD5R(RadioddityInterface *device=nullptr, QObject *parent=nullptr);
+  RD5R(RadioInterface *device=nullptr, QObject *parent=nullptr);
 
   virtual ~RD5R();
 
@@ -45,7 +45,7 @@ RoamingChannel::setRXFrequency(Frequency f) {
   if (f == _rxFrequency)
     return;
   _rxFrequency = f;
-  emit modified(this);
+  emitModified();
 }
 
 Frequency
@@ -57,7 +57,7 @@ RoamingChannel::setTXFrequency(Frequency f) {
   if (f == _txFrequency)
     return;
   _txFrequency = f;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -69,7 +69,7 @@ RoamingChannel::overrideColorCode(bool override) {
   if (override == _overrideColorCode)
     return;
   _overrideColorCode = override;
-  emit modified(this);
+  emitModified();
 }
 unsigned int
 RoamingChannel::colorCode() const {
@@ -81,7 +81,7 @@ RoamingChannel::setColorCode(unsigned int cc) {
   if (_colorCode == cc)
     return;
   _colorCode = cc;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -93,7 +93,7 @@ RoamingChannel::overrideTimeSlot(bool override) {
   if (override == _overrideTimeSlot)
     return;
   _overrideTimeSlot = override;
-  emit modified(this);
+  emitModified();
 }
 DMRChannel::TimeSlot
 RoamingChannel::timeSlot() const {
@@ -104,7 +104,7 @@ RoamingChannel::setTimeSlot(DMRChannel::TimeSlot ts) {
   if (_timeSlot == ts)
     return;
   _timeSlot = ts;
-  emit modified(this);
+  emitModified();
 }
 
 RoamingChannel *
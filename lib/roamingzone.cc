@@ -64,7 +64,7 @@ RoamingZone::addChannel(RoamingChannel* ch, int row) {
   row = _channel.add(ch, row);
   if (0 > row)
     return row;
-  emit modified(this);
+  emitModified();
   return row;
 }
 
@@ -46,7 +46,7 @@ RXGroupList::count() const {
 void
 RXGroupList::clear() {
   _contacts.clear();
-  emit modified(this);
+  emitModified();
 }
 
 DMRContact *
@@ -85,7 +85,7 @@ RXGroupList::serialize(const Context &context, const ErrorStack &err) {
 
 void
 RXGroupList::onModified() {
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -48,7 +48,7 @@ ScanList::clear() {
   _secondary.clear();
   _revert.clear();
   _channels.clear();
-  emit modified(this);
+  emitModified();
 }
 
 const ChannelRefList *
@@ -87,7 +87,7 @@ ScanList::addChannel(Channel *channel, int idx) {
 bool
 ScanList::remChannel(int idx) {
   return _channels.del(_channels.get(idx));
-  emit modified(this);
+  emitModified();
   return true;
 }
 
@@ -115,7 +115,7 @@ ScanList::primaryChannel() const {
 void
 ScanList::setPrimaryChannel(Channel *channel) {
   _primary.set(channel);
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -137,7 +137,7 @@ ScanList::secondaryChannel() const {
 void
 ScanList::setSecondaryChannel(Channel *channel) {
   _secondary.set(channel);
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -159,7 +159,7 @@ ScanList::revertChannel() const {
 void
 ScanList::setRevertChannel(Channel *channel) {
   _revert.set(channel);
-  emit modified(this);
+  emitModified();
 }
 
 TyTScanListExtension *
@@ -30,7 +30,7 @@ SMSTemplate::setMessage(const QString message) {
   if (_message == message)
     return;
   _message = message;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -74,7 +74,7 @@ SMSExtension::setFormat(Format format) {
   if (_format == format)
     return;
   _format = format;
-  emit modified(this);
+  emitModified();
 }
 
 ConfigItem *
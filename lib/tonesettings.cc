@@ -37,7 +37,7 @@ ToneSettings::enableSilent(bool enable) {
   if (_silent == enable)
     return;
   _silent = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -56,7 +56,7 @@ ToneSettings::setKeyToneVolume(Level volume) {
   if (_keyTone == volume)
     return;
   _keyTone = volume;
-  emit modified(this);
+  emitModified();
 }
 
 void
@@ -75,7 +75,7 @@ ToneSettings::enableSMSTone(bool enabled) {
   if (_smsTone == enabled)
     return;
   _smsTone = enabled;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -89,7 +89,7 @@ ToneSettings::enableRingtone(bool enabled) {
   if (_ringtone == enabled)
     return;
   _ringtone = enabled;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -103,7 +103,7 @@ ToneSettings::enableBootTone(bool enabled) {
   if (_bootTone == enabled)
     return;
   _bootTone = enabled;
-  emit modified(this);
+  emitModified();
 }
 
 Melody *
@@ -122,7 +122,7 @@ ToneSettings::setTalkPermit(Channel::Types type) {
   if (_talkPermit == type)
     return;
   _talkPermit = type;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -136,7 +136,7 @@ ToneSettings::setCallStart(Channel::Types type) {
   if (_callStart == type)
     return;
   _callStart = type;
-  emit modified(this);
+  emitModified();
 }
 
 Melody *
@@ -155,7 +155,7 @@ ToneSettings::setCallEnd(Channel::Types type) {
   if (_callEnd == type)
     return;
   _callEnd = type;
-  emit modified(this);
+  emitModified();
 }
 
 Melody *
@@ -174,7 +174,7 @@ ToneSettings::setChannelIdle(Channel::Types type) {
   if (_channelIdle == type)
     return;
   _channelIdle = type;
-  emit modified(this);
+  emitModified();
 }
 
 Melody *
@@ -193,7 +193,7 @@ ToneSettings::enableCallReset(bool enabled) {
   if (_callReset == enabled)
     return;
   _callReset = enabled;
-  emit modified(this);
+  emitModified();
 }
 
 Melody *
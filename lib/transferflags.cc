@@ -1,13 +1,15 @@
 #include "transferflags.hh"
 
 TransferFlags::TransferFlags()
-  : _blocking(false), _updateDeviceClock(false)
+  : _blocking(false), _updateDeviceClock(false), _useImageCache(false), _pipelined(false),
+    _dryRun(false)
 {
   // pass...
 }
 
 TransferFlags::TransferFlags(bool blocking, bool updateDeviceClock)
-  : _blocking(blocking), _updateDeviceClock(updateDeviceClock)
+  : _blocking(blocking), _updateDeviceClock(updateDeviceClock), _useImageCache(false),
+    _pipelined(false), _dryRun(false)
 {
   // pass...
 }
@@ -35,4 +37,34 @@ TransferFlags::setUpdateDeviceClock(bool enable) {
 }
 
 
+bool
+TransferFlags::useImageCache() const {
+  return _useImageCache;
+}
+
+void
+TransferFlags::setUseImageCache(bool enable) {
+  _useImageCache = enable;
+}
+
+
+bool
+TransferFlags::pipelined() const {
+  return _pipelined;
+}
 
+void
+TransferFlags::setPipelined(bool enable) {
+  _pipelined = enable;
+}
+
+
+bool
+TransferFlags::dryRun() const {
+  return _dryRun;
+}
+
+void
+TransferFlags::setDryRun(bool enable) {
+  _dryRun = enable;
+}
@@ -21,11 +21,37 @@ public:
   /** Sets if the device clock gets updated during the transfer. */
   void setUpdateDeviceClock(bool enable);
 
+  /** Returns @c true if a local copy of the codeplug image gets used to speed-up the transfer.
+   * Not all radios support this feature. */
+  bool useImageCache() const;
+  /** Sets if a local copy of the codeplug image gets used. */
+  void setUseImageCache(bool enable);
+
+  /** Returns @c true if several requests are kept in flight during the transfer. As not every
+   * device and firmware is known to handle this, it is disabled by default. Not all radios
+   * support this feature. */
+  bool pipelined() const;
+  /** Sets if several requests are kept in flight during the transfer. */
+  void setPipelined(bool enable);
+
+  /** Returns @c true if the transfer to the device is only simulated. That is, the device
+   * memory that would be modified gets reported but nothing is written.
+   * Not all radios support this feature. */
+  bool dryRun() const;
+  /** Sets if the transfer to the device is only simulated. */
+  void setDryRun(bool enable);
+
 protected:
   /** If @c true, the transfer is blocking. */
   bool _blocking;
   /** If @c true, the device clock gets updated during the transfer. */
   bool _updateDeviceClock;
+  /** If @c true, a local copy of the codeplug image gets used. */
+  bool _useImageCache;
+  /** If @c true, several requests are kept in flight. */
+  bool _pipelined;
+  /** If @c true, nothing gets written to the device. */
+  bool _dryRun;
 };
 
 
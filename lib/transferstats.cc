@@ -0,0 +1,229 @@
+#include "transferstats.hh"
+#include <QJsonArray>
+#include <QStringList>
+#include <QMutexLocker>
+#include <cstring>
+
+
+/* ********************************************************************************************* *
+ * Implementation of TransferStats::Request
+ * ********************************************************************************************* */
+TransferStats::Request::Request(TransferStats *stats, Direction direction, unsigned int bytes)
+  : _stats(stats), _direction(direction), _bytes(bytes), _timer()
+{
+  if (_stats)
+    _timer.start();
+}
+
+TransferStats::Request::~Request() {
+  if (_stats)
+    _stats->addRequest(_direction, _bytes, _timer.nsecsElapsed()/1000);
+}
+
+
+/* ********************************************************************************************* *
+ * Implementation of TransferStats::Session
+ * ********************************************************************************************* */
+TransferStats::Session::Session(TransferStats &stats)
+  : _stats(stats)
+{
+  _stats.clear();
+}
+
+TransferStats::Session::~Session() {
+  _stats.finish();
+}
+
+
+/* ********************************************************************************************* *
+ * Implementation of TransferStats
+ * ********************************************************************************************* */
+TransferStats::TransferStats()
+  : _mutex(), _timer(), _elapsed(0), _phaseTimer(), _phases()
+{
+  memset(&_total, 0, sizeof(Counters));
+  memset(_latency, 0, sizeof(_latency));
+}
+
+void
+TransferStats::clear() {
+  QMutexLocker locker(&_mutex);
+  _timer.start();
+  _elapsed = -1;
+  _phaseTimer.invalidate();
+  _phases.clear();
+  memset(&_total, 0, sizeof(Counters));
+  memset(_latency, 0, sizeof(_latency));
+}
+
+void
+TransferStats::beginPhase(const QString &name) {
+  QMutexLocker locker(&_mutex);
+  endPhase();
+  Phase phase; phase.name = name; phase.elapsed = 0;
+  memset(&phase.counters, 0, sizeof(Counters));
+  _phases.append(phase);
+  _phaseTimer.start();
+}
+
+void
+TransferStats::finish() {
+  QMutexLocker locker(&_mutex);
+  endPhase();
+  if (_timer.isValid())
+    _elapsed = _timer.elapsed();
+}
+
+void
+TransferStats::endPhase() {
+  if ((! _phaseTimer.isValid()) || _phases.isEmpty())
+    return;
+  _phases.last().elapsed = _phaseTimer.elapsed();
+  _phaseTimer.invalidate();
+}
+
+QString
+TransferStats::currentPhase() const {
+  QMutexLocker locker(&_mutex);
+  if ((! _phaseTimer.isValid()) || _phases.isEmpty())
+    return QString();
+  return _phases.last().name;
+}
+
+void
+TransferStats::addRequest(Direction direction, unsigned int bytes, qint64 latency_us) {
+  QMutexLocker locker(&_mutex);
+  unsigned int dir = (unsigned int)direction;
+
+  _total.bytes[dir] += bytes;
+  _total.requests++;
+  if (_phaseTimer.isValid() && (! _phases.isEmpty())) {
+    _phases.last().counters.bytes[dir] += bytes;
+    _phases.last().counters.requests++;
+  }
+
+  Latency &lat = _latency[dir];
+  if ((0 == lat.count) || (latency_us < lat.min))
+    lat.min = latency_us;
+  if ((0 == lat.count) || (latency_us > lat.max))
+    lat.max = latency_us;
+  lat.count++;
+  lat.sum += latency_us;
+
+  unsigned int bucket = 0;
+  for (qint64 bound=128; (bucket < (HISTOGRAM_SIZE-1)) && (latency_us >= bound); bound *= 2)
+    bucket++;
+  lat.histogram[bucket]++;
+}
+
+void
+TransferStats::addRetry() {
+  QMutexLocker locker(&_mutex);
+  _total.retries++;
+  if (_phaseTimer.isValid() && (! _phases.isEmpty()))
+    _phases.last().counters.retries++;
+}
+
+quint64
+TransferStats::bytes(Direction direction) const {
+  QMutexLocker locker(&_mutex);
+  return _total.bytes[(unsigned int)direction];
+}
+
+quint64
+TransferStats::requests() const {
+  QMutexLocker locker(&_mutex);
+  return _total.requests;
+}
+
+quint64
+TransferStats::retries() const {
+  QMutexLocker locker(&_mutex);
+  return _total.retries;
+}
+
+qint64
+TransferStats::elapsed() const {
+  QMutexLocker locker(&_mutex);
+  if (0 <= _elapsed)
+    return _elapsed;
+  return _timer.isValid() ? _timer.elapsed() : 0;
+}
+
+void
+TransferStats::countersToJson(const Counters &counters, QJsonObject &obj) {
+  obj.insert("bytesRead", qint64(counters.bytes[(unsigned int)Direction::Read]));
+  obj.insert("bytesWritten", qint64(counters.bytes[(unsigned int)Direction::Write]));
+  obj.insert("bytesErased", qint64(counters.bytes[(unsigned int)Direction::Erase]));
+  obj.insert("requests", qint64(counters.requests));
+  obj.insert("retries", qint64(counters.retries));
+}
+
+QJsonObject
+TransferStats::toJson() const {
+  qint64 total = elapsed();
+
+  QMutexLocker locker(&_mutex);
+  QJsonObject obj;
+  obj.insert("elapsedMs", total);
+  countersToJson(_total, obj);
+
+  QJsonArray phases;
+  for (int i=0; i<_phases.size(); i++) {
+    const Phase &phase = _phases.at(i);
+    QJsonObject p;
+    p.insert("name", phase.name);
+    bool current = (i == (_phases.size()-1)) && _phaseTimer.isValid();
+    p.insert("elapsedMs", current ? _phaseTimer.elapsed() : phase.elapsed);
+    countersToJson(phase.counters, p);
+    phases.append(p);
+  }
+  obj.insert("phases", phases);
+
+  static const char *names[] = {"read", "write", "erase"};
+  QJsonObject latency;
+  for (unsigned int dir=0; dir<3; dir++) {
+    const Latency &lat = _latency[dir];
+    if (0 == lat.count)
+      continue;
+    QJsonObject l;
+    l.insert("count", qint64(lat.count));
+    l.insert("minUs", lat.min);
+    l.insert("maxUs", lat.max);
+    l.insert("meanUs", double(lat.sum)/lat.count);
+    QJsonArray histogram;
+    qint64 bound = 128;
+    for (unsigned int b=0; b<HISTOGRAM_SIZE; b++, bound *= 2) {
+      QJsonObject bucket;
+      if (b < (HISTOGRAM_SIZE-1))
+        bucket.insert("belowUs", bound);
+      bucket.insert("count", qint64(lat.histogram[b]));
+      histogram.append(bucket);
+    }
+    l.insert("histogram", histogram);
+    latency.insert(names[dir], l);
+  }
+  obj.insert("latency", latency);
+
+  return obj;
+}
+
+QString
+TransferStats::summary() const {
+  qint64 total = elapsed();
+
+  QMutexLocker locker(&_mutex);
+  quint64 bytes = _total.bytes[(unsigned int)Direction::Read] + _total.bytes[(unsigned int)Direction::Write];
+  QString res = QString("%1 kB in %2 s (%3 kB/s), %4 requests, %5 retries")
+      .arg(bytes/1024).arg(double(total)/1000, 0, 'f', 1)
+      .arg(total ? double(bytes)/total*1000/1024 : 0.0, 0, 'f', 1)
+      .arg(_total.requests).arg(_total.retries);
+
+  QStringList phases;
+  foreach (const Phase &phase, _phases)
+    phases.append(QString("%1 %2 s").arg(phase.name).arg(double(phase.elapsed)/1000, 0, 'f', 1));
+  if (! phases.isEmpty())
+    res += QString("; %1").arg(phases.join(", "));
+
+  return res;
+}
@@ -0,0 +1,150 @@
+#ifndef TRANSFERSTATS_HH
+#define TRANSFERSTATS_HH
+
+#include <QString>
+#include <QVector>
+#include <QMutex>
+#include <QElapsedTimer>
+#include <QJsonObject>
+
+/** Collects telemetry of a transfer between the host and a radio.
+ *
+ * A transfer is split into phases (e.g., read, encode, erase, write). For each phase, the wall
+ * time, the number of bytes moved, the number of requests issued and the number of retries are
+ * recorded. Additionally, the round-trip latency of every request sent to the radio is collected
+ * in a histogram. A request is a single frame of the protocol, not a call to the
+ * @c RadioInterface, which may issue many of them.
+ *
+ * The radio sets an instance on its interface (see @c RadioInterface::setStats). The interface
+ * then times each request it sends using @c TransferStats::Request. Requests that are pipelined
+ * are timed from sending until their response arrives and recorded using @c addRequest. The radio
+ * marks the phases of the transfer using @c beginPhase. All methods are thread-safe, hence the
+ * statistics can be inspected while the transfer is running.
+ *
+ * @ingroup rif */
+class TransferStats
+{
+public:
+  /** Possible request types. */
+  enum class Direction {
+    Read = 0, Write = 1, Erase = 2
+  };
+
+  /** Number of histogram buckets. The first bucket collects all requests faster than
+   * 128us, each further bucket doubles the upper bound. The last bucket is open-ended. */
+  static const unsigned int HISTOGRAM_SIZE = 16;
+
+  /** Times a single request to the radio. The latency is recorded upon destruction. */
+  class Request
+  {
+  public:
+    /** Starts timing a request. If @c stats is @c nullptr, nothing is recorded. */
+    Request(TransferStats *stats, Direction direction, unsigned int bytes);
+    /** Records the request. */
+    ~Request();
+
+  protected:
+    /** The statistics to record into. */
+    TransferStats *_stats;
+    /** The request type. */
+    Direction _direction;
+    /** The number of bytes transferred. */
+    unsigned int _bytes;
+    /** Measures the latency. */
+    QElapsedTimer _timer;
+  };
+
+  /** Marks the entire transfer. Clears the statistics on construction and ends the last phase
+   * upon destruction. */
+  class Session
+  {
+  public:
+    /** Clears the given statistics and starts the transfer. */
+    explicit Session(TransferStats &stats);
+    /** Finishes the transfer. */
+    ~Session();
+
+  protected:
+    /** The statistics. */
+    TransferStats &_stats;
+  };
+
+public:
+  /** Empty constructor. */
+  TransferStats();
+
+  /** Resets all statistics and starts timing a new transfer. */
+  void clear();
+  /** Ends the current phase and starts a new one with the given name. */
+  void beginPhase(const QString &name);
+  /** Ends the current phase and the transfer. */
+  void finish();
+  /** Returns the name of the current phase or an empty string if there is none. */
+  QString currentPhase() const;
+
+  /** Records a request. */
+  void addRequest(Direction direction, unsigned int bytes, qint64 latency_us);
+  /** Records a retry of a request. */
+  void addRetry();
+
+  /** Returns the total number of bytes transferred in the given direction. */
+  quint64 bytes(Direction direction) const;
+  /** Returns the total number of requests issued. */
+  quint64 requests() const;
+  /** Returns the total number of retries. */
+  quint64 retries() const;
+  /** Returns the wall time of the transfer in ms. */
+  qint64 elapsed() const;
+
+  /** Serializes the statistics. */
+  QJsonObject toJson() const;
+  /** Returns a short, human readable summary. */
+  QString summary() const;
+
+protected:
+  /** Counters, collected per phase and for the entire transfer. */
+  struct Counters {
+    quint64 bytes[3];  ///< Bytes per direction.
+    quint64 requests;  ///< Number of requests.
+    quint64 retries;   ///< Number of retries.
+  };
+
+  /** Statistics of a single phase. */
+  struct Phase {
+    QString name;      ///< Name of the phase.
+    qint64 elapsed;    ///< Wall time in ms.
+    Counters counters; ///< The counters.
+  };
+
+  /** Latency statistics of one request type. */
+  struct Latency {
+    quint64 count;                     ///< Number of requests.
+    qint64 min;                        ///< Minimum latency in us.
+    qint64 max;                        ///< Maximum latency in us.
+    qint64 sum;                        ///< Sum of all latencies in us.
+    quint64 histogram[HISTOGRAM_SIZE]; ///< Latency histogram.
+  };
+
+  /** Ends the current phase, the mutex must be held. */
+  void endPhase();
+  /** Serializes the given counters. */
+  static void countersToJson(const Counters &counters, QJsonObject &obj);
+
+protected:
+  /** Protects the statistics. */
+  mutable QMutex _mutex;
+  /** Measures the entire transfer. */
+  QElapsedTimer _timer;
+  /** Wall time of the finished transfer in ms, -1 while running. */
+  qint64 _elapsed;
+  /** Measures the current phase. */
+  QElapsedTimer _phaseTimer;
+  /** All phases, the last one is the current one if the phase timer is valid. */
+  QVector<Phase> _phases;
+  /** Counters of the entire transfer. */
+  Counters _total;
+  /** Latency statistics per request type. */
+  Latency _latency[3];
+};
+
+#endif // TRANSFERSTATS_HH
@@ -114,24 +114,24 @@ TyTCallsignDB::EntryElement::clear() {
 void
 TyTCallsignDB::EntryElement::set(const UserDatabase::User &user) {
   // Set id
-  *((uint32_t *)(_data + 0x0000)) = qToLittleEndian(user.id);
+  *((uint32_t *)(_data + 0x0000)) = qToLittleEndian(user.id());
   _data[3] = 0xff;
 
   // Set call
-  encode_ascii(_data + 0x0004, user.call, 16);
+  encode_ascii(_data + 0x0004, user.call(), 16);
 
   // Set name
-  QString name = user.name;
-  if ((! user.surname.isEmpty()) && (100 >= name.length() + 1 + user.surname.size()))
-    name += " " + user.surname;
-  if ((! user.city.isEmpty()) && (100 >= name.length() + 2 + user.city.size()))
-    name += ", " + user.city;
-  if ((! user.state.isEmpty()) && (100 >= name.length() + 2 + user.state.size()))
-    name += ", " + user.state;
-  if ((! user.country.isEmpty()) && (100 >= name.length() + 2 + user.country.size()))
-    name += ", " + user.country;
-  if ((! user.comment.isEmpty()) && (100 >= name.length() + 2 + user.comment.size()))
-    name += ". " + user.comment;
+  QString name = user.name();
+  if ((! user.surname().isEmpty()) && (100 >= name.length() + 1 + user.surname().size()))
+    name += " " + user.surname();
+  if ((! user.city().isEmpty()) && (100 >= name.length() + 2 + user.city().size()))
+    name += ", " + user.city();
+  if ((! user.state().isEmpty()) && (100 >= name.length() + 2 + user.state().size()))
+    name += ", " + user.state();
+  if ((! user.country().isEmpty()) && (100 >= name.length() + 2 + user.country().size()))
+    name += ", " + user.country();
+  if ((! user.comment().isEmpty()) && (100 >= name.length() + 2 + user.comment().size()))
+    name += ". " + user.comment();
 
   encode_ascii(_data + 0x0014, name, 100);
 }
@@ -151,6 +151,11 @@ TyTCallsignDB::~TyTCallsignDB() {
   // pass...
 }
 
+unsigned int
+TyTCallsignDB::maxEntries() const {
+  return MAX_CALLSIGNS;
+}
+
 bool
 TyTCallsignDB::encode(UserDatabase *db, const Flags &selection, const ErrorStack &err) {
   Q_UNUSED(err)
@@ -169,22 +174,22 @@ TyTCallsignDB::encode(UserDatabase *db, const Flags &selection, const ErrorStack
   for (unsigned i=0; i<n; i++)
     users.append(db->user(i));
   std::sort(users.begin(), users.end(),
-            [](const UserDatabase::User &a, const UserDatabase::User &b) { return a.id < b.id; });
+            [](const UserDatabase::User &a, const UserDatabase::User &b) { return a.id() < b.id(); });
 
   // Store number of entries
   setNumEntries(n);
 
   // First index entry
   int  j = 0;
-  setIndexEntry(j++, users[0].id, 1);
-  unsigned cidh = (users[0].id >> 12);
+  setIndexEntry(j++, users[0].id(), 1);
+  unsigned cidh = (users[0].id() >> 12);
 
   // Store users and update index
   for (unsigned i=0; i<n; i++) {
     setEntry(i, users[i]);
-    unsigned idh = (users[i].id >> 12);
+    unsigned idh = (users[i].id() >> 12);
     if (idh != cidh) {
-      setIndexEntry(j++,users[i].id, i+1);
+      setIndexEntry(j++,users[i].id(), i+1);
       cidh = idh;
     }
   }
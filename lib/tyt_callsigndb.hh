@@ -103,6 +103,7 @@ public:
   virtual ~TyTCallsignDB();
 
   bool encode(UserDatabase *db, const Flags &selection,const ErrorStack &err=ErrorStack());
+  unsigned int maxEntries() const;
 
 protected:
   /** Allocates required space for index and @c n call-signs. */
@@ -35,7 +35,7 @@ TyTChannelExtension::enableAutoScan(bool enable) {
   if (_autoScan == enable)
     return;
   _autoScan = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -49,7 +49,7 @@ TyTChannelExtension::enableEmergencyAlarmConfirmed(bool enable) {
   if (_emergencyAlarmConfirmed == enable)
     return;
   _emergencyAlarmConfirmed = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -63,7 +63,7 @@ TyTChannelExtension::enableDisplayPTTId(bool enable) {
   if (_displayPTTId == enable)
     return;
   _displayPTTId = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -77,7 +77,7 @@ TyTChannelExtension::setRXRefFrequency(RefFrequency ref) {
   if (_rxRefFrequency == ref)
     return;
   _rxRefFrequency = ref;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -91,7 +91,7 @@ TyTChannelExtension::setTXRefFrequency(RefFrequency ref) {
   if (_txRefFrequency == ref)
     return;
   _txRefFrequency = ref;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -105,7 +105,7 @@ TyTChannelExtension::setDMRSquelch(Level sq) {
   if (_dmrSquelch == sq)
     return;
   _dmrSquelch = sq;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -119,7 +119,7 @@ TyTChannelExtension::enableTightSquelch(bool enable) {
   if (_tightSquelch == enable)
     return;
   _tightSquelch = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -133,7 +133,7 @@ TyTChannelExtension::enableCompressedUDPHeader(bool enable) {
   if (_compressedUDPHeader == enable)
     return;
   _compressedUDPHeader = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -147,7 +147,7 @@ TyTChannelExtension::setKillTone(KillTone tone) {
   if (_killTone == tone)
     return;
   _killTone = tone;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -161,7 +161,7 @@ TyTChannelExtension::setInCallCriterion(InCallCriterion crit) {
   if (_inCallCriterion == crit)
     return;
   _inCallCriterion = crit;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -175,7 +175,7 @@ TyTChannelExtension::enableAllowInterrupt(bool enable) {
   if (_allowInterrupt == enable)
     return;
   _allowInterrupt = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -189,7 +189,7 @@ TyTChannelExtension::enableDCDMLeader(bool enable) {
   if (_dcdmLeader == enable)
     return;
   _dcdmLeader = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -221,7 +221,7 @@ TyTScanListExtension::setHoldTime(unsigned ms) {
   if (_holdTime == ms)
     return;
   _holdTime = ms;
-  emit modified(this);
+  emitModified();
 }
 
 unsigned
@@ -233,7 +233,7 @@ TyTScanListExtension::setPrioritySampleTime(unsigned ms) {
   if (_prioritySampleTime == ms)
     return;
   _prioritySampleTime = ms;
-  emit modified(this);
+  emitModified();
 }
 
 /*ConfigItem *
@@ -284,7 +284,7 @@ TyTButtonSettings::setSideButton1Short(ButtonAction action) {
   if (_sideButton1Short == action)
     return;
   _sideButton1Short = action;
-  emit modified(this);
+  emitModified();
 }
 
 TyTButtonSettings::ButtonAction
@@ -296,7 +296,7 @@ TyTButtonSettings::setSideButton1Long(ButtonAction action) {
   if (_sideButton1Long == action)
     return;
   _sideButton1Long = action;
-  emit modified(this);
+  emitModified();
 }
 
 TyTButtonSettings::ButtonAction
@@ -308,7 +308,7 @@ TyTButtonSettings::setSideButton2Short(ButtonAction action) {
   if (_sideButton2Short == action)
     return;
   _sideButton2Short = action;
-  emit modified(this);
+  emitModified();
 }
 
 TyTButtonSettings::ButtonAction
@@ -320,7 +320,7 @@ TyTButtonSettings::setSideButton2Long(ButtonAction action) {
   if (_sideButton2Long == action)
     return;
   _sideButton2Long = action;
-  emit modified(this);
+  emitModified();
 }
 
 TyTButtonSettings::ButtonAction
@@ -332,7 +332,7 @@ TyTButtonSettings::setSideButton3Short(ButtonAction action) {
   if (_sideButton3Short == action)
     return;
   _sideButton3Short = action;
-  emit modified(this);
+  emitModified();
 }
 
 TyTButtonSettings::ButtonAction
@@ -344,7 +344,7 @@ TyTButtonSettings::setSideButton3Long(ButtonAction action) {
   if (_sideButton3Long == action)
     return;
   _sideButton3Long = action;
-  emit modified(this);
+  emitModified();
 }
 
 TyTButtonSettings::ButtonAction
@@ -356,7 +356,7 @@ TyTButtonSettings::setProgButton1Short(ButtonAction action) {
   if (_progButton1Short == action)
     return;
   _progButton1Short = action;
-  emit modified(this);
+  emitModified();
 }
 
 TyTButtonSettings::ButtonAction
@@ -368,7 +368,7 @@ TyTButtonSettings::setProgButton1Long(ButtonAction action) {
   if (_progButton1Long == action)
     return;
   _progButton1Long = action;
-  emit modified(this);
+  emitModified();
 }
 
 TyTButtonSettings::ButtonAction
@@ -380,7 +380,7 @@ TyTButtonSettings::setProgButton2Short(ButtonAction action) {
   if (_progButton2Short == action)
     return;
   _progButton2Short = action;
-  emit modified(this);
+  emitModified();
 }
 
 TyTButtonSettings::ButtonAction
@@ -392,7 +392,7 @@ TyTButtonSettings::setProgButton2Long(ButtonAction action) {
   if (_progButton2Long == action)
     return;
   _progButton2Long = action;
-  emit modified(this);
+  emitModified();
 }
 
 unsigned
@@ -448,7 +448,7 @@ TyTMenuSettings::setHangtimeInfinite(bool infinite) {
   _inifiniteHangTime = infinite;
   if (_inifiniteHangTime)
     _hangTime = 0;
-  emit modified(this);
+  emitModified();
 }
 
 unsigned
@@ -462,7 +462,7 @@ TyTMenuSettings::setHangTime(unsigned sec) {
     return;
   _hangTime = sec;
   _inifiniteHangTime = (0 == _hangTime);
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -474,7 +474,7 @@ TyTMenuSettings::enableTextMessage(bool enable) {
   if (_textMessage == enable)
     return;
   _textMessage = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -486,7 +486,7 @@ TyTMenuSettings::enableCallAlert(bool enable) {
   if (_callAlert == enable)
     return;
   _callAlert = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -498,7 +498,7 @@ TyTMenuSettings::enableContactEditing(bool enable) {
   if (_contactEditing == enable)
     return;
   _contactEditing = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -510,7 +510,7 @@ TyTMenuSettings::enableManualDial(bool enable) {
   if (_manualDial == enable)
     return;
   _manualDial = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -522,7 +522,7 @@ TyTMenuSettings::enableRemoteRadioCheck(bool enable) {
   if (_remoteRadioCheck == enable)
     return;
   _remoteRadioCheck = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -534,7 +534,7 @@ TyTMenuSettings::enableRemoteMonitor(bool enable) {
   if (_remoteMonitor == enable)
     return;
   _remoteMonitor = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -546,7 +546,7 @@ TyTMenuSettings::enableRemoteRadioEnable(bool enable) {
   if (_remoteRadioEnable == enable)
     return;
   _remoteRadioEnable = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -558,7 +558,7 @@ TyTMenuSettings::enableRemoteRadioDisable(bool enable) {
   if (_remoteRadioDisable == enable)
     return;
   _remoteRadioDisable = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -570,7 +570,7 @@ TyTMenuSettings::enableScan(bool enable) {
   if (_scan == enable)
     return;
   _scan = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -582,7 +582,7 @@ TyTMenuSettings::enableScanListEditing(bool enable) {
   if (_scanListEditing == enable)
     return;
   _scanListEditing = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -594,7 +594,7 @@ TyTMenuSettings::enableCallLogMissed(bool enable) {
   if (_callLogMissed == enable)
     return;
   _callLogMissed = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -606,7 +606,7 @@ TyTMenuSettings::enableCallLogAnswered(bool enable) {
   if (_callLogAnswered == enable)
     return;
   _callLogAnswered = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -618,7 +618,7 @@ TyTMenuSettings::enableCallLogOutgoing(bool enable) {
   if (_callLogOutgoing == enable)
     return;
   _callLogOutgoing = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -630,7 +630,7 @@ TyTMenuSettings::enableTalkaround(bool enable) {
   if (_talkaround == enable)
     return;
   _talkaround = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -642,7 +642,7 @@ TyTMenuSettings::enableAlertTone(bool enable) {
   if (_alertTone == enable)
     return;
   _alertTone = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -654,7 +654,7 @@ TyTMenuSettings::enablePower(bool enable) {
   if (_power == enable)
     return;
   _power = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -666,7 +666,7 @@ TyTMenuSettings::enableBacklight(bool enable) {
   if (_backlight == enable)
     return;
   _backlight = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -678,7 +678,7 @@ TyTMenuSettings::enableBootScreen(bool enable) {
   if (_bootScreen == enable)
     return;
   _bootScreen = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -690,7 +690,7 @@ TyTMenuSettings::enableKeypadLock(bool enable) {
   if (_keypadLock == enable)
     return;
   _keypadLock = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -702,7 +702,7 @@ TyTMenuSettings::enableLEDIndicator(bool enable) {
   if (_ledIndicator == enable)
     return;
   _ledIndicator = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -714,7 +714,7 @@ TyTMenuSettings::enableSquelch(bool enable) {
   if (_squelch == enable)
     return;
   _squelch = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -726,7 +726,7 @@ TyTMenuSettings::enableVOX(bool enable) {
   if (_vox == enable)
     return;
   _vox = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -738,7 +738,7 @@ TyTMenuSettings::enablePassword(bool enable) {
   if (_password == enable)
     return;
   _password = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -750,7 +750,7 @@ TyTMenuSettings::enableDisplayMode(bool enable) {
   if (_displayMode == enable)
     return;
   _displayMode = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -762,7 +762,7 @@ TyTMenuSettings::enableRadioProgramming(bool enable) {
   if (_radioProgramming == enable)
     return;
   _radioProgramming = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -774,7 +774,7 @@ TyTMenuSettings::enableGPSInformation(bool enable) {
   if (_gpsInformation == enable)
     return;
   _gpsInformation = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -819,7 +819,7 @@ TyTSettingsExtension::setMonitorType(MonitorType type) {
   if (_monitorType == type)
     return;
   _monitorType = type;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -831,7 +831,7 @@ TyTSettingsExtension::disableAllLEDs(bool disable) {
   if (_allLEDsDisabled == disable)
     return;
   _allLEDsDisabled = disable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -843,7 +843,7 @@ TyTSettingsExtension::enablePasswordAndLock(bool enable) {
   if (_passwdAndLock == enable)
     return;
   _passwdAndLock = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -855,7 +855,7 @@ TyTSettingsExtension::enablePowerSaveMode(bool enable) {
   if (_powerSaveMode == enable)
     return;
   _powerSaveMode = enable;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -867,7 +867,7 @@ TyTSettingsExtension::enableWakeupPreamble(bool enable) {
   if (_wakeupPreamble == enable)
     return;
   _wakeupPreamble = enable;
-  emit modified(this);
+  emitModified();
 }
 
 
@@ -880,7 +880,7 @@ TyTSettingsExtension::enableChannelMode(bool enable) {
   if (_channelMode == enable)
     return;
   _channelMode = enable;
-  emit modified(this);
+  emitModified();
 }
 bool
 TyTSettingsExtension::channelModeA() const {
@@ -891,7 +891,7 @@ TyTSettingsExtension::enableChannelModeA(bool enable) {
   if (_channelModeA == enable)
     return;
   _channelModeA = enable;
-  emit modified(this);
+  emitModified();
 }
 bool
 TyTSettingsExtension::channelModeB() const {
@@ -902,7 +902,7 @@ TyTSettingsExtension::enableChannelModeB(bool enable) {
   if (_channelModeB == enable)
     return;
   _channelModeB = enable;
-  emit modified(this);
+  emitModified();
 }
 
 unsigned
@@ -914,7 +914,7 @@ TyTSettingsExtension::setLowBatteryWarnInterval(unsigned sec) {
   if (_lowBatteryWarnInterval == sec)
     return;
   _lowBatteryWarnInterval = sec;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -926,7 +926,7 @@ TyTSettingsExtension::enableCallAlertToneContinuous(bool enable) {
   if (_callAlertToneContinuous == enable)
     return;
   _callAlertToneContinuous = enable;
-  emit modified(this);
+  emitModified();
 }
 unsigned
 TyTSettingsExtension::callAlertToneDuration() const {
@@ -937,7 +937,7 @@ TyTSettingsExtension::setCallAlertToneDuration(unsigned sec) {
   if (_callAlertToneDuration == sec)
     return;
   _callAlertToneDuration = sec;
-  emit modified(this);
+  emitModified();
 }
 
 unsigned
@@ -949,7 +949,7 @@ TyTSettingsExtension::setLoneWorkerResponseTime(unsigned min) {
   if (_loneWorkerResponseTime == min)
     return;
   _loneWorkerResponseTime = min;
-  emit modified(this);
+  emitModified();
 }
 
 unsigned
@@ -961,7 +961,7 @@ TyTSettingsExtension::setLoneWorkerReminderTime(unsigned sec) {
   if (_loneWorkerReminderTime == sec)
     return;
   _loneWorkerReminderTime = sec;
-  emit modified(this);
+  emitModified();
 }
 
 unsigned
@@ -973,7 +973,7 @@ TyTSettingsExtension::setDigitalScanHangTime(unsigned ms) {
   if (_digitalScanHangTime == ms)
     return;
   _digitalScanHangTime = ms;
-  emit modified(this);
+  emitModified();
 }
 
 unsigned
@@ -985,7 +985,7 @@ TyTSettingsExtension::setAnalogScanHangTime(unsigned ms) {
   if (_analogScanHangTime == ms)
     return;
   _analogScanHangTime = ms;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -997,7 +997,7 @@ TyTSettingsExtension::enableBacklightAlwaysOn(bool enable) {
   if (_backlightAlwaysOn == enable)
     return;
   _backlightAlwaysOn = enable;
-  emit modified(this);
+  emitModified();
 }
 unsigned
 TyTSettingsExtension::backlightDuration() const {
@@ -1008,7 +1008,7 @@ TyTSettingsExtension::setBacklightDuration(unsigned sec) {
   if (_backlightDuration == sec)
     return;
   _backlightDuration = sec;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -1020,7 +1020,7 @@ TyTSettingsExtension::enableKeypadLockManual(bool enable) {
   if (_keypadLockManual == enable)
     return;
   _keypadLockManual = enable;
-  emit modified(this);
+  emitModified();
 }
 unsigned
 TyTSettingsExtension::keypadLockTime() const {
@@ -1031,7 +1031,7 @@ TyTSettingsExtension::setKeypadLockTime(unsigned sec) {
   if (_keypadLockTime == sec)
     return;
   _keypadLockTime = sec;
-  emit modified(this);
+  emitModified();
 }
 
 bool
@@ -1043,7 +1043,7 @@ TyTSettingsExtension::enableRadioProgPassword(bool enable) {
   if (_radioProgPasswordEnabled == enable)
     return;
   _radioProgPasswordEnabled = enable;
-  emit modified(this);
+  emitModified();
 }
 unsigned
 TyTSettingsExtension::radioProgPassword() const {
@@ -1054,7 +1054,7 @@ TyTSettingsExtension::setRadioProgPassword(unsigned passwd) {
   if (_radioProgPassword == passwd)
     return;
   _radioProgPassword = passwd;
-  emit modified(this);
+  emitModified();
 }
 
 const QString &
@@ -1066,7 +1066,7 @@ TyTSettingsExtension::setPCProgPassword(const QString &passwd) {
   if (_pcProgPassword == passwd)
     return;
   _pcProgPassword = passwd;
-  emit modified(this);
+  emitModified();
 }
 
 unsigned
@@ -1078,7 +1078,7 @@ TyTSettingsExtension::setChannelHangTime(unsigned ms) {
   if (_channelHangTime == ms)
     return;
   _channelHangTime = ms;
-  emit modified(this);
+  emitModified();
 }
 
 /*ConfigItem *
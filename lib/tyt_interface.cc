@@ -172,6 +172,7 @@ TyTInterface::erase(unsigned start, unsigned size, void(*progress)(unsigned, voi
   size = end-start;
 
   for (unsigned i=0; i<size; i+=0x10000) {
+    TransferStats::Request request(_stats, TransferStats::Direction::Erase, 0x10000);
     erase_block(start+i, err);
     if (progress)
       progress((i*100)/size, ctx);
@@ -192,6 +193,7 @@ TyTInterface::read_start(uint32_t bank, uint32_t addr, const ErrorStack &err) {
 
 bool
 TyTInterface::read(uint32_t bank, uint32_t addr, uint8_t *data, int nbytes, const ErrorStack &err) {
+  TransferStats::Request request(_stats, TransferStats::Direction::Read, nbytes);
   Q_UNUSED(bank);
 
   if (nullptr == data) {
@@ -218,6 +220,7 @@ TyTInterface::write_start(uint32_t bank, uint32_t addr, const ErrorStack &err) {
 
 bool
 TyTInterface::write(uint32_t bank, uint32_t addr, uint8_t *data, int nbytes, const ErrorStack &err) {
+  TransferStats::Request request(_stats, TransferStats::Direction::Write, nbytes);
   Q_UNUSED(bank);
 
   if (nullptr == data) {
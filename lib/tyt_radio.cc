@@ -2,14 +2,20 @@
 #include "config.hh"
 #include "logger.hh"
 #include "utils.hh"
+#include <QMap>
+#include <QStringList>
+#include <cstring>
+#include <algorithm>
 
 #define BSIZE 1024
+#define SECTOR_SIZE 0x10000
 
 
 TyTRadio::TyTRadio(TyTInterface *device, QObject *parent)
-  : Radio(parent), _dev(device), _codeplugFlags(), _config(nullptr)
+  : Radio(parent), _dev(device), _codeplugFlags(), _callsignDBFlags(), _config(nullptr)
 {
-  // pass...
+  if (_dev)
+    _dev->setStats(&_stats);
 }
 
 TyTRadio::~TyTRadio() {
@@ -81,6 +87,7 @@ TyTRadio::startUploadCallsignDB(UserDatabase *db, const CallsignDB::Flags &selec
 
   _task = StatusUploadCallsigns;
   _errorStack = err;
+  _callsignDBFlags = selection;
 
   if (selection.blocking()) {
     this->run();
@@ -102,6 +109,8 @@ TyTRadio::startUploadSatelliteConfig(SatelliteDatabase *db, const TransferFlags
 
 void
 TyTRadio::run() {
+  TransferStats::Session session(_stats);
+
   if (StatusDownload == _task) {
     if ((nullptr==_dev) || (! _dev->isOpen())) {
       emit downloadError(this);
@@ -180,6 +189,7 @@ TyTRadio::download() {
   }
 
   // Then download codeplug
+  _stats.beginPhase("read");
   size_t bcount = 0;
   for (int n=0; n<codeplug().image(0).numElements(); n++) {
     unsigned addr = codeplug().image(0).element(n).address();
@@ -211,8 +221,11 @@ TyTRadio::upload() {
   size_t totb = codeplug().memSize();
 
   size_t bcount = 0;
+  // Copy of the current device memory, used to skip unchanged sectors
+  QVector<QByteArray> current;
   // If codeplug gets updated, download codeplug from device first:
   if (_codeplugFlags.updateCodeplug()) {
+    _stats.beginPhase("read");
     for (int n=0; n<codeplug().image(0).numElements(); n++) {
       unsigned addr = codeplug().image(0).element(n).address();
       unsigned size = codeplug().image(0).element(n).data().size();
@@ -224,32 +237,19 @@ TyTRadio::upload() {
         }
         emit uploadProgress(float(bcount*50)/totb);
       }
+      current.append(codeplug().image(0).element(n).data());
     }
   }
 
   // Encode config into codeplug
   logDebug() << "Encode codeplug.";
+  _stats.beginPhase("encode");
   codeplug().encode(_config, _codeplugFlags);
 
-  // then erase memory
-  for (int i=0; i<codeplug().image(0).numElements(); i++)
-    _dev->erase(codeplug().image(0).element(i).address(), codeplug().image(0).element(i).memSize(),
-                nullptr, nullptr, _errorStack);
-
-  logDebug() << "Upload " << codeplug().image(0).numElements() << " elements.";
-  // then, upload modified codeplug
-  bcount = 0;
-  for (int n=0; n<codeplug().image(0).numElements(); n++) {
-    unsigned addr = codeplug().image(0).element(n).address();
-    unsigned size = codeplug().image(0).element(n).memSize();
-    unsigned b0 = addr/BSIZE, nb = size/BSIZE;
-    for (size_t b=0; b<nb; b++,bcount+=BSIZE) {
-      if (! _dev->write(0, (b0+b)*BSIZE, codeplug().data((b0+b)*BSIZE), BSIZE, _errorStack)) {
-        errMsg(_errorStack) << "Cannot upload codeplug.";
-        return false;
-      }
-      emit uploadProgress(50+float(bcount*50)/totb);
-    }
+  // then, erase and upload changed sectors of the modified codeplug
+  if (! uploadSectors(codeplug(), current, _codeplugFlags.dryRun(), 50)) {
+    errMsg(_errorStack) << "Cannot upload codeplug.";
+    return false;
   }
 
   return true;
@@ -267,26 +267,104 @@ TyTRadio::uploadCallsigns() {
     return false;
   }
 
-  // then erase memory
-  logDebug() << "Erase memory section for call-sign DB.";
-  _dev->erase(callsignDB()->image(0).element(0).address(),
-              callsignDB()->image(0).element(0).memSize(),
-              [](unsigned percent, void *ctx) { emit ((TyTRadio *)ctx)->uploadProgress(percent/2); },
-              this, _errorStack);
-
-  logDebug() << "Upload " << callsignDB()->image(0).numElements() << " elements.";
-  // Total amount of data to transfer
+  // Read the current call-sign DB from the device, to skip unchanged sectors
+  logDebug() << "Read memory section of call-sign DB.";
+  _stats.beginPhase("read");
   size_t totb = callsignDB()->memSize();
-  // Upload callsign DB
   unsigned addr = callsignDB()->image(0).element(0).address();
   unsigned size = callsignDB()->image(0).element(0).memSize();
   unsigned b0 = addr/BSIZE, nb = size/BSIZE;
+  QByteArray data(size, 0xff);
   for (size_t b=0, bcount=0; b<nb; b++,bcount+=BSIZE) {
-    if (! _dev->write(0, (b0+b)*BSIZE, callsignDB()->data((b0+b)*BSIZE), BSIZE, _errorStack)) {
-      errMsg(_errorStack) << "Cannot upload codeplug.";
+    if (! _dev->read(0, (b0+b)*BSIZE, (uint8_t *)data.data()+b*BSIZE, BSIZE, _errorStack)) {
+      errMsg(_errorStack) << "Cannot upload call-sign DB.";
+      return false;
+    }
+    emit uploadProgress(float(bcount*50)/totb);
+  }
+
+  // then, erase and upload changed sectors
+  if (! uploadSectors(*callsignDB(), QVector<QByteArray>{data}, _callsignDBFlags.dryRun(), 50)) {
+    errMsg(_errorStack) << "Cannot upload call-sign DB.";
+    return false;
+  }
+
+  return true;
+}
+
+bool
+TyTRadio::uploadSectors(DFUFile &file, const QVector<QByteArray> &current, bool dryRun,
+                        unsigned progressOffset)
+{
+  DFUFile::Image &image = file.image(0);
+
+  // Collect the erase sectors covered by the image and mark those, that differ from the device
+  QMap<unsigned, bool> changed;
+  for (int n=0; n<image.numElements(); n++) {
+    const DFUFile::Element &el = image.element(n);
+    bool known = (n < current.size()) && (current.at(n).size() >= el.data().size());
+    for (unsigned offset=0; offset<el.memSize(); offset+=BSIZE) {
+      unsigned sector = (el.address()+offset)/SECTOR_SIZE;
+      bool diff = (! known) || (0 != memcmp(current.at(n).constData()+offset,
+                                            el.data().constData()+offset, BSIZE));
+      changed[sector] = changed.value(sector, false) || diff;
+    }
+  }
+
+  QStringList touched;
+  size_t totb = 0;
+  for (auto s=changed.begin(); s!=changed.end(); s++) {
+    if (! s.value())
+      continue;
+    touched.append(QString("%1h").arg(s.key()*SECTOR_SIZE, 8, 16, QChar('0')));
+    for (int n=0; n<image.numElements(); n++) {
+      const DFUFile::Element &el = image.element(n);
+      unsigned start = std::max(el.address(), s.key()*SECTOR_SIZE);
+      unsigned end = std::min(el.address()+el.memSize(), (s.key()+1)*SECTOR_SIZE);
+      if (start < end)
+        totb += end-start;
+    }
+  }
+
+  if (dryRun) {
+    logInfo() << "Dry run: Would erase and write " << touched.size() << " of " << changed.size()
+              << " sectors: " << (touched.isEmpty() ? QString("none") : touched.join(", ")) << ".";
+    emit uploadProgress(100);
+    return true;
+  }
+
+  logDebug() << "Erase and write " << touched.size() << " of " << changed.size() << " sectors.";
+
+  // Erase consecutive runs of changed sectors at once
+  _stats.beginPhase("erase");
+  for (auto s=changed.begin(); s!=changed.end();) {
+    if (! s.value()) {
+      s++; continue;
+    }
+    unsigned first = s.key(), last = s.key();
+    for (s++; (s!=changed.end()) && s.value() && (s.key() == (last+1)); s++)
+      last = s.key();
+    if (! _dev->erase(first*SECTOR_SIZE, (last-first+1)*SECTOR_SIZE, nullptr, nullptr, _errorStack)) {
+      errMsg(_errorStack) << "Cannot erase memory at " << QString::number(first*SECTOR_SIZE, 16)
+                          << "h.";
       return false;
     }
-    emit uploadProgress(50+float(bcount*50)/totb);
+  }
+
+  // then, write all blocks within changed sectors
+  _stats.beginPhase("write");
+  size_t bcount = 0;
+  for (int n=0; n<image.numElements(); n++) {
+    const DFUFile::Element &el = image.element(n);
+    unsigned b0 = el.address()/BSIZE, nb = el.memSize()/BSIZE;
+    for (unsigned b=0; b<nb; b++) {
+      if (! changed.value((b0+b)*BSIZE/SECTOR_SIZE, true))
+        continue;
+      if (! _dev->write(0, (b0+b)*BSIZE, file.data((b0+b)*BSIZE), BSIZE, _errorStack))
+        return false;
+      bcount += BSIZE;
+      emit uploadProgress(progressOffset + float(bcount*(100-progressOffset))/totb);
+    }
   }
 
   return true;
@@ -43,11 +43,21 @@ private:
   virtual bool upload();
   virtual bool uploadCallsigns();
 
+  /** Erases and writes only those erase sectors of the first image of the given file, that
+   * differ from the given copy of the current device memory. The copy @c current holds one
+   * byte array per image element. If it is empty, all sectors get written. If @c dryRun is set,
+   * the sectors that would be written are only reported. The upload progress is reported from
+   * @c progressOffset to 100. */
+  bool uploadSectors(DFUFile &file, const QVector<QByteArray> &current, bool dryRun,
+                     unsigned progressOffset);
+
 protected:
   /** The interface to the radio. */
   TyTInterface *_dev;
   /** Holds the flags to control assembly and upload of code-plugs. */
   Codeplug::Flags _codeplugFlags;
+  /** Holds the flags to control the upload of the call-sign DB. */
+  CallsignDB::Flags _callsignDBFlags;
   /** The generic configuration. */
 	Config *_config;
   /** A weak reference to the user-database. */
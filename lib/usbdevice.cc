@@ -133,6 +133,9 @@ USBDeviceInfo::description() const {
   case Class::C7K:
     stream << "C7000 " << QString::number(_vid,16) << ":" << QString::number(_pid,16);
     break;
+  case Class::Simulated:
+    stream << "Simulated device";
+    break;
   }
   return res;
 }
@@ -201,6 +204,8 @@ USBDeviceDescriptor::isValid() const {
   case Class::HID:
   case Class::C7K:
     return validRawUSB();
+  case Class::Simulated:
+    return true;
   }
   return false;
 }
@@ -282,6 +287,8 @@ USBDeviceDescriptor::description() const {
   } else if (USBDeviceInfo::Class::C7K == _class) {
     USBDeviceHandle addr = _device.value<USBDeviceHandle>();
     return QString("USB C7000 HT: bus %1, device %2").arg(addr.bus).arg(addr.device);
+  } else if (USBDeviceInfo::Class::Simulated == _class) {
+    return QString("Simulated device '%1'").arg(_device.toString());
   }
   return "Invalid";
 }
@@ -302,6 +309,7 @@ USBDeviceDescriptor::deviceHandle() const {
     return QString("%1:%2").arg(_device.value<USBDeviceHandle>().bus)
         .arg(_device.value<USBDeviceHandle>().device);
   case Class::Serial:
+  case Class::Simulated:
     return _device.toString();
   }
 
@@ -3,6 +3,7 @@
 #include <QFileInfo>
 #include <QSerialPortInfo>
 #include <QThread>
+#include <QDeadlineTimer>
 
 /* ******************************************************************************************** *
  * Implementation of USBSerial::Info
@@ -26,7 +27,10 @@ USBSerial::USBSerial(const USBDeviceDescriptor &descriptor, BaudRate rate, const
 
   logDebug() << "Try to open " << descriptor.description() << ".";
   QSerialPortInfo port(descriptor.device().toString());
-  this->setPort(port);
+  if (! port.isNull())
+    this->setPort(port);
+  else // Not a enumerated port (e.g., pty), try to open path directly.
+    this->setPortName(descriptor.device().toString());
   if (! setParity(QSerialPort::NoParity)) {
     logWarn() << "Cannot set parity of the serial port to none.";
   }
@@ -95,6 +99,28 @@ USBSerial::close() {
     QSerialPort::close();
 }
 
+bool
+USBSerial::waitForResponse(qint64 nbytes, int timeout) {
+  QDeadlineTimer deadline(timeout), expected(responseTimeout(timeout));
+  while (bytesAvailable() < nbytes) {
+    if (deadline.hasExpired())
+      return false;
+    // Wait for the expected response time first, once it is known
+    bool estimated = (0 <= roundTripTime()) && (! expected.hasExpired());
+    if (waitForReadyRead(estimated ? expected.remainingTime() : deadline.remainingTime()))
+      continue;
+    if (estimated && expected.hasExpired()) {
+      logDebug() << "No response within " << responseTimeout(timeout)
+                 << "ms, device is slower than usual.";
+      resetRoundTripTime();
+    } else if (! deadline.hasExpired()) {
+      // Not a timeout
+      return false;
+    }
+  }
+  return true;
+}
+
 void
 USBSerial::onError(QSerialPort::SerialPortError err) {
   logError() << "Serial port error: (" << err << ") " << errorString() << ".";
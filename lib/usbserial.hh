@@ -44,6 +44,12 @@ public:
   /** Closes the interface to the device. */
   void close() override;
 
+  /** Waits until at least @c nbytes are available to read, but at most @c timeout ms. Returns as
+   * soon as the data has arrived. If the response takes longer than expected from the round-trip
+   * time (see @c responseTimeout), the round-trip time estimate is discarded.
+   * @returns @c false if the data did not arrive within the timeout. */
+  bool waitForResponse(qint64 nbytes, int timeout);
+
 public:
   /** Searches for all USB serial ports with the specified VID/PID. */
   static QList<USBDeviceDescriptor> detect(uint16_t vid, uint16_t pid, bool isSave=true);
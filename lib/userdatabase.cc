@@ -8,41 +8,381 @@
 #include <QtConcurrent>
 #include <algorithm>
 #include "logger.hh"
-#include <cmath>
+#include <limits>
+#include <QSaveFile>
+
+
+/** Magic of the binary user-database snapshot. */
+#define SNAPSHOT_MAGIC   "DMRCUSDB"
+/** Version of the binary user-database snapshot. Increment on any change of the format. */
+#define SNAPSHOT_VERSION 1
+/** Used to detect snapshots written on a host with different byte order. */
+#define SNAPSHOT_BYTE_ORDER 0x01020304
+
+/** Header of the binary user-database snapshot. The snapshot is written in host byte order.
+ * All sections are aligned to 8 bytes, their offsets are relative to the start of the file. */
+struct SnapshotHeader {
+  char     magic[8];        ///< Magic, @c SNAPSHOT_MAGIC.
+  uint32_t version;         ///< Format version, @c SNAPSHOT_VERSION.
+  uint32_t byteOrder;       ///< @c SNAPSHOT_BYTE_ORDER in host byte order.
+  int64_t  sourceSize;      ///< Size of the source JSON file.
+  int64_t  sourceModified;  ///< Modification time of the source JSON file in ms since epoch.
+  uint32_t count;           ///< Number of users.
+  uint32_t numStates;       ///< Number of interned states.
+  uint32_t numCountries;    ///< Number of interned countries.
+  uint32_t arenaSize;       ///< Size of the string arena.
+  uint64_t ids;             ///< Offset of the ID column.
+  uint64_t strings;         ///< Offset of the string-reference column.
+  uint64_t state;           ///< Offset of the state column.
+  uint64_t country;         ///< Offset of the country column.
+  uint64_t states;          ///< Offset of the interned states, references into the arena.
+  uint64_t countries;       ///< Offset of the interned countries, references into the arena.
+  uint64_t arena;           ///< Offset of the string arena.
+};
 
 
 /* ********************************************************************************************* *
  * Implementation of User
  * ********************************************************************************************* */
 UserDatabase::User::User()
-  : id(0)
+  : _db(nullptr), _row(0)
 {
   // pass...
 }
 
-UserDatabase::User::User(const QJsonObject &obj)
-  : id(obj.value("id").toInt()), call(obj.value("callsign").toString()),
-    name(obj.value("fname").toString()), surname(obj.value("surname").toString()),
-    city(obj.value("city").toString()), state(obj.value("state").toString()),
-    country(obj.value("country").toString()), comment(obj.value("remarks").toString())
+UserDatabase::User::User(const UserDatabase *db, uint32_t row)
+  : _db(db), _row(row)
 {
   // pass...
 }
 
+unsigned
+UserDatabase::User::id() const {
+  if (nullptr == _db)
+    return 0;
+  return _db->_table.id(_row);
+}
+
+QString
+UserDatabase::User::call() const {
+  if (nullptr == _db)
+    return QString();
+  return _db->_table.string(_row, Field::Call);
+}
+
+QString
+UserDatabase::User::name() const {
+  if (nullptr == _db)
+    return QString();
+  return _db->_table.string(_row, Field::Name);
+}
+
+QString
+UserDatabase::User::surname() const {
+  if (nullptr == _db)
+    return QString();
+  return _db->_table.string(_row, Field::Surname);
+}
+
+QString
+UserDatabase::User::city() const {
+  if (nullptr == _db)
+    return QString();
+  return _db->_table.string(_row, Field::City);
+}
+
+QString
+UserDatabase::User::state() const {
+  if (nullptr == _db)
+    return QString();
+  return _db->_table.state(_row);
+}
+
+QString
+UserDatabase::User::country() const {
+  if (nullptr == _db)
+    return QString();
+  return _db->_table.country(_row);
+}
+
+QString
+UserDatabase::User::comment() const {
+  if (nullptr == _db)
+    return QString();
+  return _db->_table.string(_row, Field::Comment);
+}
+
 unsigned
 UserDatabase::User::distance(unsigned id) const {
-  // Fix number of digits
-  int a = this->id, b = id;
-  int ad = std::ceil(std::log10(a));
-  int bd = std::ceil(std::log10(b));
-  if (ad > bd)
-    b *= std::pow(10u, (ad-bd));
-  else if (bd > ad)
-    a *= std::pow(10u, (bd-ad));
-  // Distance is just the difference between these two numbers
-  // this ensures a small distance between two numbers with the same
-  // prefix.
-  return std::abs(a-b);
+  return UserDatabase::distance(this->id(), id);
+}
+
+
+/* ********************************************************************************************* *
+ * Implementation of UserDatabase::Table
+ * ********************************************************************************************* */
+UserDatabase::Table::Table()
+  : _count(0), _arena(), _ids(), _strings(), _state(), _country(), _states(), _countries(),
+    _stateIndex(), _countryIndex(), _snapshot(), _arenaData(nullptr), _idColumn(nullptr),
+    _stringColumn(nullptr), _stateColumn(nullptr), _countryColumn(nullptr)
+{
+  // Index 0 is reserved for the empty string
+  intern(QString(), _states, _stateIndex);
+  intern(QString(), _countries, _countryIndex);
+}
+
+void
+UserDatabase::Table::reserve(uint32_t n) {
+  _ids.reserve(n);
+  _strings.reserve(n*unsigned(Field::Count));
+  _state.reserve(n);
+  _country.reserve(n);
+  // Rough estimate of 32 bytes of text per user
+  _arena.reserve(n*32);
+}
+
+bool
+UserDatabase::Table::append(const QJsonObject &obj) {
+  uint32_t id = obj.value("id").toInt();
+  if (0 == id)
+    return false;
+
+  _ids.append(id);
+  _strings.append(store(obj.value("callsign").toString()));
+  _strings.append(store(obj.value("fname").toString()));
+  _strings.append(store(obj.value("surname").toString()));
+  _strings.append(store(obj.value("city").toString()));
+  _strings.append(store(obj.value("remarks").toString()));
+  _state.append(intern(obj.value("state").toString(), _states, _stateIndex));
+  _country.append(intern(obj.value("country").toString(), _countries, _countryIndex));
+
+  return true;
+}
+
+void
+UserDatabase::Table::finish() {
+  _arena.squeeze();
+  _ids.squeeze();
+  _strings.squeeze();
+  _state.squeeze();
+  _country.squeeze();
+  _stateIndex.clear();
+  _countryIndex.clear();
+  updateColumns();
+}
+
+void
+UserDatabase::Table::updateColumns() {
+  _count = _ids.size();
+  _arenaData = _arena.constData();
+  _idColumn = _ids.constData();
+  _stringColumn = _strings.constData();
+  _stateColumn = _state.constData();
+  _countryColumn = _country.constData();
+}
+
+QString
+UserDatabase::Table::string(uint32_t row, Field field) const {
+  const StringRef &ref = _stringColumn[row*unsigned(Field::Count) + unsigned(field)];
+  return QString::fromUtf8(_arenaData+ref.offset, ref.length);
+}
+
+QString
+UserDatabase::Table::state(uint32_t row) const {
+  return _states[_stateColumn[row]];
+}
+
+QString
+UserDatabase::Table::country(uint32_t row) const {
+  return _countries[_countryColumn[row]];
+}
+
+UserDatabase::StringRef
+UserDatabase::Table::store(const QString &str) {
+  QByteArray utf8 = str.toUtf8();
+  StringRef ref = { uint32_t(_arena.size()), uint32_t(utf8.size()) };
+  _arena.append(utf8);
+  return ref;
+}
+
+uint16_t
+UserDatabase::Table::intern(const QString &str, QStringList &list, QHash<QString, uint16_t> &index) {
+  auto item = index.constFind(str);
+  if (index.constEnd() != item)
+    return item.value();
+  // Do not overflow the index, unlikely to happen. Falls back to the empty string.
+  if (std::numeric_limits<uint16_t>::max() <= list.size())
+    return 0;
+  uint16_t idx = list.size();
+  list.append(str);
+  index.insert(str, idx);
+  return idx;
+}
+
+bool
+UserDatabase::Table::map(const QString &filename, const QFileInfo &source) {
+  QSharedPointer<QFile> file(new QFile(filename));
+  if ((! file->exists()) || (! file->open(QIODevice::ReadOnly)))
+    return false;
+
+  qint64 size = file->size();
+  if (size < qint64(sizeof(SnapshotHeader)))
+    return false;
+  const uchar *ptr = file->map(0, size);
+  if (nullptr == ptr)
+    return false;
+
+  // Check if the snapshot is up-to-date
+  const SnapshotHeader *header = reinterpret_cast<const SnapshotHeader *>(ptr);
+  if ((0 != memcmp(header->magic, SNAPSHOT_MAGIC, sizeof(header->magic)))
+      || (SNAPSHOT_VERSION != header->version) || (SNAPSHOT_BYTE_ORDER != header->byteOrder)
+      || (source.size() != header->sourceSize)
+      || (source.lastModified().toMSecsSinceEpoch() != header->sourceModified)) {
+    logDebug() << "User DB snapshot '" << filename << "' is stale.";
+    return false;
+  }
+
+  // Check if all sections are within the file
+  auto within = [size](uint64_t offset, uint64_t length) {
+    return (offset <= uint64_t(size)) && (length <= (uint64_t(size)-offset));
+  };
+  uint32_t n = header->count;
+  if ((! within(header->ids, sizeof(uint32_t)*uint64_t(n)))
+      || (! within(header->strings, sizeof(StringRef)*uint64_t(Field::Count)*n))
+      || (! within(header->state, sizeof(uint16_t)*uint64_t(n)))
+      || (! within(header->country, sizeof(uint16_t)*uint64_t(n)))
+      || (! within(header->states, sizeof(StringRef)*uint64_t(header->numStates)))
+      || (! within(header->countries, sizeof(StringRef)*uint64_t(header->numCountries)))
+      || (! within(header->arena, header->arenaSize))) {
+    logWarn() << "User DB snapshot '" << filename << "' is truncated.";
+    return false;
+  }
+  if ((header->ids | header->strings | header->state | header->country | header->states
+       | header->countries) % 8) {
+    logWarn() << "User DB snapshot '" << filename << "' is corrupted: Misaligned section.";
+    return false;
+  }
+
+  // Check every reference into the arena and every interned index. Otherwise, a corrupted
+  // snapshot would lead to reads outside of the mapped file.
+  const char *arena = reinterpret_cast<const char *>(ptr + header->arena);
+  auto valid = [header](const StringRef &ref) {
+    return (ref.offset <= header->arenaSize) && (ref.length <= (header->arenaSize-ref.offset));
+  };
+  auto names = [arena, header, valid](uint64_t offset, uint32_t count, QStringList &list) {
+    const StringRef *refs = reinterpret_cast<const StringRef *>(
+          reinterpret_cast<const uchar *>(header) + offset);
+    list.clear();
+    for (uint32_t i=0; i<count; i++) {
+      if (! valid(refs[i]))
+        return false;
+      list.append(QString::fromUtf8(arena+refs[i].offset, refs[i].length));
+    }
+    return true;
+  };
+
+  QStringList states, countries;
+  if ((! names(header->states, header->numStates, states))
+      || (! names(header->countries, header->numCountries, countries))) {
+    logWarn() << "User DB snapshot '" << filename << "' is corrupted: Invalid name reference.";
+    return false;
+  }
+
+  const StringRef *strings = reinterpret_cast<const StringRef *>(ptr + header->strings);
+  for (uint64_t i=0; i<uint64_t(Field::Count)*n; i++) {
+    if (! valid(strings[i])) {
+      logWarn() << "User DB snapshot '" << filename << "' is corrupted: Invalid string reference.";
+      return false;
+    }
+  }
+
+  const uint16_t *stateColumn = reinterpret_cast<const uint16_t *>(ptr + header->state);
+  const uint16_t *countryColumn = reinterpret_cast<const uint16_t *>(ptr + header->country);
+  for (uint32_t i=0; i<n; i++) {
+    if ((stateColumn[i] >= header->numStates) || (countryColumn[i] >= header->numCountries)) {
+      logWarn() << "User DB snapshot '" << filename << "' is corrupted: Invalid state or country.";
+      return false;
+    }
+  }
+
+  *this = Table();
+  _states = states;
+  _countries = countries;
+  _stateIndex.clear();
+  _countryIndex.clear();
+  _count = n;
+  _arenaData = arena;
+  _idColumn = reinterpret_cast<const uint32_t *>(ptr + header->ids);
+  _stringColumn = strings;
+  _stateColumn = stateColumn;
+  _countryColumn = countryColumn;
+  _snapshot = file;
+
+  return true;
+}
+
+bool
+UserDatabase::Table::write(const QString &filename, const QFileInfo &source) const {
+  // Append interned strings to the arena
+  QByteArray names;
+  QVector<StringRef> stateRefs, countryRefs;
+  for (auto state: _states) {
+    QByteArray utf8 = state.toUtf8();
+    stateRefs.append({uint32_t(_arena.size() + names.size()), uint32_t(utf8.size())});
+    names.append(utf8);
+  }
+  for (auto country: _countries) {
+    QByteArray utf8 = country.toUtf8();
+    countryRefs.append({uint32_t(_arena.size() + names.size()), uint32_t(utf8.size())});
+    names.append(utf8);
+  }
+
+  SnapshotHeader header;
+  memset(&header, 0, sizeof(SnapshotHeader));
+  memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+  header.version = SNAPSHOT_VERSION;
+  header.byteOrder = SNAPSHOT_BYTE_ORDER;
+  header.sourceSize = source.size();
+  header.sourceModified = source.lastModified().toMSecsSinceEpoch();
+  header.count = _count;
+  header.numStates = stateRefs.size();
+  header.numCountries = countryRefs.size();
+  header.arenaSize = _arena.size() + names.size();
+
+  // Compute section offsets
+  auto align = [](uint64_t offset) { return (offset + 7) & ~uint64_t(7); };
+  header.ids       = align(sizeof(SnapshotHeader));
+  header.strings   = align(header.ids + sizeof(uint32_t)*uint64_t(_count));
+  header.state     = align(header.strings + sizeof(StringRef)*uint64_t(Field::Count)*_count);
+  header.country   = align(header.state + sizeof(uint16_t)*uint64_t(_count));
+  header.states    = align(header.country + sizeof(uint16_t)*uint64_t(_count));
+  header.countries = align(header.states + sizeof(StringRef)*uint64_t(stateRefs.size()));
+  header.arena     = align(header.countries + sizeof(StringRef)*uint64_t(countryRefs.size()));
+
+  QSaveFile file(filename);
+  if (! file.open(QIODevice::WriteOnly))
+    return false;
+
+  auto section = [&file](uint64_t offset, const void *data, uint64_t size) {
+    if (file.pos() < qint64(offset))
+      file.write(QByteArray(offset-file.pos(), 0x00));
+    return qint64(size) == file.write(reinterpret_cast<const char *>(data), size);
+  };
+
+  if ((! section(0, &header, sizeof(SnapshotHeader)))
+      || (! section(header.ids, _idColumn, sizeof(uint32_t)*uint64_t(_count)))
+      || (! section(header.strings, _stringColumn, sizeof(StringRef)*uint64_t(Field::Count)*_count))
+      || (! section(header.state, _stateColumn, sizeof(uint16_t)*uint64_t(_count)))
+      || (! section(header.country, _countryColumn, sizeof(uint16_t)*uint64_t(_count)))
+      || (! section(header.states, stateRefs.constData(), sizeof(StringRef)*uint64_t(stateRefs.size())))
+      || (! section(header.countries, countryRefs.constData(), sizeof(StringRef)*uint64_t(countryRefs.size())))
+      || (! section(header.arena, _arenaData, _arena.size()))
+      || (! section(header.arena+_arena.size(), names.constData(), names.size()))) {
+    file.cancelWriting();
+    return false;
+  }
+
+  return file.commit();
 }
 
 
@@ -50,7 +390,7 @@ UserDatabase::User::distance(unsigned id) const {
  * Implementation of UserDatabase
  * ********************************************************************************************* */
 UserDatabase::UserDatabase(bool parallel, unsigned updatePeriodDays, QObject *parent)
-  : QAbstractTableModel(parent), _user(), _network()
+  : QAbstractTableModel(parent), _table(), _order(), _network()
 {
   connect(&_network, SIGNAL(finished(QNetworkReply*)),
           this, SLOT(downloadFinished(QNetworkReply*)));
@@ -59,8 +399,8 @@ UserDatabase::UserDatabase(bool parallel, unsigned updatePeriodDays, QObject *pa
     download();
   else {
     if (parallel) {
-      _parsing = QtConcurrent::run([this]() { QList<User> users; this->parse(users); return users;})
-                   .then(this, [this](const QList<User> &users){ return this->load(users); });
+      _parsing = QtConcurrent::run([this]() { Table users; this->parse(users); return users;})
+                   .then(this, [this](const Table &users){ return this->load(users); });
     } else {
       load();
     }
@@ -69,7 +409,7 @@ UserDatabase::UserDatabase(bool parallel, unsigned updatePeriodDays, QObject *pa
 
 qint64
 UserDatabase::count() const {
-  return _user.size();
+  return _order.size();
 }
 
 bool
@@ -81,7 +421,7 @@ UserDatabase::exists() const {
 
 bool
 UserDatabase::ready() const {
-  return ! _user.empty();
+  return ! _order.empty();
 }
 
 bool
@@ -90,29 +430,34 @@ UserDatabase::load() {
   return load(path+"/user.json");
 }
 
-const UserDatabase::User &
+UserDatabase::User
 UserDatabase::user(int idx) const {
-  return _user[idx];
+  return User(this, _order[idx]);
 }
 
 bool
 UserDatabase::load(const QString &filename) {
-  QList<User> users;
+  Table users;
   if (! parse(filename, users))
     return false;
 
   auto res =  load(users);
-  logDebug() << "Loaded user database with " << _user.size() << " entries from " << filename << ".";
+  logDebug() << "Loaded user database with " << _order.size() << " entries from " << filename << ".";
   return res;
 }
 
 bool
-UserDatabase::load(const QList<User> &users) {
+UserDatabase::load(const Table &users) {
   beginResetModel();
-  _user.clear(); emit readyChanged(false);
-  _user.reserve(users.size());
-  for (auto user: users)
-    _user.append(user);
+  _order.clear(); emit readyChanged(false);
+  _table = users;
+  // Sort users w.r.t. their IDs
+  _order.resize(_table.count());
+  for (uint32_t i=0; i<_table.count(); i++)
+    _order[i] = i;
+  auto byID = [this](uint32_t a, uint32_t b){ return _table.id(a) < _table.id(b); };
+  if (! std::is_sorted(_order.begin(), _order.end(), byID))
+    std::stable_sort(_order.begin(), _order.end(), byID);
   endResetModel();
 
   if (ready())
@@ -122,15 +467,28 @@ UserDatabase::load(const QList<User> &users) {
 }
 
 
+QString
+UserDatabase::snapshotPath(const QString &filename) {
+  QFileInfo info(filename);
+  return info.dir().filePath(info.completeBaseName() + ".snapshot");
+}
+
 bool
-UserDatabase::parse(QList<User> &users) {
+UserDatabase::parse(Table &users) {
   QString path = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
   return parse(path+"/user.json", users);
 }
 
 bool
-UserDatabase::parse(const QString &filename, QList<User> &users)
+UserDatabase::parse(const QString &filename, Table &users)
 {
+  QFileInfo source(filename);
+  QString snapshot = snapshotPath(filename);
+  if (source.exists() && users.map(snapshot, source)) {
+    logDebug() << "Mapped user database snapshot '" << snapshot << "'.";
+    return true;
+  }
+
   QFile file(filename);
   if (! file.open(QIODevice::ReadOnly)) {
     QString msg = QString("Cannot open user list '%1': %2").arg(filename).arg(file.errorString());
@@ -169,44 +527,104 @@ UserDatabase::parse(const QString &filename, QList<User> &users)
     return false;
   }
 
-  users.clear();
+  users = Table();
   QJsonArray array = doc.object()["users"].toArray();
+  // Release the raw data early
+  data.clear();
   users.reserve(array.size());
-  for (int i=0; i<array.size(); i++) {
-    User user(array.at(i).toObject());
-    if (user.isValid())
-      users.append(user);
-  }
-  // Sort repeater w.r.t. their IDs
-  std::stable_sort(_user.begin(), _user.end(), [](const User &a, const User &b){ return a.id < b.id; });
+  for (int i=0; i<array.size(); i++)
+    users.append(array.at(i).toObject());
+  users.finish();
+
+  // Store snapshot for the next time
+  if (! users.write(snapshot, source))
+    logWarn() << "Cannot write user database snapshot '" << snapshot << "'.";
 
   return true;
 }
 
+unsigned
+UserDatabase::distance(unsigned a, unsigned b) {
+  static const uint64_t pow10[] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL,
+    1000000000ULL };
+  // Fix number of digits
+  unsigned ad = 1, bd = 1;
+  for (unsigned x=a; x>=10; x/=10) ad++;
+  for (unsigned x=b; x>=10; x/=10) bd++;
+  int64_t sa = a, sb = b;
+  if (ad > bd)
+    sb *= pow10[ad-bd];
+  else if (bd > ad)
+    sa *= pow10[bd-ad];
+  // Distance is just the difference between these two numbers
+  // this ensures a small distance between two numbers with the same
+  // prefix.
+  uint64_t diff = (sa > sb) ? (sa-sb) : (sb-sa);
+  return std::min(diff, uint64_t(std::numeric_limits<unsigned>::max()));
+}
+
 void
-UserDatabase::sortUsers(unsigned id) {
-  // Sort repeater w.r.t. distance to ID
-  std::stable_sort(_user.begin(), _user.end(), [id](const User &a, const User &b){
-    return a.distance(id) < b.distance(id);
-  });
+UserDatabase::sortUsers(unsigned id, qint64 n) {
+  sortUsers(QSet<unsigned>{id}, n);
 }
 
 void
-UserDatabase::sortUsers(const QSet<unsigned> &ids) {
+UserDatabase::sortUsers(const QSet<unsigned> &ids, qint64 n) {
   if (0 == ids.count())
     return;
 
-  // Sort repeater w.r.t. distance to each ID
-  std::stable_sort(_user.begin(), _user.end(), [ids](const User &a, const User &b){
-    QSet<unsigned>::const_iterator id=ids.begin();
-    unsigned min_a = a.distance(*id), min_b = b.distance(*id);
-    id++;
-    for (; id!=ids.end(); id++) {
-      min_a = std::min(min_a, a.distance(*id));
-      min_b = std::min(min_b, b.distance(*id));
-    }
-    return min_a < min_b;
+  // Sort users w.r.t. their distance to each ID
+  beginResetModel();
+  QVector<quint64> keys = nearestKeys(ids, n);
+  QVector<uint32_t> order(_order.size());
+  for (int i=0; i<keys.size(); i++)
+    order[i] = _order[keys[i] & 0xffffffff];
+  _order = order;
+  endResetModel();
+}
+
+QVector<UserDatabase::User>
+UserDatabase::nearest(const QSet<unsigned> &ids, unsigned n) const {
+  QVector<User> users;
+  if (0 == ids.count())
+    return users;
+
+  QVector<quint64> keys = nearestKeys(ids, n);
+  n = std::min(qint64(n), qint64(keys.size()));
+  users.reserve(n);
+  for (unsigned i=0; i<n; i++)
+    users.append(user(keys[i] & 0xffffffff));
+  return users;
+}
+
+QVector<quint64>
+UserDatabase::nearestKeys(const QSet<unsigned> &ids, qint64 n) const {
+  // Each key holds the minimum distance in the upper and the current index in the lower 32 bits.
+  // Sorting by these keys is therefore equivalent to a stable sort by distance.
+  QVector<quint64> keys(_order.size());
+  for (int i=0; i<keys.size(); i++)
+    keys[i] = i;
+
+  // Compute the distances once and in parallel
+  QVector<unsigned> targets(ids.begin(), ids.end());
+  QtConcurrent::blockingMap(keys, [this, &targets](quint64 &key) {
+    uint32_t id = _table.id(_order[key]);
+    unsigned dist = std::numeric_limits<unsigned>::max();
+    for (unsigned target: targets)
+      dist = std::min(dist, distance(id, target));
+    key |= quint64(dist) << 32;
   });
+
+  if ((0 > n) || (n >= keys.size())) {
+    std::sort(keys.begin(), keys.end());
+  } else {
+    // Only the first n entries need to be sorted
+    std::nth_element(keys.begin(), keys.begin()+n, keys.end());
+    std::sort(keys.begin(), keys.begin()+n);
+  }
+
+  return keys;
 }
 
 void
@@ -262,7 +680,7 @@ UserDatabase::dbAge() const {
 int
 UserDatabase::rowCount(const QModelIndex &parent) const {
   Q_UNUSED(parent);
-  return _user.size();
+  return _order.size();
 }
 
 int
@@ -276,37 +694,38 @@ UserDatabase::data(const QModelIndex &index, int role) const {
   if ((Qt::EditRole != role) && ((Qt::DisplayRole != role)))
     return QVariant();
 
-  if (index.row() >= _user.size())
+  if (index.row() >= _order.size())
     return QVariant();
 
+  User entry = user(index.row());
   if (0 == index.column()) {
     // Call
     if (Qt::DisplayRole == role) {
-      if (_user[index.row()].surname.isEmpty()) {
-        if (_user[index.row()].name.isEmpty()) {
-          return _user[index.row()].call;
+      QString surname = entry.surname(), name = entry.name();
+      if (surname.isEmpty()) {
+        if (name.isEmpty()) {
+          return entry.call();
         } else {
           return tr("%1 (%2)")
-              .arg(_user[index.row()].call)
-              .arg(_user[index.row()].name);
+              .arg(entry.call())
+              .arg(name);
         }
       } else {
         return tr("%1 (%2, %3)")
-            .arg(_user[index.row()].call)
-            .arg(_user[index.row()].name)
-            .arg(_user[index.row()].surname);
+            .arg(entry.call())
+            .arg(name)
+            .arg(surname);
       }
     } else {
-      return _user[index.row()].call;
+      return entry.call();
     }
   } else if (1 == index.column()) {
     // ID
-    return _user[index.row()].id;
+    return entry.id();
   } else if (2 == index.column()) {
     // Country
-    return _user[index.column()].country;
+    return entry.country();
   }
 
   return QVariant();
 }
-
@@ -10,6 +10,9 @@
 #include <QSortFilterProxyModel>
 #include <QGeoPositionInfoSource>
 #include <QFuture>
+#include <QFile>
+#include <QFileInfo>
+#include <QSharedPointer>
 
 /** Auto-updating DMR user database.
  *
@@ -19,6 +22,9 @@
  * to help assemble private call contacts and to assemble so-called CSV callsign databases, that
  * are programmable to some DMR radios to resolve the DMR ID to callsigns and names.
  *
+ * After parsing the downloaded JSON file, a binary snapshot of the database is stored next to it
+ * (@c user.snapshot). Subsequent loads just map this snapshot, unless the JSON file has changed.
+ *
  * @ingroup util */
 class UserDatabase : public QAbstractTableModel
 {
@@ -28,36 +34,51 @@ class UserDatabase : public QAbstractTableModel
   Q_PROPERTY(bool ready READ ready NOTIFY readyChanged FINAL)
 
 public:
-  /** Represents the user information within the @c UserDatabase. */
+  /** A lightweight view of a user within the @c UserDatabase.
+   *
+   * The user information is not stored per user, but column-wise within the database. This view
+   * just references a row of the database, the strings are decoded on access. Hence, a view is
+   * cheap to copy but becomes invalid, once the database gets reloaded. */
   class User {
   public:
-    /** Empty constructor. */
+    /** Empty constructor, constructs an invalid view. */
     User();
-    /** Constructs entry from JSON object. */
-    User(const QJsonObject &obj);
 
+  protected:
+    /** Constructs a view of the specified row of the database. */
+    User(const UserDatabase *db, uint32_t row);
+
+  public:
     /** Returns @c true if the entry is valid. */
-    inline bool isValid() const { return 0 != id; }
+    inline bool isValid() const { return 0 != id(); }
 
     /** Returns the "distance" between this user and the given ID. */
     unsigned distance(unsigned id) const;
 
     /** The DMR ID of the user. */
-    unsigned id;
+    unsigned id() const;
     /** The callsign of the user. */
-    QString call;
+    QString call() const;
     /** The name of the user. */
-    QString name;
+    QString name() const;
     /** The surname of the user. */
-    QString surname;
+    QString surname() const;
     /** The city of the user. */
-    QString city;
+    QString city() const;
     /** The state of the user. */
-    QString state;
+    QString state() const;
     /** The country of the user. */
-    QString country;
+    QString country() const;
     /** Some arbitrary comment or text. */
-    QString comment;
+    QString comment() const;
+
+  protected:
+    /** A weak reference to the database. */
+    const UserDatabase *_db;
+    /** The row within the database. */
+    uint32_t _row;
+
+    friend class UserDatabase;
   };
 
 public:
@@ -79,13 +100,23 @@ public:
   /** Returns @c true, if the database has been loaded. */
   bool ready() const;
 
-  /** Sorts users with respect to the distance to the given ID. */
-  void sortUsers(unsigned id);
-  /** Sorts users with respect to the minimum distance to the given IDs. */
-  void sortUsers(const QSet<unsigned> &ids);
+  /** Sorts users with respect to the distance to the given ID.
+   * If @c n is non-negative, only the @c n nearest users are sorted and placed first. The order of
+   * the remaining users is unspecified. */
+  void sortUsers(unsigned id, qint64 n=-1);
+  /** Sorts users with respect to the minimum distance to the given IDs.
+   * If @c n is non-negative, only the @c n nearest users are sorted and placed first. The order of
+   * the remaining users is unspecified. */
+  void sortUsers(const QSet<unsigned> &ids, qint64 n=-1);
+  /** Returns the @c n users nearest to the given IDs, sorted by their distance. */
+  QVector<User> nearest(const QSet<unsigned> &ids, unsigned n) const;
 
-  /** Returns the user with index @c idx. */
-  const User &user(int idx) const;
+  /** Returns the "distance" between the two IDs. That is, the difference between the IDs after
+   * scaling both to the same number of digits. Hence, IDs with a common prefix are close. */
+  static unsigned distance(unsigned a, unsigned b);
+
+  /** Returns a view of the user with index @c idx. */
+  User user(int idx) const;
 
   /** Returns the age of the database in days. */
   unsigned dbAge() const;
@@ -115,16 +146,124 @@ public slots:
 private slots:
   /** Gets called whenever the download is complete. */
   void downloadFinished(QNetworkReply *reply);
-  /** Parses cache and stores all users in given result list. */
-  bool parse(QList<User> &users);
-  /** Parses the given file and stores all users in given result list. */
-  bool parse(const QString &filename, QList<User> &users);
-  /** Loads all entries from the parsed file. */
-  bool load(const QList<User> &users);
 
 private:
-  /** Holds all users sorted by their ID. */
-  QVector<User>         _user;
+  /** Identifies the string columns stored within the arena. */
+  enum class Field {
+    Call = 0, Name, Surname, City, Comment, Count
+  };
+
+  /** References a UTF-8 encoded string within the arena. */
+  struct StringRef {
+    /** Offset within the arena. */
+    uint32_t offset;
+    /** Length in bytes. */
+    uint32_t length;
+  };
+
+  /** Column-wise storage of all users.
+   *
+   * All strings are stored UTF-8 encoded in a single arena and referenced by offset and length.
+   * Countries and states are interned, as there are only a few distinct ones.
+   *
+   * The columns are either owned by the table (after parsing the JSON user database) or are
+   * mapped directly from a binary snapshot file. */
+  class Table {
+  public:
+    /** Empty constructor. */
+    Table();
+
+    /** Returns the number of rows. */
+    inline uint32_t count() const { return _count; }
+    /** Reserves space for @c n rows. */
+    void reserve(uint32_t n);
+    /** Appends a row from the given JSON object. Invalid users are skipped.
+     * @returns @c true if the user was added. */
+    bool append(const QJsonObject &obj);
+    /** Must be called after the last row was appended. Releases unused memory and the intern
+     * tables. */
+    void finish();
+
+    /** Maps the given binary snapshot. The snapshot is considered stale and gets rejected if it
+     * does not match the given source file.
+     * @returns @c true on success. */
+    bool map(const QString &filename, const QFileInfo &source);
+    /** Writes a binary snapshot of this table to the given file. */
+    bool write(const QString &filename, const QFileInfo &source) const;
+
+    /** Returns the ID of the given row. */
+    inline uint32_t id(uint32_t row) const { return _idColumn[row]; }
+    /** Returns the specified string of the given row. */
+    QString string(uint32_t row, Field field) const;
+    /** Returns the state of the given row. */
+    QString state(uint32_t row) const;
+    /** Returns the country of the given row. */
+    QString country(uint32_t row) const;
+
+  protected:
+    /** Adds a string to the arena. */
+    StringRef store(const QString &str);
+    /** Interns the given string. */
+    static uint16_t intern(const QString &str, QStringList &list, QHash<QString, uint16_t> &index);
+    /** Points the column pointers to the owned columns. */
+    void updateColumns();
+
+  protected:
+    /** The number of rows. */
+    uint32_t _count;
+    /** All strings, UTF-8 encoded. */
+    QByteArray _arena;
+    /** The DMR IDs. */
+    QVector<uint32_t> _ids;
+    /** The string references, @c Field::Count per row. */
+    QVector<StringRef> _strings;
+    /** Index of the state for each row. */
+    QVector<uint16_t> _state;
+    /** Index of the country for each row. */
+    QVector<uint16_t> _country;
+    /** The interned states. */
+    QStringList _states;
+    /** The interned countries. */
+    QStringList _countries;
+    /** Maps states to their index, only used during parsing. */
+    QHash<QString, uint16_t> _stateIndex;
+    /** Maps countries to their index, only used during parsing. */
+    QHash<QString, uint16_t> _countryIndex;
+
+    /** The mapped snapshot file, if any. */
+    QSharedPointer<QFile> _snapshot;
+    /** Points to the arena, either owned or mapped. */
+    const char *_arenaData;
+    /** Points to the ID column, either owned or mapped. */
+    const uint32_t *_idColumn;
+    /** Points to the string references, either owned or mapped. */
+    const StringRef *_stringColumn;
+    /** Points to the state column, either owned or mapped. */
+    const uint16_t *_stateColumn;
+    /** Points to the country column, either owned or mapped. */
+    const uint16_t *_countryColumn;
+  };
+
+  /** Returns the path to the binary snapshot of the given JSON user database. */
+  static QString snapshotPath(const QString &filename);
+  /** Parses cache and stores all users in given table. */
+  bool parse(Table &users);
+  /** Parses the given file and stores all users in given table. If there is an up-to-date binary
+   * snapshot of the file, the snapshot gets mapped instead. Otherwise, a snapshot gets written
+   * after parsing. */
+  bool parse(const QString &filename, Table &users);
+  /** Loads all entries from the parsed table. */
+  bool load(const Table &users);
+  /** Computes the minimum distance of all users to the given IDs and sorts the users accordingly.
+   * If @c n is non-negative, only the first @c n keys are sorted. Each key holds the distance in
+   * the upper and the index of the user in the lower 32 bits. */
+  QVector<quint64> nearestKeys(const QSet<unsigned> &ids, qint64 n) const;
+
+private:
+  /** Holds all users. */
+  Table                 _table;
+  /** Maps the user index to the row within the table. Initially sorted by ID. */
+  QVector<uint32_t>     _order;
   /** The network access used for downloading. */
   QNetworkAccessManager _network;
   /** The current parallel task of parsing the database. */
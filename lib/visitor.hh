@@ -27,6 +27,8 @@ public:
   virtual ~Visitor();
 
   /** Traverses the properties of the configuration recursively.
+   * Visitors modifying the configuration should override this method and wrap the traversal into
+   * a batch update (see @c Config::UpdateGuard).
    * @returns @c true on success. Error information can be found in the error stack, if passed. */
   virtual bool process(Config *config, const ErrorStack &err=ErrorStack());
 
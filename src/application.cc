@@ -54,7 +54,8 @@ inline QStringList getLanguages() {
 }
 
 Application::Application(int &argc, char *argv[])
-  : QApplication(argc, argv), _config(nullptr), _mainWindow(nullptr), _translator(nullptr),
+  : QApplication(argc, argv), _config(nullptr), _limitCache(nullptr), _limitCacheRadio(),
+    _mainWindow(nullptr), _translator(nullptr),
     _repeater(nullptr), _satellites(nullptr), _lastDevice()
 {
   setApplicationName("qdmr");
@@ -103,6 +104,7 @@ Application::Application(int &argc, char *argv[])
 
   // create empty codeplug
   _config     = new Config(this);
+  _limitCache = new RadioLimitCache(this);
 
   // load position
   _currentPosition = settings.position();
@@ -479,14 +481,23 @@ Application::verifyCodeplug(Radio *radio, bool showSuccess) {
   }
 
   ErrorStack err;
-  Config *intermediate = myRadio->codeplug().preprocess(_config, err);
+  QHash<const ConfigObject *, const ConfigObject *> origins;
+  Config *intermediate = myRadio->codeplug().preprocessWithOrigins(_config, origins, err);
   if (nullptr == intermediate) {
     ErrorMessageView(err).exec();
     return false;
   }
 
+  // Only objects modified since the last verification with this radio get verified again.
+  if (myRadio->name() != _limitCacheRadio) {
+    _limitCache->clear();
+    _limitCacheRadio = myRadio->name();
+  }
+
   Settings settings;
   RadioLimitContext ctx(settings.ignoreFrequencyLimits());
+  ctx.setCache(_limitCache);
+  ctx.setOrigins(origins);
   myRadio->limits().verifyConfig(intermediate, ctx);
 
   bool verified = true;
@@ -571,7 +582,8 @@ Application::onCodeplugDownloaded(Radio *radio, Codeplug *codeplug) {
 
   ErrorStack err;
   if (codeplug->decode(_config, err)) {
-    _mainWindow->statusBar()->showMessage(tr("Read complete"));
+    _mainWindow->statusBar()->showMessage(tr("Read complete: %1").arg(radio->stats().summary()));
+    logInfo() << "Read complete: " << radio->stats().summary();
     _mainWindow->findChild<QProgressBar *>("progress")->setVisible(false);
     _config->setModified(false);
   } else {
@@ -668,6 +680,14 @@ Application::uploadCallsignDB() {
   // Sort call-sign DB w.r.t. the current DMR ID in _config
   // this is part of the "auto-selection" of calls-signs for upload
   Settings settings;
+  // Only the entries written to the device need to be sorted. If the capacity of the DB is
+  // unknown, all entries get sorted.
+  qint64 numEntries = -1;
+  if (radio->callsignDB())
+    numEntries = radio->callsignDB()->maxEntries();
+  if (settings.limitCallSignDBEntries()
+      && ((0 > numEntries) || (settings.maxCallSignDBEntries() < numEntries)))
+    numEntries = settings.maxCallSignDBEntries();
   if (settings.selectUsingUserDMRID()) {
     if (nullptr == _config->settings()->defaultId()) {
       QMessageBox::critical(nullptr, tr("Cannot write call-sign DB."),
@@ -679,14 +699,14 @@ Application::uploadCallsignDB() {
     // Sort w.r.t users DMR ID
     unsigned id = _config->settings()->defaultId()->number();
     logDebug() << "Sort call-signs closest to ID=" << id << ".";
-    _users->sortUsers(id);
+    _users->sortUsers(id, numEntries);
   } else {
     // sort w.r.t. chosen prefixes
     QSet<unsigned> ids=settings.callSignDBPrefixes(); QStringList prefs;
     foreach (unsigned pref, ids)
       prefs.append(QString::number(pref));
     logDebug() << "Sort call-signs closest to IDs={" << prefs.join(", ") << "}.";
-    _users->sortUsers(ids);
+    _users->sortUsers(ids, numEntries);
   }
 
   // Assemble flags for callsign DB encoding
@@ -754,7 +774,7 @@ Application::uploadSatellites() {
   progress->setRange(0, 100); progress->setValue(0);
   progress->setVisible(true);
 
-  connect(radio, SIGNAL(uploadProgress(int)), progress, SLOT(setValue(int)));
+  connect(radio, &Radio::uploadProgress, this, &Application::onProgress);
   connect(radio, SIGNAL(uploadError(Radio *)), this, SLOT(onCodeplugUploadError(Radio *)));
   connect(radio, SIGNAL(uploadComplete(Radio *)), this, SLOT(onCodeplugUploaded(Radio *)));
 
@@ -777,6 +797,15 @@ Application::onProgress(int value) {
   if (value >= 0)
     progress->setMaximum(100);
   progress->setValue(value);
+
+  // Show the current phase of the transfer, if known
+  QString phase;
+  if (Radio *radio = qobject_cast<Radio *>(sender()))
+    phase = radio->stats().currentPhase();
+  if (phase.isEmpty())
+    progress->setFormat("%p%");
+  else
+    progress->setFormat(tr("%1: %p%").arg(phase));
 }
 
 void
@@ -793,8 +822,9 @@ Application::onCodeplugUploadError(Radio *radio) {
 
 void
 Application::onCodeplugUploaded(Radio *radio) {
-  _mainWindow->statusBar()->showMessage(tr("Write complete"));
+  _mainWindow->statusBar()->showMessage(tr("Write complete: %1").arg(radio->stats().summary()));
   _mainWindow->findChild<QProgressBar *>("progress")->setVisible(false);
+  logInfo() << "Write complete: " << radio->stats().summary();
   _mainWindow->setEnabled(true);
 
   logDebug() << "Write complete.";
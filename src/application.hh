@@ -26,6 +26,7 @@ class PositioningSystemListView;
 class RoamingChannelListView;
 class RoamingZoneListView;
 class ExtensionView;
+class RadioLimitCache;
 
 
 class Application : public QApplication
@@ -93,6 +94,10 @@ private slots:
 
 protected:
   Config *_config;
+  /** Keeps the verification issues of the codeplug objects between verifications. */
+  RadioLimitCache *_limitCache;
+  /** The name of the radio, the cached issues belong to. */
+  QString _limitCacheRadio;
   MainWindow *_mainWindow;
   QTranslator *_translator;
 
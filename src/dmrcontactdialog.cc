@@ -139,7 +139,7 @@ DMRContactDialog::onCompleterActivated(const QModelIndex &idx) {
     if (nullptr == model)
       return;
     QModelIndex srcidx = model->mapToSource(idx);
-    ui->numberLineEdit->setText(QString::number(db->user(srcidx.row()).id));
+    ui->numberLineEdit->setText(QString::number(db->user(srcidx.row()).id()));
   } else if (1 == ui->typeComboBox->currentIndex()) { // Group call
     if (nullptr == _tg_completer)
       return;
@@ -50,6 +50,9 @@ int main(int argc, char *argv[])
     }
   }
 
+  // Do not stall transfers on console or file I/O
+  Logger::get().setAsynchronous(true);
+
   auto mainWindow = app.mainWindow();
   mainWindow->show();
 
@@ -61,5 +64,8 @@ int main(int argc, char *argv[])
 
   app.exec();
 
+  // Pass pending messages to the handlers, before the stream gets destroyed.
+  Logger::get().setAsynchronous(false);
+
   return 0;
 }
@@ -0,0 +1,99 @@
+#include "addressmaptest.hh"
+#include <QTest>
+
+AddressMapTest::AddressMapTest(QObject *parent)
+  : QObject(parent), _map(), _addresses()
+{
+  // pass...
+}
+
+void
+AddressMapTest::initTestCase() {
+  // Mimics an AnyTone codeplug: 4000 channels of 64b in banks of 128 channels each, many small
+  // elements of 16b and some unaligned ones.
+  int idx = 0;
+  for (int bank=0; bank<32; bank++)
+    _map.add(0x00800000 + bank*0x40000, 128*0x40, idx++);
+  for (int i=0; i<10000; i++)
+    _map.add(0x02600000 + i*0x20, 0x10, idx++);
+  for (int i=0; i<250; i++)
+    _map.add(0x02a00000 + i*0x100, 0x0f, idx++);
+
+  // Sample addresses to look up
+  for (int bank=0; bank<32; bank++)
+    for (int i=0; i<128; i++)
+      _addresses.push_back(0x00800000 + bank*0x40000 + i*0x40 + (i%0x40));
+  for (int i=0; i<20000; i++)
+    _addresses.push_back(0x02600000 + i*0x10);
+  for (int i=0; i<250; i++)
+    _addresses.push_back(0x02a00000 + i*0x100 + (i%0x10));
+}
+
+void
+AddressMapTest::testFind() {
+  AddressMap map;
+  map.add(0x1000, 0x100);
+  map.add(0x2000, 0x10);
+  map.add(0x2010, 0x08);
+
+  QCOMPARE(map.find(0x0fff), -1);
+  QCOMPARE(map.find(0x1000), 0);
+  QCOMPARE(map.find(0x10ff), 0);
+  QCOMPARE(map.find(0x1100), -1);
+  QCOMPARE(map.find(0x2000), 1);
+  QCOMPARE(map.find(0x2017), 2);
+  QCOMPARE(map.find(0x2018), -1);
+}
+
+void
+AddressMapTest::testFlatFind() {
+  AddressMap flat(_map);
+  flat.setFlat(true);
+  QVERIFY(flat.isFlat());
+
+  for (uint32_t addr: _addresses)
+    QCOMPARE(flat.find(addr), _map.find(addr));
+  // Check some unmapped addresses too
+  for (uint32_t addr=0x02a00000; addr<0x02a00400; addr++)
+    QCOMPARE(flat.find(addr), _map.find(addr));
+  QCOMPARE(flat.find(0x00000000), -1);
+  QCOMPARE(flat.find(0xfffffff0), -1);
+}
+
+void
+AddressMapTest::testFlatRemove() {
+  AddressMap map;
+  map.setFlat(true);
+  map.add(0x1000, 0x100);
+  map.add(0x2000, 0x10);
+  QCOMPARE(map.find(0x2008), 1);
+  QVERIFY(map.rem(1));
+  QCOMPARE(map.find(0x2008), -1);
+  QCOMPARE(map.find(0x1080), 0);
+  map.clear();
+  QCOMPARE(map.find(0x1080), -1);
+}
+
+void
+AddressMapTest::benchmarkFind_data() {
+  QTest::addColumn<bool>("flat");
+  QTest::newRow("binary search") << false;
+  QTest::newRow("page table") << true;
+}
+
+void
+AddressMapTest::benchmarkFind() {
+  QFETCH(bool, flat);
+
+  AddressMap map(_map);
+  map.setFlat(flat);
+
+  int sum = 0;
+  QBENCHMARK {
+    for (uint32_t addr: _addresses)
+      sum += map.find(addr);
+  }
+  QVERIFY(0 != sum);
+}
+
+QTEST_GUILESS_MAIN(AddressMapTest)
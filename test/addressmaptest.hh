@@ -0,0 +1,29 @@
+#ifndef ADDRESSMAPTEST_HH
+#define ADDRESSMAPTEST_HH
+
+#include <QObject>
+#include "addressmap.hh"
+
+class AddressMapTest : public QObject
+{
+  Q_OBJECT
+
+public:
+  explicit AddressMapTest(QObject *parent = nullptr);
+
+private slots:
+  void initTestCase();
+
+  void testFind();
+  void testFlatFind();
+  void testFlatRemove();
+
+  void benchmarkFind_data();
+  void benchmarkFind();
+
+protected:
+  AddressMap _map;
+  std::vector<uint32_t> _addresses;
+};
+
+#endif // ADDRESSMAPTEST_HH
@@ -0,0 +1,488 @@
+#include "anytoneinterfacetest.hh"
+#include "anytone_interface.hh"
+#include "transferstats.hh"
+#include <QTest>
+#include <QtEndian>
+#include <QElapsedTimer>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+
+#define FAKE_VID 0x28e9
+#define FAKE_PID 0x018a
+
+
+/* ********************************************************************************************* *
+ * Implementation of FakeAnytoneRadio
+ * ********************************************************************************************* */
+FakeAnytoneRadio::FakeAnytoneRadio(unsigned int latencyUs)
+  : _master(-1), _slave(-1), _device(), _latency(latencyUs), _running(false), _readRequests(0),
+    _writeRequests(0), _nakWrite(0), _misplacedRead(0), _mutex(), _written(), _thread()
+{
+  if (0 > (_master = posix_openpt(O_RDWR | O_NOCTTY)))
+    return;
+  if ((0 != grantpt(_master)) || (0 != unlockpt(_master))) {
+    ::close(_master); _master = -1;
+    return;
+  }
+  _device = QString::fromLocal8Bit(ptsname(_master));
+
+  // Keep slave open and raw, such that no data gets lost or processed.
+  if (0 > (_slave = ::open(ptsname(_master), O_RDWR | O_NOCTTY))) {
+    ::close(_master); _master = -1;
+    return;
+  }
+  struct termios tio;
+  tcgetattr(_slave, &tio);
+  cfmakeraw(&tio);
+  tcsetattr(_slave, TCSANOW, &tio);
+
+  _running = true;
+  _thread = std::thread(&FakeAnytoneRadio::run, this);
+}
+
+FakeAnytoneRadio::~FakeAnytoneRadio() {
+  _running = false;
+  if (_thread.joinable())
+    _thread.join();
+  if (0 <= _slave)
+    ::close(_slave);
+  if (0 <= _master)
+    ::close(_master);
+}
+
+bool
+FakeAnytoneRadio::isOpen() const {
+  return 0 <= _master;
+}
+
+const QString &
+FakeAnytoneRadio::device() const {
+  return _device;
+}
+
+unsigned int
+FakeAnytoneRadio::readRequests() const {
+  return _readRequests;
+}
+
+unsigned int
+FakeAnytoneRadio::writeRequests() const {
+  return _writeRequests;
+}
+
+void
+FakeAnytoneRadio::setLatency(unsigned int latencyUs) {
+  _latency = latencyUs;
+}
+
+void
+FakeAnytoneRadio::setNAKWrite(unsigned int n) {
+  _nakWrite = n;
+}
+
+void
+FakeAnytoneRadio::setMisplacedRead(unsigned int n) {
+  _misplacedRead = n;
+}
+
+QByteArray
+FakeAnytoneRadio::written(uint32_t addr) const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _written.value(addr);
+}
+
+uint8_t
+FakeAnytoneRadio::byteAt(uint32_t addr) {
+  return (addr*31 + (addr>>8)) & 0xff;
+}
+
+void
+FakeAnytoneRadio::run() {
+  QByteArray buffer;
+  char tmp[4096];
+  while (_running) {
+    struct pollfd pfd = {_master, POLLIN, 0};
+    if (0 >= poll(&pfd, 1, 10))
+      continue;
+    ssize_t n = ::read(_master, tmp, sizeof(tmp));
+    if (0 >= n)
+      continue;
+    buffer.append(tmp, n);
+
+    // Simulate link latency once per received batch
+    usleep(_latency);
+
+    QByteArray response;
+    int consumed;
+    while (0 < (consumed = handle(buffer, response)))
+      buffer.remove(0, consumed);
+    if (response.size())
+      ::write(_master, response.constData(), response.size());
+  }
+}
+
+int
+FakeAnytoneRadio::handle(const QByteArray &buffer, QByteArray &response) {
+  if (buffer.isEmpty())
+    return 0;
+
+  switch (buffer.at(0)) {
+  case 'P': // PROGRAM
+    if (7 > buffer.size())
+      return 0;
+    response.append("QX\6", 3);
+    return 7;
+
+  case '\2': { // identify
+    char info[16] = {'I', 'D', '8', '7', '8', 'U', 'V', 0, 0, 'V', '1', '0', '0', 0, 0, 6};
+    response.append(info, 16);
+    return 1;
+  }
+
+  case 'R': { // read request
+    if (6 > buffer.size())
+      return 0;
+    uint32_t addr = qFromBigEndian<uint32_t>(buffer.constData()+1);
+    if (++_readRequests == _misplacedRead)
+      addr += 0x00100000;
+    char resp[24];
+    resp[0] = 'W';
+    qToBigEndian<uint32_t>(addr, resp+1);
+    resp[5] = 16;
+    for (int i=0; i<16; i++)
+      resp[6+i] = byteAt(addr+i);
+    uint8_t sum = 0;
+    for (int i=1; i<22; i++)
+      sum += uint8_t(resp[i]);
+    resp[22] = sum;
+    resp[23] = 6;
+    response.append(resp, 24);
+    return 6;
+  }
+
+  case 'W': { // write request
+    if (24 > buffer.size())
+      return 0;
+    uint8_t sum = 0;
+    for (int i=1; i<22; i++)
+      sum += uint8_t(buffer.at(i));
+    if ((++_writeRequests == _nakWrite) || (sum != uint8_t(buffer.at(22)))) {
+      response.append('\x15');
+      return 24;
+    }
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _written.insert(qFromBigEndian<uint32_t>(buffer.constData()+1), buffer.mid(6, 16));
+    }
+    response.append('\6');
+    return 24;
+  }
+
+  case 'E': // END
+    if (3 > buffer.size())
+      return 0;
+    response.append('\6');
+    return 3;
+
+  default:
+    break;
+  }
+
+  // Skip unknown byte
+  return 1;
+}
+
+
+/* ********************************************************************************************* *
+ * Implementation of AnytoneInterfaceTest
+ * ********************************************************************************************* */
+AnytoneInterfaceTest::AnytoneInterfaceTest(QObject *parent)
+  : QObject(parent)
+{
+  // pass...
+}
+
+void
+AnytoneInterfaceTest::testRead_data() {
+  QTest::addColumn<unsigned int>("window");
+  QTest::newRow("lock-step") << 1U;
+  QTest::newRow("window 4") << 4U;
+  QTest::newRow("window 32") << 32U;
+}
+
+void
+AnytoneInterfaceTest::testRead() {
+  QFETCH(unsigned int, window);
+
+  FakeAnytoneRadio radio(0);
+  if (! radio.isOpen())
+    QSKIP("Cannot create pseudo terminal.");
+
+  ErrorStack err;
+  AnytoneInterface device(USBSerial::Descriptor(FAKE_VID, FAKE_PID, radio.device()), err);
+  if (! device.isOpen())
+    QFAIL(err.format().toLocal8Bit().constData());
+  device.setReadWindow(window);
+
+  QByteArray data(0x1000, 0x00);
+  if (! device.read(0, 0x02c00000, (uint8_t *)data.data(), data.size(), err))
+    QFAIL(err.format().toLocal8Bit().constData());
+
+  QCOMPARE(radio.readRequests(), unsigned(data.size()/16));
+  for (int i=0; i<data.size(); i++)
+    QCOMPARE(uint8_t(data.at(i)), FakeAnytoneRadio::byteAt(0x02c00000+i));
+}
+
+void
+AnytoneInterfaceTest::testReadUnaligned_data() {
+  testRead_data();
+}
+
+void
+AnytoneInterfaceTest::testReadUnaligned() {
+  QFETCH(unsigned int, window);
+
+  FakeAnytoneRadio radio(0);
+  if (! radio.isOpen())
+    QSKIP("Cannot create pseudo terminal.");
+
+  ErrorStack err;
+  AnytoneInterface device(USBSerial::Descriptor(FAKE_VID, FAKE_PID, radio.device()), err);
+  if (! device.isOpen())
+    QFAIL(err.format().toLocal8Bit().constData());
+  device.setReadWindow(window);
+  TransferStats stats;
+  device.setStats(&stats);
+
+  // The trailing partial block gets read but only the requested bytes are copied.
+  QByteArray data(0x48, 0x00);
+  if (! device.read(0, 0x02c00000, (uint8_t *)data.data(), 0x44, err))
+    QFAIL(err.format().toLocal8Bit().constData());
+
+  QCOMPARE(radio.readRequests(), 5U);
+  // Each request is recorded, not the call
+  QCOMPARE(stats.requests(), quint64(5));
+  QCOMPARE(stats.bytes(TransferStats::Direction::Read), quint64(0x44));
+  for (int i=0; i<0x44; i++)
+    QCOMPARE(uint8_t(data.at(i)), FakeAnytoneRadio::byteAt(0x02c00000+i));
+  for (int i=0x44; i<data.size(); i++)
+    QCOMPARE(uint8_t(data.at(i)), uint8_t(0x00));
+}
+
+void
+AnytoneInterfaceTest::testRoundTripProbe() {
+  FakeAnytoneRadio radio(2000);
+  if (! radio.isOpen())
+    QSKIP("Cannot create pseudo terminal.");
+
+  ErrorStack err;
+  AnytoneInterface device(USBSerial::Descriptor(FAKE_VID, FAKE_PID, radio.device()), err);
+  if (! device.isOpen())
+    QFAIL(err.format().toLocal8Bit().constData());
+
+  // Entering the program mode and identifying the radio already probes the round-trip time.
+  QVERIFY(2000 <= device.roundTripTime());
+  QVERIFY(1000 > device.roundTripTime()/1000);
+
+  // Derived response times stay within the conservative bounds.
+  QVERIFY(250 <= device.responseTimeout(1000));
+  QVERIFY(1000 >= device.responseTimeout(1000));
+
+  // Lock-step requests keep updating the estimate
+  QByteArray data(0x100, 0x00);
+  if (! device.read(0, 0x02c00000, (uint8_t *)data.data(), data.size(), err))
+    QFAIL(err.format().toLocal8Bit().constData());
+  QVERIFY(2000 <= device.roundTripTime());
+}
+
+void
+AnytoneInterfaceTest::testFastResponse() {
+  FakeAnytoneRadio radio(100);
+  if (! radio.isOpen())
+    QSKIP("Cannot create pseudo terminal.");
+
+  ErrorStack err;
+  AnytoneInterface device(USBSerial::Descriptor(FAKE_VID, FAKE_PID, radio.device()), err);
+  if (! device.isOpen())
+    QFAIL(err.format().toLocal8Bit().constData());
+
+  // Every lock-step request returns as soon as the response arrived. Waiting for any timeout
+  // (at least 250ms each) instead, would take more than 16s.
+  QElapsedTimer timer; timer.start();
+  QByteArray data(0x400, 0x00);
+  if (! device.read(0, 0x02c00000, (uint8_t *)data.data(), data.size(), err))
+    QFAIL(err.format().toLocal8Bit().constData());
+  QCOMPARE(radio.readRequests(), unsigned(data.size()/16));
+  QVERIFY(2000 > timer.elapsed());
+}
+
+void
+AnytoneInterfaceTest::testReadFallback() {
+  FakeAnytoneRadio radio(0);
+  if (! radio.isOpen())
+    QSKIP("Cannot create pseudo terminal.");
+  radio.setMisplacedRead(3);
+
+  ErrorStack err;
+  AnytoneInterface device(USBSerial::Descriptor(FAKE_VID, FAKE_PID, radio.device()), err);
+  if (! device.isOpen())
+    QFAIL(err.format().toLocal8Bit().constData());
+  device.setReadWindow(32);
+
+  // A response for an unexpected address aborts the pipelined read. The read gets repeated in
+  // lock-step and the window stays at 1 for all further reads.
+  QByteArray data(0x400, 0x00);
+  if (! device.read(0, 0x02c00000, (uint8_t *)data.data(), data.size(), err))
+    QFAIL(err.format().toLocal8Bit().constData());
+  QCOMPARE(device.readWindow(), 1U);
+  for (int i=0; i<data.size(); i++)
+    QCOMPARE(uint8_t(data.at(i)), FakeAnytoneRadio::byteAt(0x02c00000+i));
+}
+
+void
+AnytoneInterfaceTest::testSlowResponse() {
+  FakeAnytoneRadio radio(2000);
+  if (! radio.isOpen())
+    QSKIP("Cannot create pseudo terminal.");
+
+  ErrorStack err;
+  AnytoneInterface device(USBSerial::Descriptor(FAKE_VID, FAKE_PID, radio.device()), err);
+  if (! device.isOpen())
+    QFAIL(err.format().toLocal8Bit().constData());
+  QVERIFY(500 > device.responseTimeout(1000));
+
+  // The radio slows down beyond the derived timeout but answers within the fallback.
+  radio.setLatency(600000);
+  QByteArray data(0x10, 0x00);
+  if (! device.read(0, 0x02c00000, (uint8_t *)data.data(), data.size(), err))
+    QFAIL(err.format().toLocal8Bit().constData());
+  QCOMPARE(uint8_t(data.at(0)), FakeAnytoneRadio::byteAt(0x02c00000));
+}
+
+
+void
+AnytoneInterfaceTest::testWrite_data() {
+  QTest::addColumn<unsigned int>("window");
+  QTest::newRow("lock-step") << 1U;
+  QTest::newRow("window 4") << 4U;
+  QTest::newRow("window 32") << 32U;
+}
+
+void
+AnytoneInterfaceTest::testWrite() {
+  QFETCH(unsigned int, window);
+
+  FakeAnytoneRadio radio(0);
+  if (! radio.isOpen())
+    QSKIP("Cannot create pseudo terminal.");
+
+  ErrorStack err;
+  AnytoneInterface device(USBSerial::Descriptor(FAKE_VID, FAKE_PID, radio.device()), err);
+  if (! device.isOpen())
+    QFAIL(err.format().toLocal8Bit().constData());
+  device.setWriteWindow(window);
+  TransferStats stats;
+  device.setStats(&stats);
+
+  QByteArray data(0x1000, 0x00);
+  for (int i=0; i<data.size(); i++)
+    data[i] = char(FakeAnytoneRadio::byteAt(i));
+  if (! device.write(0, 0x02c00000, (uint8_t *)data.data(), data.size(), err))
+    QFAIL(err.format().toLocal8Bit().constData());
+
+  QCOMPARE(radio.writeRequests(), unsigned(data.size()/16));
+  QCOMPARE(stats.requests(), quint64(data.size()/16));
+  QCOMPARE(stats.bytes(TransferStats::Direction::Write), quint64(data.size()));
+  for (int i=0; i<data.size(); i+=16)
+    QCOMPARE(radio.written(0x02c00000+i), data.mid(i, 16));
+}
+
+void
+AnytoneInterfaceTest::testWriteNAK_data() {
+  QTest::addColumn<unsigned int>("window");
+  QTest::newRow("lock-step") << 1U;
+  QTest::newRow("window 8") << 8U;
+}
+
+void
+AnytoneInterfaceTest::testWriteNAK() {
+  QFETCH(unsigned int, window);
+
+  FakeAnytoneRadio radio(0);
+  if (! radio.isOpen())
+    QSKIP("Cannot create pseudo terminal.");
+  // Reject a request in the middle of the second window
+  radio.setNAKWrite(13);
+
+  ErrorStack err;
+  AnytoneInterface device(USBSerial::Descriptor(FAKE_VID, FAKE_PID, radio.device()), err);
+  if (! device.isOpen())
+    QFAIL(err.format().toLocal8Bit().constData());
+  device.setWriteWindow(window);
+
+  QByteArray data(0x200, 0x00);
+  QVERIFY(! device.write(0, 0x02c00000, (uint8_t *)data.data(), data.size(), err));
+  QVERIFY(! err.isEmpty());
+
+  // All requests before the rejected one were written
+  for (int i=0; i<12; i++)
+    QVERIFY(! radio.written(0x02c00000+16*i).isEmpty());
+  QVERIFY(radio.written(0x02c00000+16*12).isEmpty());
+  // In pipelined mode, the failing address is reported from the position of the NAK.
+  if (1 < window)
+    QVERIFY(err.format().contains("2c000c0"));
+}
+
+void
+AnytoneInterfaceTest::testWriteUnaligned() {
+  FakeAnytoneRadio radio(0);
+  if (! radio.isOpen())
+    QSKIP("Cannot create pseudo terminal.");
+
+  ErrorStack err;
+  AnytoneInterface device(USBSerial::Descriptor(FAKE_VID, FAKE_PID, radio.device()), err);
+  if (! device.isOpen())
+    QFAIL(err.format().toLocal8Bit().constData());
+  device.setWriteWindow(8);
+
+  QByteArray data(0x48, 0x00);
+  QVERIFY(! device.write(0, 0x02c00000, (uint8_t *)data.data(), 0x44, err));
+  QCOMPARE(radio.writeRequests(), 0U);
+}
+
+
+void
+AnytoneInterfaceTest::benchmarkRead_data() {
+  QTest::addColumn<unsigned int>("window");
+  QTest::newRow("lock-step") << 1U;
+  QTest::newRow("window 8") << 8U;
+  QTest::newRow("window 32") << 32U;
+}
+
+void
+AnytoneInterfaceTest::benchmarkRead() {
+  QFETCH(unsigned int, window);
+
+  FakeAnytoneRadio radio(100);
+  if (! radio.isOpen())
+    QSKIP("Cannot create pseudo terminal.");
+
+  ErrorStack err;
+  AnytoneInterface device(USBSerial::Descriptor(FAKE_VID, FAKE_PID, radio.device()), err);
+  if (! device.isOpen())
+    QFAIL(err.format().toLocal8Bit().constData());
+  device.setReadWindow(window);
+
+  QByteArray data(0x4000, 0x00);
+  QBENCHMARK {
+    if (! device.read(0, 0x00000000, (uint8_t *)data.data(), data.size(), err))
+      QFAIL(err.format().toLocal8Bit().constData());
+  }
+}
+
+
+QTEST_GUILESS_MAIN(AnytoneInterfaceTest)
@@ -0,0 +1,87 @@
+#ifndef ANYTONEINTERFACETEST_HH
+#define ANYTONEINTERFACETEST_HH
+
+#include <QObject>
+#include <QByteArray>
+#include <QHash>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+
+/** Implements a fake AnyTone radio on the master side of a pseudo terminal.
+ * Each batch of requests received is answered after a fixed latency, mimicking the round-trip
+ * latency of the USB link. Written blocks are kept, a specific write request can be rejected and
+ * a specific read request can be answered with a wrong address. */
+class FakeAnytoneRadio
+{
+public:
+  explicit FakeAnytoneRadio(unsigned int latencyUs=100);
+  virtual ~FakeAnytoneRadio();
+
+  /** Returns @c true if the pseudo terminal was created. */
+  bool isOpen() const;
+  /** Returns the path to the slave side of the pseudo terminal. */
+  const QString &device() const;
+  /** Returns the number of read requests served. */
+  unsigned int readRequests() const;
+  /** Returns the number of write requests served. */
+  unsigned int writeRequests() const;
+  /** Changes the latency of the responses. */
+  void setLatency(unsigned int latencyUs);
+  /** Rejects the n-th write request (starting at 1) with a NAK, 0 means never. */
+  void setNAKWrite(unsigned int n);
+  /** Answers the n-th read request (starting at 1) with a wrong address, 0 means never. */
+  void setMisplacedRead(unsigned int n);
+  /** Returns the block written to the given address or an empty array if there is none. */
+  QByteArray written(uint32_t addr) const;
+
+  /** Returns the byte at the given address. */
+  static uint8_t byteAt(uint32_t addr);
+
+protected:
+  void run();
+  int handle(const QByteArray &buffer, QByteArray &response);
+
+protected:
+  int _master, _slave;
+  QString _device;
+  std::atomic<unsigned int> _latency;
+  std::atomic<bool> _running;
+  std::atomic<unsigned int> _readRequests;
+  std::atomic<unsigned int> _writeRequests;
+  std::atomic<unsigned int> _nakWrite;
+  std::atomic<unsigned int> _misplacedRead;
+  mutable std::mutex _mutex;
+  QHash<uint32_t, QByteArray> _written;
+  std::thread _thread;
+};
+
+
+class AnytoneInterfaceTest : public QObject
+{
+  Q_OBJECT
+
+public:
+  explicit AnytoneInterfaceTest(QObject *parent = nullptr);
+
+private slots:
+  void testRead_data();
+  void testRead();
+  void testReadUnaligned_data();
+  void testReadUnaligned();
+  void testRoundTripProbe();
+  void testFastResponse();
+  void testReadFallback();
+  void testSlowResponse();
+  void testWrite_data();
+  void testWrite();
+  void testWriteNAK_data();
+  void testWriteNAK();
+  void testWriteUnaligned();
+
+  void benchmarkRead_data();
+  void benchmarkRead();
+};
+
+#endif // ANYTONEINTERFACETEST_HH
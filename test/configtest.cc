@@ -5,11 +5,14 @@
 #include "melody.hh"
 #include <iostream>
 #include <QTest>
+#include <QSignalSpy>
 #include "logger.hh"
 #include <iostream>
 #include "gd73_limits.hh"
+#include "gd73_codeplug.hh"
 
 #include "configcopyvisitor.hh"
+#include "intermediaterepresentation.hh"
 
 ConfigTest::ConfigTest(QObject *parent)
   : UnitTestBase(parent), _stderr(stderr)
@@ -348,5 +351,299 @@ ConfigTest::testDMRIdVerification() {
 }
 
 
-QTEST_GUILESS_MAIN(ConfigTest)
+void
+ConfigTest::testIncrementalVerification() {
+  GD73Limits limits;
+  RadioLimitCache cache;
+  ErrorStack err;
+  Config cfg;
+
+  if (! cfg.readYAML(":/data/config_test.yaml", err)) {
+    QFAIL(QString("Cannot open codeplug file: %1")
+          .arg(err.format()).toStdString().c_str());
+  }
+
+  RadioLimitContext full;
+  bool valid = limits.verifyConfig(&cfg, full);
+
+  // First pass fills the cache
+  RadioLimitContext first; first.setCache(&cache);
+  QCOMPARE(limits.verifyConfig(&cfg, first), valid);
+  QCOMPARE(cache.hits(), 0U);
+  QVERIFY(cache.count() > 0);
+  int cached = cache.count();
+
+  // Second pass is taken entirely from the cache and yields the same issues
+  RadioLimitContext second; second.setCache(&cache);
+  QCOMPARE(limits.verifyConfig(&cfg, second), valid);
+  QCOMPARE(cache.hits(), unsigned(cached));
+  QCOMPARE(cache.misses(), 0U);
+  QCOMPARE(second.count(), full.count());
+  for (int i=0; i<full.count(); i++)
+    QCOMPARE(second.message(i).format(), full.message(i).format());
+
+  // Modifying an object invalidates its issues only
+  DMRRadioID *id = cfg.radioIDs()->get(0)->as<DMRRadioID>();
+  QVERIFY(cache.contains(id));
+  id->setNumber(0x12345678);
+  QVERIFY(! cache.contains(id));
+  QCOMPARE(cache.count(), cached-1);
+
+  RadioLimitContext third; third.setCache(&cache);
+  QVERIFY(! limits.verifyConfig(&cfg, third));
+  QCOMPARE(third.maxSeverity(), RadioLimitIssue::Severity::Critical);
+  QCOMPARE(cache.misses(), 1U);
+  QCOMPARE(cache.hits(), unsigned(cached-1));
+
+  // Cached issues of an invalid object are restored as well
+  RadioLimitContext fourth; fourth.setCache(&cache);
+  QVERIFY(! limits.verifyConfig(&cfg, fourth));
+  QCOMPARE(fourth.count(), third.count());
+  QCOMPARE(cache.misses(), 0U);
+}
+
+
+void
+ConfigTest::testIncrementalVerificationPreprocessed() {
+  GD73Codeplug codeplug;
+  GD73Limits limits;
+  RadioLimitCache cache;
+  ErrorStack err;
+  Config cfg;
+
+  if (! cfg.readYAML(":/data/config_test.yaml", err)) {
+    QFAIL(QString("Cannot open codeplug file: %1")
+          .arg(err.format()).toStdString().c_str());
+  }
+
+  // Each pass verifies a fresh intermediate representation, like the GUI does
+  QHash<const ConfigObject *, const ConfigObject *> origins;
+  Config *intermediate = codeplug.preprocessWithOrigins(&cfg, origins, err);
+  if (nullptr == intermediate)
+    QFAIL(QString("Cannot pre-process codeplug: %1").arg(err.format()).toStdString().c_str());
+  QVERIFY(! origins.isEmpty());
+  QVERIFY(origins.value(intermediate->radioIDs()->get(0)) == cfg.radioIDs()->get(0));
+
+  RadioLimitContext full;
+  bool valid = limits.verifyConfig(intermediate, full);
+
+  RadioLimitContext first; first.setCache(&cache); first.setOrigins(origins);
+  QCOMPARE(limits.verifyConfig(intermediate, first), valid);
+  delete intermediate;
+  int cached = cache.count();
+  QVERIFY(cached > 0);
+  // Issues are kept for the original objects
+  QVERIFY(cache.contains(cfg.radioIDs()->get(0)));
+
+  intermediate = codeplug.preprocessWithOrigins(&cfg, origins, err);
+  QVERIFY(nullptr != intermediate);
+  RadioLimitContext second; second.setCache(&cache); second.setOrigins(origins);
+  QCOMPARE(limits.verifyConfig(intermediate, second), valid);
+  delete intermediate;
+  QCOMPARE(cache.hits(), unsigned(cached));
+  QCOMPARE(second.count(), full.count());
+  for (int i=0; i<full.count(); i++)
+    QCOMPARE(second.message(i).format(), full.message(i).format());
+
+  // Modifying the original invalidates its issues
+  cfg.radioIDs()->get(0)->as<DMRRadioID>()->setNumber(0x12345678);
+  QCOMPARE(cache.count(), cached-1);
+
+  intermediate = codeplug.preprocessWithOrigins(&cfg, origins, err);
+  QVERIFY(nullptr != intermediate);
+  RadioLimitContext third; third.setCache(&cache); third.setOrigins(origins);
+  QVERIFY(! limits.verifyConfig(intermediate, third));
+  delete intermediate;
+  QCOMPARE(third.maxSeverity(), RadioLimitIssue::Severity::Critical);
+  QCOMPARE(cache.hits(), unsigned(cached-1));
+}
+
+
+void
+ConfigTest::testParallelVerification() {
+  GD73Limits limits;
+  ErrorStack err;
+  Config cfg;
 
+  if (! cfg.readYAML(":/data/config_test.yaml", err)) {
+    QFAIL(QString("Cannot open codeplug file: %1")
+          .arg(err.format()).toStdString().c_str());
+  }
+
+  // Add enough contacts to get sharded, some of them with issues
+  for (int i=0; i<1000; i++) {
+    QString name = (i % 7) ? QString("Contact %1").arg(i) : QString("Contact with a long name %1").arg(i);
+    cfg.contacts()->add(new DMRContact(DMRContact::GroupCall, name, 1000+i));
+  }
+
+  RadioLimitContext serial;
+  bool valid = limits.verifyConfig(&cfg, serial);
+
+  RadioLimitContext parallel; parallel.setJobs(4);
+  QCOMPARE(limits.verifyConfig(&cfg, parallel), valid);
+  QCOMPARE(parallel.maxSeverity(), serial.maxSeverity());
+  QCOMPARE(parallel.count(), serial.count());
+  for (int i=0; i<serial.count(); i++)
+    QCOMPARE(parallel.message(i).format(), serial.message(i).format());
+}
+
+
+void
+ConfigTest::testObjectListIndex() {
+  ContactList contacts;
+  DMRContact *a = new DMRContact(DMRContact::PrivateCall, "A", 1);
+  DMRContact *b = new DMRContact(DMRContact::PrivateCall, "B", 2);
+  DMRContact *c = new DMRContact(DMRContact::PrivateCall, "C", 3);
+  QCOMPARE(contacts.add(a), 0);
+  QCOMPARE(contacts.add(b), 1);
+  QCOMPARE(contacts.add(c, 0), 0);
+  QCOMPARE(contacts.indexOf(c), 0);
+  QCOMPARE(contacts.indexOf(a), 1);
+  QCOMPARE(contacts.indexOf(b), 2);
+
+  // Moves
+  QVERIFY(contacts.moveDown(0));
+  QCOMPARE(contacts.indexOf(a), 0);
+  QCOMPARE(contacts.indexOf(c), 1);
+  QVERIFY(contacts.move(0, 1, 3));
+  QCOMPARE(contacts.indexOf(c), 0);
+  QCOMPARE(contacts.indexOf(b), 1);
+  QCOMPARE(contacts.indexOf(a), 2);
+
+  // Name index follows renames
+  QCOMPARE(contacts.findItemsByName("A").size(), 1);
+  a->setName("B");
+  QCOMPARE(contacts.findItemsByName("A").size(), 0);
+  QCOMPARE(contacts.findItemsByName("B"), QList<ConfigObject *>({b, a}));
+
+  // Take & delete
+  QVERIFY(contacts.take(b));
+  QVERIFY(! contacts.has(b));
+  QCOMPARE(contacts.indexOf(a), 1);
+  QCOMPARE(contacts.findItemsByName("B"), QList<ConfigObject *>({a}));
+  delete b;
+  delete c;
+  QCOMPARE(contacts.count(), 1);
+  QCOMPARE(contacts.indexOf(a), 0);
+  QVERIFY(contacts.findItemsByName("C").isEmpty());
+
+  // Non-unique reference lists
+  DMRContactRefList refs;
+  QCOMPARE(refs.add(a), 0);
+  QCOMPARE(refs.add(a, -1, false), 1);
+  QCOMPARE(refs.indexOf(a), 0);
+  QVERIFY(refs.take(a));
+  QCOMPARE(refs.indexOf(a), 0);
+  QVERIFY(refs.take(a));
+  QVERIFY(! refs.has(a));
+}
+
+void
+ConfigTest::testBatchUpdate() {
+  Config config;
+  DMRContact *a = new DMRContact(DMRContact::PrivateCall, "A", 1);
+  DMRContact *b = new DMRContact(DMRContact::PrivateCall, "B", 2);
+  DMRContact *c = new DMRContact(DMRContact::PrivateCall, "C", 3);
+  config.contacts()->add(a);
+  config.contacts()->add(b);
+  config.contacts()->add(c);
+
+  QSignalSpy configModified(&config, SIGNAL(modified(ConfigItem*)));
+  QSignalSpy elementModified(config.contacts(), SIGNAL(elementModified(int)));
+  QSignalSpy itemModified(c, SIGNAL(modified(ConfigItem*)));
+
+  {
+    Config::UpdateGuard update(&config);
+    QVERIFY(config.isUpdating());
+    c->setNumber(30); c->setRing(true); c->setName("D");
+    a->setNumber(10); a->setName("E");
+    // Nested updates do not flush
+    {
+      Config::UpdateGuard nested(&config);
+      a->setRing(true);
+    }
+    QVERIFY(config.isUpdating());
+    QCOMPARE(configModified.count(), 0);
+    QCOMPARE(elementModified.count(), 0);
+    // Item modifications are deferred
+    QCOMPARE(itemModified.count(), 0);
+    // Name index stays up-to-date during the update
+    QVERIFY(config.contacts()->findItemsByName("C").isEmpty());
+    QCOMPARE(config.contacts()->findItemsByName("D"), QList<ConfigObject *>({c}));
+  }
+
+  QVERIFY(! config.isUpdating());
+  QVERIFY(config.isModified());
+  QCOMPARE(configModified.count(), 1);
+  QCOMPARE(itemModified.count(), 1);
+  QCOMPARE(elementModified.count(), 2);
+  QCOMPARE(elementModified.at(0).at(0).toInt(), 0);
+  QCOMPARE(elementModified.at(1).at(0).toInt(), 2);
+  QCOMPARE(config.contacts()->findItemsByName("E"), QList<ConfigObject *>({a}));
+
+  // Elements removed during the update are not signalled as modified
+  configModified.clear(); elementModified.clear();
+  {
+    Config::UpdateGuard update(&config);
+    b->setNumber(20);
+    config.contacts()->del(b);
+  }
+  QCOMPARE(configModified.count(), 1);
+  QCOMPARE(elementModified.count(), 0);
+  QCOMPARE(config.contacts()->count(), 2);
+
+  // Read-only visitors do not start an update
+  class UpdateProbe: public Visitor {
+  public:
+    bool processItem(ConfigItem *item, const ErrorStack &err) {
+      if ((item == item->config()) && item->config()->isUpdating())
+        return false;
+      return Visitor::processItem(item, err);
+    }
+  };
+  UpdateProbe probe;
+  QVERIFY(probe.process(&config));
+  // while modifying ones do
+  configModified.clear();
+  ObjectFilterVisitor filter({DMRContact::staticMetaObject});
+  QVERIFY(filter.process(&config));
+  QCOMPARE(config.contacts()->count(), 0);
+  QCOMPARE(configModified.count(), 1);
+
+  // Loading a codeplug emits a single modified signal
+  Config loaded;
+  QSignalSpy loadedModified(&loaded, SIGNAL(modified(ConfigItem*)));
+  ErrorStack err;
+  if (! loaded.readYAML(":/data/ctcss_copy_test.yaml", err))
+    QFAIL(err.format().toStdString().c_str());
+  QVERIFY(! loaded.isModified());
+  QCOMPARE(loadedModified.count(), 2);
+}
+
+void
+ConfigTest::benchmarkObjectList_data() {
+  QTest::addColumn<int>("size");
+  QTest::newRow("1k") << 1000;
+  QTest::newRow("10k") << 10000;
+  QTest::newRow("100k") << 100000;
+}
+
+void
+ConfigTest::benchmarkObjectList() {
+  QFETCH(int, size);
+
+  QBENCHMARK_ONCE {
+    ContactList contacts;
+    for (int i=0; i<size; i++) {
+      DMRContact *contact = new DMRContact(DMRContact::PrivateCall, QString("Contact %1").arg(i), i+1);
+      // Import-like usage: check for existing names before adding.
+      QVERIFY(contacts.findItemsByName(contact->name()).isEmpty());
+      contacts.add(contact);
+    }
+    for (int i=0; i<size; i++)
+      QCOMPARE(contacts.indexOf(contacts.get(i)), i);
+  }
+}
+
+
+QTEST_GUILESS_MAIN(ConfigTest)
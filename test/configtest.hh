@@ -38,6 +38,14 @@ private slots:
 
   /// Regression test #674.
   void testDMRIdVerification();
+  void testIncrementalVerification();
+  void testIncrementalVerificationPreprocessed();
+  void testParallelVerification();
+
+  void testObjectListIndex();
+  void testBatchUpdate();
+  void benchmarkObjectList_data();
+  void benchmarkObjectList();
 
 protected:
   QTextStream _stderr;
@@ -1,12 +1,25 @@
 #include "crc32test.hh"
 #include "crc32.hh"
+#include "dfufile.hh"
 #include <QTest>
+#include <QTemporaryDir>
 
 CRC32Test::CRC32Test(QObject *parent) : QObject(parent)
 {
   // pass...
 }
 
+void
+CRC32Test::initTestCase() {
+  // 4MB of pseudo-random data, about the size of a call-sign DB.
+  _data.resize(0x400000);
+  uint32_t x = 0x12345678;
+  for (int i=0; i<_data.size(); i++) {
+    x = x*1103515245 + 12345;
+    _data[i] = char(x >> 24);
+  }
+}
+
 void
 CRC32Test::testCRC32() {
   QString txt("The quick brown fox jumps over the lazy dog");
@@ -15,4 +28,99 @@ CRC32Test::testCRC32() {
   QCOMPARE(crc.get(), 0x414FA339U^0xFFFFFFFF);
 }
 
+void
+CRC32Test::testSlicing() {
+  // Compare bulk updates against byte-wise ones for all lengths and alignments around the
+  // 8-byte blocks.
+  const uint8_t *data = (const uint8_t *)_data.constData();
+  for (int offset=0; offset<8; offset++) {
+    for (int len=0; len<70; len++) {
+      CRC32 bulk, bytewise;
+      bulk.update(data+offset, len);
+      for (int i=0; i<len; i++)
+        bytewise.update(data[offset+i]);
+      QCOMPARE(bulk.get(), bytewise.get());
+    }
+  }
+
+  // Split updates must match a single one.
+  CRC32 single, split;
+  single.update(_data);
+  split.update(data, 13);
+  split.update(data+13, _data.size()-13);
+  QCOMPARE(split.get(), single.get());
+}
+
+void
+CRC32Test::testMappedDFUFile() {
+  QTemporaryDir dir;
+  QVERIFY(dir.isValid());
+  QString filename = dir.filePath("test.dfu");
+
+  DFUFile file;
+  file.addImage("Test", 1);
+  file.image(0).addElement(0x1000, 0x1000);
+  file.image(0).addElement(0x4000, 0x2000);
+  memcpy(file.image(0).element(0).data().data(), _data.constData(), 0x1000);
+  memcpy(file.image(0).element(1).data().data(), _data.constData()+0x1000, 0x2000);
+  ErrorStack err;
+  if (! file.write(filename, err))
+    QFAIL(err.format().toLocal8Bit().constData());
+
+  // Read file, elements reference the mapped file
+  DFUFile mapped;
+  if (! mapped.read(filename, err))
+    QFAIL(err.format().toLocal8Bit().constData());
+  QCOMPARE(mapped.numImages(), 1);
+  QCOMPARE(mapped.image(0).numElements(), 2);
+  const DFUFile &cmapped = mapped;
+  QVERIFY(cmapped.image(0).element(0).isMapped());
+  QCOMPARE(cmapped.image(0).element(1).data(), file.image(0).element(1).data());
+  QCOMPARE(*cmapped.data(0x4000), uint8_t(_data.at(0x1000)));
+
+  // Modification copies the element only
+  *mapped.data(0x1000) = ~uint8_t(_data.at(0));
+  QVERIFY(! cmapped.image(0).element(0).isMapped());
+  QVERIFY(cmapped.image(0).element(1).isMapped());
+
+  // Writing back into the mapped file must work
+  if (! mapped.write(filename, err))
+    QFAIL(err.format().toLocal8Bit().constData());
+  DFUFile reread;
+  if (! reread.read(filename, err))
+    QFAIL(err.format().toLocal8Bit().constData());
+  QCOMPARE(*reread.data(0x1000), uint8_t(~uint8_t(_data.at(0))));
+  QCOMPARE(reread.image(0).element(1).data(), file.image(0).element(1).data());
+}
+
+void
+CRC32Test::benchmarkCRC32_data() {
+  QTest::addColumn<bool>("bytewise");
+  QTest::addColumn<int>("size");
+  QTest::newRow("byte-wise 4kB") << true << 0x1000;
+  QTest::newRow("bulk 4kB") << false << 0x1000;
+  QTest::newRow("byte-wise 4MB") << true << 0x400000;
+  QTest::newRow("bulk 4MB") << false << 0x400000;
+}
+
+void
+CRC32Test::benchmarkCRC32() {
+  QFETCH(bool, bytewise);
+  QFETCH(int, size);
+
+  const uint8_t *data = (const uint8_t *)_data.constData();
+  uint32_t sum = 0;
+  QBENCHMARK {
+    CRC32 crc;
+    if (bytewise) {
+      for (int i=0; i<size; i++)
+        crc.update(data[i]);
+    } else {
+      crc.update(data, size);
+    }
+    sum += crc.get();
+  }
+  QVERIFY(0 != sum);
+}
+
 QTEST_GUILESS_MAIN(CRC32Test)
@@ -2,6 +2,7 @@
 #define CRC32TEST_H
 
 #include <QObject>
+#include <QByteArray>
 
 class CRC32Test : public QObject
 {
@@ -11,7 +12,18 @@ public:
   explicit CRC32Test(QObject *parent = nullptr);
 
 private slots:
+  void initTestCase();
+
   void testCRC32();
+  void testSlicing();
+  void testMappedDFUFile();
+
+  void benchmarkCRC32_data();
+  void benchmarkCRC32();
+
+protected:
+  /** Some pseudo-random data. */
+  QByteArray _data;
 };
 
 #endif // CRC32TEST_H
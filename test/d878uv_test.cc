@@ -1,5 +1,10 @@
 #include "d878uv_test.hh"
 #include "config.hh"
+#include "channel.hh"
+#include "contact.hh"
+#include "rxgrouplist.hh"
+#include "zone.hh"
+#include "scanlist.hh"
 #include "d878uv_codeplug.hh"
 #include "d878uv_limits.hh"
 #include "errorstack.hh"
@@ -27,6 +32,49 @@ D878UVTest::encodeDecode(Config &input, Config &output) {
   }
 }
 
+void
+D878UVTest::maximalConfig(Config &config) {
+  config.copy(_roamingConfig);
+  // Fill all contacts, channels, group lists, zones and scan lists
+  for (unsigned int i=config.contacts()->count(); i<10000; i++) {
+    config.contacts()->add(
+          new DMRContact(DMRContact::PrivateCall, QString("Contact %1").arg(i), 2621000+i));
+  }
+  for (unsigned int i=config.rxGroupLists()->count(); i<250; i++) {
+    RXGroupList *list = new RXGroupList(QString("Group list %1").arg(i));
+    for (unsigned int j=0; j<64; j++)
+      list->addContact(config.contacts()->contact((64*i+j) % 10000)->as<DMRContact>());
+    config.rxGroupLists()->add(list);
+  }
+  for (unsigned int i=config.channelList()->count(); i<4000; i++) {
+    Channel *ch = nullptr;
+    if (i % 2) {
+      DMRChannel *dmr = new DMRChannel();
+      dmr->setContact(config.contacts()->contact(i % 10000)->as<DMRContact>());
+      dmr->setGroupList(config.rxGroupLists()->list(i % 250));
+      ch = dmr;
+    } else {
+      ch = new FMChannel();
+    }
+    ch->setName(QString("Channel %1").arg(i));
+    ch->setRXFrequency(Frequency::fromMHz(430.0 + 0.0125*(i%400)));
+    ch->setTXFrequency(Frequency::fromMHz(430.0 + 0.0125*(i%400)));
+    config.channelList()->add(ch);
+  }
+  for (unsigned int i=config.zones()->count(); i<250; i++) {
+    Zone *zone = new Zone(QString("Zone %1").arg(i));
+    for (unsigned int j=0; j<250; j++)
+      zone->A()->add(config.channelList()->channel((250*i+j) % 4000));
+    config.zones()->add(zone);
+  }
+  for (unsigned int i=config.scanlists()->count(); i<250; i++) {
+    ScanList *list = new ScanList(QString("Scan list %1").arg(i));
+    for (unsigned int j=0; j<50; j++)
+      list->addChannel(config.channelList()->channel((50*i+j) % 4000));
+    config.scanlists()->add(list);
+  }
+}
+
 void
 D878UVTest::initTestCase() {
   UnitTestBase::initTestCase();
@@ -632,5 +680,47 @@ D878UVTest::testHiddenZone() {
   QVERIFY(decoded.zones()->zone(0)->anytoneExtension()->hidden());
 }
 
+void
+D878UVTest::testParallelEncoding() {
+  ErrorStack err;
+  Config config;
+  maximalConfig(config);
+
+  Codeplug::Flags flags; flags.setUpdateCodeplug(false);
+  D878UVCodeplug serial, parallel;
+  if (! serial.encode(&config, flags, err)) {
+    QFAIL(QString("Cannot encode codeplug for AnyTone AT-D878UV: %1")
+            .arg(err.format()).toStdString().c_str());
+  }
+  flags.setParallelEncode(true);
+  if (! parallel.encode(&config, flags, err)) {
+    QFAIL(QString("Cannot encode codeplug in parallel for AnyTone AT-D878UV: %1")
+            .arg(err.format()).toStdString().c_str());
+  }
+
+  // Both must be identical
+  QCOMPARE(parallel.image(0).numElements(), serial.image(0).numElements());
+  for (int i=0; i<serial.image(0).numElements(); i++) {
+    QCOMPARE(parallel.image(0).element(i).address(), serial.image(0).element(i).address());
+    QCOMPARE(parallel.image(0).element(i).data(), serial.image(0).element(i).data());
+  }
+}
+
+void
+D878UVTest::benchmarkEncoding() {
+  ErrorStack err;
+  Config config;
+  maximalConfig(config);
+
+  Codeplug::Flags flags; flags.setUpdateCodeplug(false);
+  D878UVCodeplug codeplug;
+  QBENCHMARK {
+    if (! codeplug.encode(&config, flags, err)) {
+      QFAIL(QString("Cannot encode codeplug for AnyTone AT-D878UV: %1")
+              .arg(err.format()).toStdString().c_str());
+    }
+  }
+}
+
 QTEST_GUILESS_MAIN(D878UVTest)
 
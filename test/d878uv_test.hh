@@ -13,6 +13,8 @@ public:
 
 protected:
   void encodeDecode(Config &input, Config &output);
+  /** Fills the given config up to the limits of the D878UV. */
+  void maximalConfig(Config &config);
 
 private slots:
   void initTestCase();
@@ -42,6 +44,9 @@ private slots:
   void testMicGain();
   void testFixedLocation();
   void testHiddenZone(); ///< Regression test for #203
+  void testParallelEncoding();
+
+  void benchmarkEncoding();
 
 protected:
   Config _micGainConfig;
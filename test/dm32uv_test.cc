@@ -4,6 +4,8 @@
 #include "errorstack.hh"
 #include "logger.hh"
 #include <QTest>
+#include <QTemporaryDir>
+#include "dm32uv.hh"
 
 
 DM32UVTest::DM32UVTest(QObject *parent)
@@ -212,6 +214,38 @@ DM32UVTest::testCTCSSHigherFrequencies() {
   QCOMPARE(decoded.channelList()->channel(0)->as<FMChannel>()->txTone().Hz(), 107.2);
 }
 
+void
+DM32UVTest::testAddressMapPersistence() {
+  QTemporaryDir dir;
+  QVERIFY(dir.isValid());
+  QString filename = dir.filePath("dm32uv.map");
+
+  DM32UV::AddressMap map;
+  map.map(0x00003000, 0x00012000);
+  map.map(0x00004000, 0x00003000);
+  map.map(0x00010000, 0x00067000);
+
+  ErrorStack err;
+  if (! map.save(filename, err))
+    QFAIL(err.format().toLocal8Bit().constData());
+
+  DM32UV::AddressMap loaded;
+  if (! loaded.load(filename, err))
+    QFAIL(err.format().toLocal8Bit().constData());
+  QCOMPARE(loaded.mappedPhysical(), map.mappedPhysical());
+  QCOMPARE(loaded.mappedVirtual(), map.mappedVirtual());
+  QCOMPARE(loaded.toVirtual(0x00004123), 0x00003123U);
+  QCOMPARE(loaded.toPhysical(0x00067fff), 0x00010fffU);
+
+  // Malformed files are rejected
+  QFile file(filename);
+  QVERIFY(file.open(QIODevice::WriteOnly));
+  file.write("00003000 zz\n");
+  file.close();
+  QVERIFY(! loaded.load(filename));
+  QVERIFY(loaded.isEmpty());
+}
+
 
 QTEST_GUILESS_MAIN(DM32UVTest)
 
@@ -21,6 +21,7 @@ private slots:
   void testChannelBankEncoding();
   /** Regression test fo #967 */
   void testCTCSSHigherFrequencies();
+  void testAddressMapPersistence();
 };
 
 #endif // DR1801TEST_HH
@@ -0,0 +1,118 @@
+#include "imagecachetest.hh"
+#include "imagecache.hh"
+#include <QTest>
+#include <QStandardPaths>
+#include <QDir>
+
+ImageCacheTest::ImageCacheTest(QObject *parent)
+  : QObject(parent), _file()
+{
+  // pass...
+}
+
+void
+ImageCacheTest::initTestCase() {
+  // Do not touch the cache of the user
+  QStandardPaths::setTestModeEnabled(true);
+
+  _file.addImage("codeplug");
+  _file.image(0).addElement(0x00000000, 0x20);
+  _file.image(0).addElement(0x00100000, 0x40);
+  for (int i=0; i<0x20; i++)
+    _file.image(0).element(0).data()[i] = char(i);
+  for (int i=0; i<0x40; i++)
+    _file.image(0).element(1).data()[i] = char(0x80+i);
+}
+
+void
+ImageCacheTest::init() {
+  QDir(QStandardPaths::writableLocation(QStandardPaths::CacheLocation)).removeRecursively();
+}
+
+void
+ImageCacheTest::cleanupTestCase() {
+  QDir(QStandardPaths::writableLocation(QStandardPaths::CacheLocation)).removeRecursively();
+}
+
+
+void
+ImageCacheTest::testStoreLoad() {
+  ErrorStack err;
+  ImageCache cache("D878UV", "V100", "1234");
+  QVERIFY(! cache.load(0xcafe));
+  QVERIFY(! cache.isLoaded());
+
+  if (! cache.store(_file.image(0), 0xcafe, err))
+    QFAIL(err.format().toLocal8Bit().constData());
+
+  ImageCache other("D878UV", "V100", "1234");
+  if (! other.load(0xcafe, err))
+    QFAIL(err.format().toLocal8Bit().constData());
+  QVERIFY(other.isLoaded());
+
+  const uint8_t *ptr = other.data(0x00100000, 0x40);
+  QVERIFY(nullptr != ptr);
+  QCOMPARE(QByteArray((const char *)ptr, 0x40), _file.image(0).element(1).data());
+  QVERIFY(nullptr != other.data(0x00000000, 0x10));
+  // Element too small or unknown
+  QVERIFY(nullptr == other.data(0x00000000, 0x40));
+  QVERIFY(nullptr == other.data(0x00000010, 0x10));
+
+  // Different fingerprint
+  QVERIFY(! other.load(0xbeef));
+  QVERIFY(! other.isLoaded());
+}
+
+void
+ImageCacheTest::testReplace() {
+  ErrorStack err;
+  ImageCache cache("D878UV", "V100", "1234");
+  if ((! cache.store(_file.image(0), 0x1, err)) || (! cache.load(0x1, err)))
+    QFAIL(err.format().toLocal8Bit().constData());
+  // Storing replaces the previous image of the same device, even if it is loaded.
+  if (! cache.store(_file.image(0), 0x2, err))
+    QFAIL(err.format().toLocal8Bit().constData());
+  QVERIFY(! cache.load(0x1));
+  QVERIFY(cache.load(0x2));
+}
+
+void
+ImageCacheTest::testDevices() {
+  ErrorStack err;
+  ImageCache first("D878UV", "V100", "1234"),
+      second("D878UV", "V100", "5678");
+
+  DFUFile modified; modified.addImage(_file.image(0));
+  modified.image(0).element(1).data()[0] = char(0xff);
+
+  if ((! first.store(_file.image(0), 0x1, err)) || (! second.store(modified.image(0), 0x1, err)))
+    QFAIL(err.format().toLocal8Bit().constData());
+  // Storing an image of one radio does not evict the image of another radio of the same model.
+  if (! first.store(_file.image(0), 0x2, err))
+    QFAIL(err.format().toLocal8Bit().constData());
+
+  QVERIFY(first.load(0x2));
+  QCOMPARE(first.data(0x00100000, 0x40)[0], uint8_t(0x80));
+  QVERIFY(second.load(0x1));
+  QCOMPARE(second.data(0x00100000, 0x40)[0], uint8_t(0xff));
+}
+
+void
+ImageCacheTest::testFingerprint() {
+  QVector<ImageCache::Region> regions;
+  regions.append({0x00000000, 0x20});
+
+  DFUFile modified; modified.addImage(_file.image(0));
+  uint32_t fp = ImageCache::fingerprint(_file.image(0), regions);
+  QCOMPARE(ImageCache::fingerprint(modified.image(0), regions), fp);
+
+  // Changes outside the regions do not change the fingerprint
+  modified.image(0).element(1).data()[0] = char(0xff);
+  QCOMPARE(ImageCache::fingerprint(modified.image(0), regions), fp);
+
+  modified.image(0).element(0).data()[0x1f] = char(0xff);
+  QVERIFY(ImageCache::fingerprint(modified.image(0), regions) != fp);
+}
+
+
+QTEST_GUILESS_MAIN(ImageCacheTest)
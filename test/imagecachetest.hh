@@ -0,0 +1,29 @@
+#ifndef IMAGECACHETEST_HH
+#define IMAGECACHETEST_HH
+
+#include <QObject>
+#include "dfufile.hh"
+
+class ImageCacheTest : public QObject
+{
+  Q_OBJECT
+
+public:
+  explicit ImageCacheTest(QObject *parent = nullptr);
+
+private slots:
+  void initTestCase();
+  void init();
+  void cleanupTestCase();
+
+  void testStoreLoad();
+  void testReplace();
+  void testDevices();
+  void testFingerprint();
+
+protected:
+  /** Some image with two elements. */
+  DFUFile _file;
+};
+
+#endif // IMAGECACHETEST_HH
@@ -0,0 +1,169 @@
+#include "loggertest.hh"
+#include "logger.hh"
+#include <QTest>
+#include <QThread>
+#include <QSemaphore>
+
+/** Number of threads logging concurrently. */
+#define THREADS 4
+
+
+/** Records all messages. Can hold the writer thread on a message to fill the buffer. */
+class RecordingLogHandler: public LogHandler
+{
+public:
+  RecordingLogHandler()
+    : LogHandler(), _messages(), _hold(false), _held(), _release()
+  {
+    // pass...
+  }
+
+  LogMessage::Level minLevel() const {
+    return LogMessage::DEBUG;
+  }
+
+  void handle(const LogMessage &message) {
+    // The logger serializes all calls to the handlers.
+    _messages.append(message.message());
+    if (_hold.testAndSetOrdered(1, 0)) {
+      _held.release();
+      _release.acquire();
+    }
+  }
+
+  /** Holds the next message until @c release gets called. */
+  void hold() { _hold.storeRelease(1); }
+  /** Waits until a message is held. */
+  bool waitHeld(int timeout) { return _held.tryAcquire(1, timeout); }
+  /** Releases the held message. */
+  void release() { _release.release(); }
+
+  /** The messages received, only safe to access in synchronous mode. */
+  const QStringList &messages() const { return _messages; }
+
+protected:
+  QStringList _messages;
+  QAtomicInt _hold;
+  QSemaphore _held;
+  QSemaphore _release;
+};
+
+
+/** Logs @c count messages "<thread>:<index>" from each of @c THREADS threads concurrently. */
+static void
+logConcurrently(int count) {
+  QList<QThread *> threads;
+  for (int t=0; t<THREADS; t++) {
+    threads.append(QThread::create([t, count]() {
+      for (int i=0; i<count; i++)
+        logDebug() << t << ":" << i;
+    }));
+  }
+  foreach (QThread *thread, threads)
+    thread->start();
+  foreach (QThread *thread, threads) {
+    thread->wait();
+    delete thread;
+  }
+}
+
+/** Checks that the messages of each thread are received in order and without duplicates.
+ * Returns the number of messages received from the threads. */
+static int
+checkOrder(const QStringList &messages) {
+  QVector<int> last(THREADS, -1);
+  int received = 0;
+  foreach (const QString &message, messages) {
+    QStringList parts = message.split(":");
+    if (2 != parts.size())
+      continue;
+    int t = parts[0].toInt(), i = parts[1].toInt();
+    if ((0 > t) || (THREADS <= t) || (i <= last[t]))
+      return -1;
+    last[t] = i; received++;
+  }
+  return received;
+}
+
+
+LoggerTest::LoggerTest(QObject *parent)
+  : QObject(parent)
+{
+  // pass...
+}
+
+
+void
+LoggerTest::testSynchronous() {
+  RecordingLogHandler *handler = new RecordingLogHandler();
+  Logger::get().addHandler(handler);
+  QVERIFY(! Logger::get().isAsynchronous());
+
+  logDebug() << "first";
+  logWarn() << "second";
+  QCOMPARE(handler->messages(), QStringList({"first", "second"}));
+
+  Logger::get().remHandler(handler);
+  delete handler;
+}
+
+
+void
+LoggerTest::testFlushOnDisable() {
+  Logger &logger = Logger::get();
+  RecordingLogHandler *handler = new RecordingLogHandler();
+  logger.addHandler(handler);
+  unsigned int dropped = logger.dropped();
+
+  // Fewer messages than the buffer holds, nothing gets dropped
+  logger.setAsynchronous(true);
+  logConcurrently(500);
+  logger.setAsynchronous(false);
+
+  // All messages are passed to the handler once the asynchronous mode is disabled
+  QCOMPARE(logger.dropped(), dropped);
+  QCOMPARE(handler->messages().size(), THREADS*500);
+  QCOMPARE(checkOrder(handler->messages()), THREADS*500);
+
+  logger.remHandler(handler);
+  delete handler;
+}
+
+
+void
+LoggerTest::testOverflow() {
+  Logger &logger = Logger::get();
+  RecordingLogHandler *handler = new RecordingLogHandler();
+  logger.addHandler(handler);
+  unsigned int dropped = logger.dropped();
+
+  // Hold the writer thread, such that the buffer fills up
+  logger.setAsynchronous(true);
+  handler->hold();
+  logDebug() << "held";
+  QVERIFY(handler->waitHeld(5000));
+
+  // More messages than the buffer holds
+  int count = 4096;
+  logConcurrently(count);
+  unsigned int lost = logger.dropped() - dropped;
+  QVERIFY(lost > 0);
+
+  handler->release();
+  logger.setAsynchronous(false);
+
+  // Every message is either received in order or counted as dropped
+  const QStringList &messages = handler->messages();
+  QCOMPARE(messages.first(), QString("held"));
+  int received = checkOrder(messages);
+  QVERIFY(0 <= received);
+  QCOMPARE(received + int(lost), THREADS*count);
+  // The loss gets reported
+  QVERIFY(messages.contains(QString("Log buffer overflow: %1 messages dropped.").arg(lost)));
+
+  logger.remHandler(handler);
+  delete handler;
+}
+
+
+QTEST_GUILESS_MAIN(LoggerTest)
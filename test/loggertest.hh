@@ -0,0 +1,19 @@
+#ifndef LOGGERTEST_HH
+#define LOGGERTEST_HH
+
+#include <QObject>
+
+class LoggerTest : public QObject
+{
+  Q_OBJECT
+
+public:
+  explicit LoggerTest(QObject *parent = nullptr);
+
+private slots:
+  void testSynchronous();
+  void testFlushOnDisable();
+  void testOverflow();
+};
+
+#endif // LOGGERTEST_HH
@@ -419,4 +419,75 @@ MergeTest::testMergeZones() {
 }
 
 
+void
+MergeTest::testMergeLarge_data() {
+  QTest::addColumn<int>("strategy");
+  QTest::addColumn<int>("channels");
+  QTest::newRow("ignore") << int(ConfigMergeVisitor::ItemStrategy::Ignore) << 15000;
+  QTest::newRow("override") << int(ConfigMergeVisitor::ItemStrategy::Override) << 15000;
+  QTest::newRow("duplicate") << int(ConfigMergeVisitor::ItemStrategy::Duplicate) << 20000;
+}
+
+void
+MergeTest::testMergeLarge() {
+  QFETCH(int, strategy);
+  QFETCH(int, channels);
+
+  // Merges 10000 channels into 10000 channels, where half of them collide.
+  const int n = 10000;
+  Config *base = new Config(), *merging = new Config();
+  for (int i=0; i<n; i++) {
+    FMChannel *ch = new FMChannel();
+    ch->setName(QString("FM %1").arg(i));
+    ch->setRXFrequency(Frequency::fromMHz(144.0));
+    ch->setTXFrequency(Frequency::fromMHz(144.0));
+    base->channelList()->add(ch);
+  }
+
+  Zone *zone = new Zone("Zone 0");
+  for (int i=n/2; i<(n+n/2); i++) {
+    FMChannel *ch = new FMChannel();
+    ch->setName(QString("FM %1").arg(i));
+    ch->setRXFrequency(Frequency::fromMHz(145.0));
+    ch->setTXFrequency(Frequency::fromMHz(145.0));
+    merging->channelList()->add(ch);
+    zone->A()->add(ch);
+  }
+  merging->zones()->add(zone);
+
+  ErrorStack err;
+  Config *merged = nullptr;
+  QBENCHMARK_ONCE {
+    merged = ConfigMerge::merge(base, merging, ConfigMergeVisitor::ItemStrategy(strategy),
+                                ConfigMergeVisitor::SetStrategy::Ignore, err);
+  }
+  if (nullptr == merged)
+    QFAIL(err.format().toLocal8Bit().constData());
+
+  QCOMPARE(merged->channelList()->count(), channels);
+  QCOMPARE(merged->zones()->count(), 1);
+  QCOMPARE(merged->zones()->zone(0)->A()->count(), n);
+  // All zone members must refer to channels of the merged config
+  for (int i=0; i<n; i++)
+    QVERIFY(merged->channelList()->has(merged->zones()->zone(0)->A()->get(i)));
+
+  // Check collision resolution for the first colliding channel
+  Channel *first = merged->zones()->zone(0)->A()->get(0)->as<Channel>();
+  if (int(ConfigMergeVisitor::ItemStrategy::Ignore) == strategy) {
+    QCOMPARE(first, merged->channelList()->channel(n/2));
+    QCOMPARE(first->rxFrequency(), Frequency::fromMHz(144.0));
+  } else if (int(ConfigMergeVisitor::ItemStrategy::Override) == strategy) {
+    QCOMPARE(first, merged->channelList()->channel(n/2));
+    QCOMPARE(first->rxFrequency(), Frequency::fromMHz(145.0));
+  } else {
+    QCOMPARE(first, merged->channelList()->channel(n));
+    QCOMPARE(first->name(), QString("FM %1 (copy)").arg(n/2));
+  }
+
+  delete merged;
+  delete base;
+  delete merging;
+}
+
+
 QTEST_GUILESS_MAIN(MergeTest)
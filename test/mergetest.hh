@@ -16,6 +16,8 @@ private slots:
   void testMergeGroupLists();
   void testMergeChannels();
   void testMergeZones();
+  void testMergeLarge_data();
+  void testMergeLarge();
 };
 
 #endif // MERGETEST_HH
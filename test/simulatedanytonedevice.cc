@@ -0,0 +1,260 @@
+#include "simulatedanytonedevice.hh"
+#include "anytone_interface.hh"
+#include "usbserial.hh"
+#include "logger.hh"
+
+#include <QtEndian>
+#include <QThread>
+#include <algorithm>
+#include <cstring>
+
+#ifdef Q_OS_UNIX
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+#endif
+
+/** Size of the memory blocks read and written by a single request. */
+#define BLOCK_SIZE 16
+
+
+/** Returns the model name, the AnyTone radio identifies as. Empty, if the radio cannot be
+ * simulated. */
+static QByteArray
+anytoneModel(const RadioInfo &radio) {
+  switch (radio.id()) {
+  case RadioInfo::D868UVE: return "D868UVE";
+  case RadioInfo::D878UV: return "D878UV";
+  case RadioInfo::D878UVII: return "D878UV2";
+  case RadioInfo::D578UV: return "D578UV";
+  case RadioInfo::DMR6X2UV: return "D6X2UV";
+  case RadioInfo::DMR6X2UV2: return "D6X2UV2";
+  default: break;
+  }
+  return QByteArray();
+}
+
+
+/* ********************************************************************************************* *
+ * Implementation of SimulatedAnytoneDevice
+ * ********************************************************************************************* */
+SimulatedAnytoneDevice::SimulatedAnytoneDevice(const RadioInfo &radio, const SimulatedInterface::Settings &settings,
+                                               const ErrorStack &err, QObject *parent)
+  : QObject(parent), _master(-1), _slave(-1), _device(), _model(anytoneModel(radio)),
+    _settings(settings), _random(settings.seed), _mutex(), _memory(), _requests(0),
+    _running(false), _thread()
+{
+  if (_model.isEmpty()) {
+    errMsg(err) << "Cannot simulate " << radio.name() << ": Not an AnyTone radio.";
+    return;
+  }
+
+#ifdef Q_OS_UNIX
+  if (0 > (_master = posix_openpt(O_RDWR | O_NOCTTY))) {
+    errMsg(err) << "Cannot simulate " << radio.name() << ": Cannot create pseudo terminal.";
+    return;
+  }
+  if ((0 != grantpt(_master)) || (0 != unlockpt(_master))) {
+    errMsg(err) << "Cannot simulate " << radio.name() << ": Cannot unlock pseudo terminal.";
+    ::close(_master); _master = -1;
+    return;
+  }
+  _device = QString::fromLocal8Bit(ptsname(_master));
+
+  // Keep the slave side open and raw, such that no data gets lost or processed while the
+  // interface re-opens the port.
+  if (0 > (_slave = ::open(ptsname(_master), O_RDWR | O_NOCTTY))) {
+    errMsg(err) << "Cannot simulate " << radio.name() << ": Cannot open " << _device << ".";
+    ::close(_master); _master = -1;
+    return;
+  }
+  struct termios tio;
+  tcgetattr(_slave, &tio);
+  cfmakeraw(&tio);
+  tcsetattr(_slave, TCSANOW, &tio);
+
+  logDebug() << "Simulate " << radio.name() << " at " << _device << ", latency "
+             << _settings.latency << "us, bandwidth " << _settings.bandwidth << "B/s.";
+  _running = true;
+  _thread = std::thread(&SimulatedAnytoneDevice::run, this);
+#else
+  errMsg(err) << "Cannot simulate " << radio.name() << ": Pseudo terminals are not available.";
+#endif
+}
+
+SimulatedAnytoneDevice::~SimulatedAnytoneDevice() {
+  _running = false;
+  if (_thread.joinable())
+    _thread.join();
+#ifdef Q_OS_UNIX
+  if (0 <= _slave)
+    ::close(_slave);
+  if (0 <= _master)
+    ::close(_master);
+#endif
+}
+
+bool
+SimulatedAnytoneDevice::isOpen() const {
+  return _running;
+}
+
+USBDeviceDescriptor
+SimulatedAnytoneDevice::descriptor() const {
+  USBDeviceInfo info = AnytoneGD32Interface::interfaceInfo();
+  return USBSerial::Descriptor(info.vendorId(), info.productId(), _device);
+}
+
+void
+SimulatedAnytoneDevice::load(const DFUFile::Image &image) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  for (int i=0; i<image.numElements(); i++) {
+    const DFUFile::Element &el = image.element(i);
+    for (int o=0; o<el.data().size(); o++) {
+      uint32_t addr = el.address() + o;
+      uint32_t block = addr & ~uint32_t(BLOCK_SIZE-1);
+      if (! _memory.contains(block))
+        _memory.insert(block, QByteArray(BLOCK_SIZE, 0x00));
+      _memory[block][addr-block] = el.data().at(o);
+    }
+  }
+}
+
+QByteArray
+SimulatedAnytoneDevice::memory(uint32_t addr, int size) const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  QByteArray data(size, 0x00);
+  for (int o=0; o<size; o++) {
+    uint32_t block = (addr+o) & ~uint32_t(BLOCK_SIZE-1);
+    if (_memory.contains(block))
+      data[o] = _memory[block].at(addr+o-block);
+  }
+  return data;
+}
+
+unsigned int
+SimulatedAnytoneDevice::requests() const {
+  return _requests;
+}
+
+bool
+SimulatedAnytoneDevice::simulates(const RadioInfo &radio) {
+  return ! anytoneModel(radio).isEmpty();
+}
+
+void
+SimulatedAnytoneDevice::run() {
+#ifdef Q_OS_UNIX
+  QByteArray buffer;
+  char tmp[4096];
+  while (_running) {
+    struct pollfd pfd = {_master, POLLIN, 0};
+    if (0 >= poll(&pfd, 1, 10))
+      continue;
+    ssize_t n = ::read(_master, tmp, sizeof(tmp));
+    if (0 >= n)
+      continue;
+    buffer.append(tmp, n);
+
+    QByteArray response;
+    int consumed;
+    while (0 < (consumed = handle(buffer, response)))
+      buffer.remove(0, consumed);
+    if (response.isEmpty())
+      continue;
+
+    // Simulate the latency once per received batch and the transfer time of the response
+    qint64 delay = _settings.latency;
+    if (_settings.bandwidth)
+      delay += (qint64(response.size())*1000000)/_settings.bandwidth;
+    if (delay)
+      QThread::usleep(delay);
+    if (response.size() != ::write(_master, response.constData(), response.size()))
+      logWarn() << "Simulated AnyTone device: Cannot send response.";
+  }
+#endif
+}
+
+int
+SimulatedAnytoneDevice::handle(const QByteArray &buffer, QByteArray &response) {
+  if (buffer.isEmpty())
+    return 0;
+
+  switch (buffer.at(0)) {
+  case 'P': // PROGRAM
+    if (7 > buffer.size())
+      return 0;
+    response.append("QX\6", 3);
+    return 7;
+
+  case '\2': { // identify
+    char info[16] = {'I', 0, 0, 0, 0, 0, 0, 0, 1, 'V', '1', '0', '0', 0, 0, 6};
+    memcpy(info+1, _model.constData(), std::min<int>(_model.size(), 7));
+    response.append(info, sizeof(info));
+    return 1;
+  }
+
+  case 'R': { // read request
+    if (6 > buffer.size())
+      return 0;
+    uint32_t addr = qFromBigEndian<uint32_t>(buffer.constData()+1);
+    QByteArray data = memory(addr, BLOCK_SIZE);
+    char resp[24];
+    resp[0] = 'W';
+    qToBigEndian<uint32_t>(addr, resp+1);
+    resp[5] = BLOCK_SIZE;
+    memcpy(resp+6, data.constData(), BLOCK_SIZE);
+    uint8_t sum = 0;
+    for (int i=1; i<22; i++)
+      sum += uint8_t(resp[i]);
+    // A failing request is answered with a wrong checksum
+    resp[22] = simulateRequest() ? sum : ~sum;
+    resp[23] = 6;
+    response.append(resp, sizeof(resp));
+    return 6;
+  }
+
+  case 'W': { // write request
+    if (24 > buffer.size())
+      return 0;
+    uint32_t addr = qFromBigEndian<uint32_t>(buffer.constData()+1);
+    uint8_t sum = 0;
+    for (int i=1; i<22; i++)
+      sum += uint8_t(buffer.at(i));
+    if ((! simulateRequest()) || (sum != uint8_t(buffer.at(22))) || (addr % BLOCK_SIZE)) {
+      response.append('\x15');
+      return 24;
+    }
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _memory.insert(addr, buffer.mid(6, BLOCK_SIZE));
+    }
+    response.append('\6');
+    return 24;
+  }
+
+  case 'E': // END
+    if (3 > buffer.size())
+      return 0;
+    response.append('\6');
+    return 3;
+
+  default:
+    break;
+  }
+
+  // Skip unknown byte
+  return 1;
+}
+
+bool
+SimulatedAnytoneDevice::simulateRequest() {
+  unsigned int n = ++_requests;
+  if (n == _settings.failRequest)
+    return false;
+  if ((_settings.errorRate > 0) && (_random.generateDouble() < _settings.errorRate))
+    return false;
+  return true;
+}
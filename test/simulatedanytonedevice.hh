@@ -0,0 +1,96 @@
+#ifndef SIMULATEDANYTONEDEVICE_HH
+#define SIMULATEDANYTONEDEVICE_HH
+
+#include <QObject>
+#include <QHash>
+#include <QByteArray>
+#include <QRandomGenerator>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include "simulatedinterface.hh"
+
+/** Implements a simulated AnyTone radio talking the serial programming protocol.
+ *
+ * In contrast to the @c SimulatedInterface, which replaces the interface to the device, this
+ * class simulates the device itself. It answers the frames of the AnyTone programming protocol
+ * (program mode, identification, read, write and end) received on the master side of a pseudo
+ * terminal. Hence, the unmodified @c AnytoneInterface talks to it via the slave side (see
+ * @c descriptor), exercising the complete transfer path of the AnyTone radios including the
+ * pipelined reads and writes.
+ *
+ * The memory is organized in blocks of 16 bytes. Blocks never written read as 0x00, just like
+ * the memory of a factory reset device. The transfer characteristics are the same as for the
+ * @c SimulatedInterface: Each batch of received requests is answered after the configured latency
+ * plus the time needed to transfer the response at the configured bandwidth. Failing read
+ * requests are answered with a wrong checksum, failing write requests with a NAK.
+ *
+ * Pseudo terminals are only available on POSIX systems. On all other systems, @c isOpen returns
+ * @c false. */
+class SimulatedAnytoneDevice: public QObject
+{
+  Q_OBJECT
+
+public:
+  /** Constructs a simulated AnyTone device with empty memory, identifying itself as the given
+   * radio. If the radio cannot be simulated or the pseudo terminal cannot be created, @c isOpen
+   * returns @c false. */
+  explicit SimulatedAnytoneDevice(const RadioInfo &radio,
+                                  const SimulatedInterface::Settings &settings=SimulatedInterface::Settings(),
+                                  const ErrorStack &err=ErrorStack(), QObject *parent=nullptr);
+  /** Destructor, stops the device. */
+  virtual ~SimulatedAnytoneDevice();
+
+  /** Returns @c true if the device is running. */
+  bool isOpen() const;
+  /** Returns the descriptor of the serial port to connect the @c AnytoneInterface to. */
+  USBDeviceDescriptor descriptor() const;
+
+  /** Copies the content of the given image into the memory of the device. */
+  void load(const DFUFile::Image &image);
+  /** Returns the memory content of the device at the given address. */
+  QByteArray memory(uint32_t addr, int size) const;
+
+  /** Returns the number of read and write requests served so far. */
+  unsigned int requests() const;
+
+public:
+  /** Returns @c true if the given radio can be simulated. */
+  static bool simulates(const RadioInfo &radio);
+
+protected:
+  /** The main loop of the device, serving the requests. */
+  void run();
+  /** Handles the first request in the buffer. Appends the response and returns the number of
+   * bytes consumed. Returns 0, if the request is not complete yet. */
+  int handle(const QByteArray &buffer, QByteArray &response);
+  /** Counts a request and returns @c false if the request is chosen to fail. */
+  bool simulateRequest();
+
+protected:
+  /** File descriptor of the master side of the pseudo terminal. */
+  int _master;
+  /** File descriptor of the slave side of the pseudo terminal, kept open while running. */
+  int _slave;
+  /** Path to the slave side of the pseudo terminal. */
+  QString _device;
+  /** The model name, the device identifies as. */
+  QByteArray _model;
+  /** The transfer characteristics. */
+  SimulatedInterface::Settings _settings;
+  /** Random number generator for the error injection. */
+  QRandomGenerator _random;
+  /** Guards the memory. */
+  mutable std::mutex _mutex;
+  /** The memory in blocks of 16 bytes, keyed by their address. */
+  QHash<uint32_t, QByteArray> _memory;
+  /** Number of requests served. */
+  std::atomic<unsigned int> _requests;
+  /** If @c true, the device thread keeps running. */
+  std::atomic<bool> _running;
+  /** The device thread. */
+  std::thread _thread;
+};
+
+#endif // SIMULATEDANYTONEDEVICE_HH
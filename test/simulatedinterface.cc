@@ -0,0 +1,311 @@
+#include "simulatedinterface.hh"
+#include "simulatedanytonedevice.hh"
+#include "anytone_interface.hh"
+#include "gd77.hh"
+#include "rd5r.hh"
+#include "gd73.hh"
+#include "d868uv.hh"
+#include "d878uv.hh"
+#include "d878uv2.hh"
+#include "d578uv.hh"
+#include "dmr6x2uv.hh"
+#include "dmr6x2uv2.hh"
+#include "logger.hh"
+
+#include <QThread>
+#include <QUrlQuery>
+#include <cstring>
+
+
+/* ********************************************************************************************* *
+ * Implementation of SimulatedInterface::Settings
+ * ********************************************************************************************* */
+SimulatedInterface::Settings::Settings()
+  : latency(0), bandwidth(0), errorRate(0), failRequest(0), seed(0)
+{
+  // pass...
+}
+
+
+/* ********************************************************************************************* *
+ * Implementation of SimulatedInterface
+ * ********************************************************************************************* */
+SimulatedInterface::SimulatedInterface(const RadioInfo &radio, const Settings &settings, QObject *parent)
+  : QObject(parent), RadioInterface(), _open(true), _radio(radio), _settings(settings),
+    _memory(), _banks(), _requests(0), _random(settings.seed)
+{
+  // pass...
+}
+
+SimulatedInterface::SimulatedInterface(const USBDeviceDescriptor &descriptor, const ErrorStack &err, QObject *parent)
+  : QObject(parent), RadioInterface(), _open(false), _radio(), _settings(), _memory(), _banks(),
+    _requests(0), _random()
+{
+  if (interfaceInfo() != descriptor) {
+    errMsg(err) << "Cannot simulate device: Not a simulated device descriptor.";
+    return;
+  }
+
+  // The device handle is the file name followed by the settings as a query string.
+  QString handle = descriptor.device().toString();
+  QString filename = handle.section('?', 0, 0);
+  QUrlQuery query(handle.section('?', 1));
+
+  if (query.hasQueryItem("radio"))
+    _radio = RadioInfo::byKey(query.queryItemValue("radio"));
+  _settings.latency = query.queryItemValue("latency").toUInt();
+  _settings.bandwidth = query.queryItemValue("bandwidth").toUInt();
+  _settings.errorRate = query.queryItemValue("errors").toDouble();
+  _settings.failRequest = query.queryItemValue("fail").toUInt();
+  _settings.seed = query.queryItemValue("seed").toUInt();
+  _random.seed(_settings.seed);
+
+  if ((! filename.isEmpty()) && (! _memory.read(filename, err))) {
+    errMsg(err) << "Cannot read memory of simulated device from '" << filename << "'.";
+    return;
+  }
+
+  logDebug() << "Simulate " << (_radio.isValid() ? _radio.name() : QString("unknown radio"))
+             << " with " << _memory.numImages() << " memory image(s), latency "
+             << _settings.latency << "us, bandwidth " << _settings.bandwidth << "B/s.";
+  _open = true;
+}
+
+bool
+SimulatedInterface::isOpen() const {
+  return _open;
+}
+
+void
+SimulatedInterface::close() {
+  _open = false;
+}
+
+RadioInfo
+SimulatedInterface::identifier(const ErrorStack &err) {
+  Q_UNUSED(err);
+  return _radio;
+}
+
+bool
+SimulatedInterface::write_start(uint32_t bank, uint32_t addr, const ErrorStack &err) {
+  Q_UNUSED(bank); Q_UNUSED(addr); Q_UNUSED(err);
+  return true;
+}
+
+bool
+SimulatedInterface::write(uint32_t bank, uint32_t addr, uint8_t *data, int nbytes, const ErrorStack &err) {
+  TransferStats::Request request(_stats, TransferStats::Direction::Write, nbytes);
+
+  if (! simulateRequest(nbytes, err)) {
+    errMsg(err) << "Cannot write " << nbytes << " bytes to address " << QString::number(addr, 16)
+                << "h of bank " << bank << ".";
+    return false;
+  }
+
+  unsigned char *ptr = memory(bank, addr, nbytes);
+  if (nullptr == ptr) {
+    errMsg(err) << "Cannot write " << nbytes << " bytes to address " << QString::number(addr, 16)
+                << "h of bank " << bank << ": Memory not present.";
+    return false;
+  }
+
+  memcpy(ptr, data, nbytes);
+  return true;
+}
+
+bool
+SimulatedInterface::write_finish(const ErrorStack &err) {
+  Q_UNUSED(err);
+  return true;
+}
+
+bool
+SimulatedInterface::read_start(uint32_t bank, uint32_t addr, const ErrorStack &err) {
+  Q_UNUSED(bank); Q_UNUSED(addr); Q_UNUSED(err);
+  return true;
+}
+
+bool
+SimulatedInterface::read(uint32_t bank, uint32_t addr, uint8_t *data, int nbytes, const ErrorStack &err) {
+  TransferStats::Request request(_stats, TransferStats::Direction::Read, nbytes);
+
+  if (! simulateRequest(nbytes, err)) {
+    errMsg(err) << "Cannot read " << nbytes << " bytes from address " << QString::number(addr, 16)
+                << "h of bank " << bank << ".";
+    return false;
+  }
+
+  const unsigned char *ptr = memory(bank, addr, nbytes);
+  if (nullptr == ptr) {
+    errMsg(err) << "Cannot read " << nbytes << " bytes from address " << QString::number(addr, 16)
+                << "h of bank " << bank << ": Memory not present.";
+    return false;
+  }
+
+  memcpy(data, ptr, nbytes);
+  return true;
+}
+
+bool
+SimulatedInterface::read_finish(const ErrorStack &err) {
+  Q_UNUSED(err);
+  return true;
+}
+
+const SimulatedInterface::Settings &
+SimulatedInterface::settings() const {
+  return _settings;
+}
+
+void
+SimulatedInterface::setSettings(const Settings &settings) {
+  _settings = settings;
+  _random.seed(_settings.seed);
+}
+
+const DFUFile &
+SimulatedInterface::memory() const {
+  return _memory;
+}
+
+DFUFile &
+SimulatedInterface::memory() {
+  return _memory;
+}
+
+void
+SimulatedInterface::mapBank(uint32_t bank, int image) {
+  _banks[bank] = image;
+}
+
+unsigned int
+SimulatedInterface::requests() const {
+  return _requests;
+}
+
+bool
+SimulatedInterface::simulateRequest(int nbytes, const ErrorStack &err) {
+  _requests++;
+
+  qint64 delay = _settings.latency;
+  if (_settings.bandwidth)
+    delay += (qint64(nbytes)*1000000)/_settings.bandwidth;
+  if (delay)
+    QThread::usleep(delay);
+  addRoundTripSample(delay);
+
+  if (_requests == _settings.failRequest) {
+    errMsg(err) << "Simulated failure of request " << _requests << ".";
+    return false;
+  }
+  if ((_settings.errorRate > 0) && (_random.generateDouble() < _settings.errorRate)) {
+    errMsg(err) << "Simulated random failure of request " << _requests << ".";
+    return false;
+  }
+
+  return true;
+}
+
+unsigned char *
+SimulatedInterface::memory(uint32_t bank, uint32_t addr, int nbytes) {
+  int image = _banks.value(bank, 0);
+  if ((0 > image) || (image >= _memory.numImages()) || (0 >= nbytes))
+    return nullptr;
+
+  DFUFile::Image &img = _memory.image(image);
+  if ((! img.isAllocated(addr)) || (! img.isAllocated(addr+nbytes-1)))
+    return nullptr;
+  // Both ends must be within the same element
+  unsigned char *ptr = img.data(addr);
+  if ((ptr + nbytes - 1) != img.data(addr+nbytes-1))
+    return nullptr;
+  return ptr;
+}
+
+USBDeviceInfo
+SimulatedInterface::interfaceInfo() {
+  return USBDeviceInfo(USBDeviceInfo::Class::Simulated, 0, 0);
+}
+
+USBDeviceDescriptor
+SimulatedInterface::descriptor(const QString &filename, const RadioInfo &radio, const Settings &settings) {
+  QUrlQuery query;
+  if (radio.isValid())
+    query.addQueryItem("radio", radio.key());
+  if (settings.latency)
+    query.addQueryItem("latency", QString::number(settings.latency));
+  if (settings.bandwidth)
+    query.addQueryItem("bandwidth", QString::number(settings.bandwidth));
+  if (settings.errorRate > 0)
+    query.addQueryItem("errors", QString::number(settings.errorRate));
+  if (settings.failRequest)
+    query.addQueryItem("fail", QString::number(settings.failRequest));
+  if (settings.seed)
+    query.addQueryItem("seed", QString::number(settings.seed));
+
+  QString handle = filename;
+  if (! query.isEmpty())
+    handle += "?" + query.toString(QUrl::FullyEncoded);
+  return USBDeviceDescriptor(interfaceInfo(), handle);
+}
+
+Radio *
+SimulatedInterface::detect(const USBDeviceDescriptor &descr, const RadioInfo &force, const ErrorStack &err) {
+  if (interfaceInfo() != descr) {
+    errMsg(err) << "Cannot simulate " << descr.description() << ": Not a simulated device.";
+    return nullptr;
+  }
+
+  SimulatedInterface *sim = new SimulatedInterface(descr, err);
+  if (! sim->isOpen()) {
+    delete sim;
+    return nullptr;
+  }
+
+  RadioInfo id = force.isValid() ? force : sim->identifier(err);
+  if (! id.isValid()) {
+    errMsg(err) << "Cannot simulate device: No radio specified.";
+    delete sim;
+    return nullptr;
+  } else if (RadioInfo::GD77 == id.id()) {
+    return new GD77(sim);
+  } else if (RadioInfo::RD5R == id.id()) {
+    return new RD5R(sim);
+  } else if (RadioInfo::GD73 == id.id()) {
+    return new GD73(sim);
+  } else if (! SimulatedAnytoneDevice::simulates(id)) {
+    errMsg(err) << "Cannot simulate " << id.manufacturer() << " " << id.name()
+                << ". Simulation is not implemented for this radio.";
+    delete sim;
+    return nullptr;
+  }
+
+  // AnyTone radios talk their protocol to a simulated device behind a pseudo terminal.
+  auto device = new SimulatedAnytoneDevice(id, sim->settings(), err);
+  if (sim->memory().numImages())
+    device->load(sim->memory().image(0));
+  delete sim;
+  if (! device->isOpen()) {
+    delete device;
+    return nullptr;
+  }
+
+  auto anytone = new AnytoneGD32Interface(device->descriptor(), err);
+  // The device lives as long as the interface talking to it.
+  device->setParent(anytone);
+  if (anytone->isOpen()) {
+    switch (id.id()) {
+    case RadioInfo::D868UVE: return new D868UV(anytone);
+    case RadioInfo::D878UV: return new D878UV(anytone);
+    case RadioInfo::D878UVII: return new D878UV2(anytone);
+    case RadioInfo::D578UV: return new D578UV(anytone);
+    case RadioInfo::DMR6X2UV: return new DMR6X2UV(anytone);
+    case RadioInfo::DMR6X2UV2: return new DMR6X2UV2(anytone);
+    default: break;
+    }
+    anytone->close();
+  }
+  anytone->deleteLater();
+  return nullptr;
+}
@@ -0,0 +1,122 @@
+#ifndef SIMULATEDINTERFACE_HH
+#define SIMULATEDINTERFACE_HH
+
+#include <QObject>
+#include <QHash>
+#include <QRandomGenerator>
+#include "radiointerface.hh"
+#include "dfufile.hh"
+
+class Radio;
+
+/** Implements a simulated radio interface backed by a memory image.
+ *
+ * The memory of the simulated device is held in a @c DFUFile. Requests to a memory bank are
+ * served from the image the bank is mapped to (see @c mapBank), by default all banks are mapped
+ * to the first image. Reads from and writes to addresses not backed by any element of the image
+ * fail, just like accessing non-existent memory of a real device.
+ *
+ * The transfer characteristics of a device can be simulated by delaying every request by a
+ * fixed latency and the time needed to transfer the payload at a given bandwidth. Additionally,
+ * failing requests can be injected, either randomly at a given rate or at a specific request.
+ *
+ * This interface allows to exercise and benchmark the up- and download of codeplugs without
+ * any hardware. It is part of the unit tests only. A simulated device is described by a
+ * @c USBDeviceDescriptor (see @c descriptor), the radio talking to it is created by @c detect.
+ * The Radioddity GD-77, RD-5R and GD-73 talk to their device using the generic
+ * @c RadioInterface methods and run directly on this interface. For the AnyTone radios,
+ * @c detect starts a @c SimulatedAnytoneDevice with the memory and transfer characteristics of
+ * this interface instead. All other radios talk protocols, that are not simulated yet. */
+class SimulatedInterface: public QObject, public RadioInterface
+{
+  Q_OBJECT
+
+public:
+  /** Transfer characteristics of the simulated device. */
+  struct Settings {
+    /** Empty constructor, simulates an infinitely fast and reliable device. */
+    Settings();
+
+    unsigned int latency;     ///< Latency of every request in us.
+    unsigned int bandwidth;   ///< Transfer rate in bytes per second, 0 means unlimited.
+    double errorRate;         ///< Probability of a request to fail.
+    unsigned int failRequest; ///< Number of the request (starting at 1) that fails, 0 means never.
+    unsigned int seed;        ///< Seed of the random error injection.
+  };
+
+public:
+  /** Constructs a simulated device with empty memory, identifying itself as the given radio. */
+  explicit SimulatedInterface(const RadioInfo &radio, const Settings &settings=Settings(),
+                              QObject *parent=nullptr);
+  /** Constructs a simulated device from the given descriptor. If the descriptor names a DFU
+   * file, the memory is read from it. If this fails, @c isOpen returns @c false. */
+  explicit SimulatedInterface(const USBDeviceDescriptor &descriptor,
+                              const ErrorStack &err=ErrorStack(), QObject *parent=nullptr);
+
+  bool isOpen() const;
+  void close();
+
+  RadioInfo identifier(const ErrorStack &err=ErrorStack());
+
+  bool write_start(uint32_t bank, uint32_t addr, const ErrorStack &err=ErrorStack());
+  bool write(uint32_t bank, uint32_t addr, uint8_t *data, int nbytes, const ErrorStack &err=ErrorStack());
+  bool write_finish(const ErrorStack &err=ErrorStack());
+
+  bool read_start(uint32_t bank, uint32_t addr, const ErrorStack &err=ErrorStack());
+  bool read(uint32_t bank, uint32_t addr, uint8_t *data, int nbytes, const ErrorStack &err=ErrorStack());
+  bool read_finish(const ErrorStack &err=ErrorStack());
+
+  /** Returns the transfer characteristics. */
+  const Settings &settings() const;
+  /** Sets the transfer characteristics. */
+  void setSettings(const Settings &settings);
+
+  /** Returns the memory of the simulated device. */
+  const DFUFile &memory() const;
+  /** Returns the memory of the simulated device. */
+  DFUFile &memory();
+  /** Maps the given memory bank to the specified image of the memory. */
+  void mapBank(uint32_t bank, int image);
+
+  /** Returns the number of requests served so far. */
+  unsigned int requests() const;
+
+public:
+  /** Returns the interface info of simulated devices. */
+  static USBDeviceInfo interfaceInfo();
+  /** Assembles a descriptor for a simulated device, identifying itself as the given radio, whose
+   * memory is read from the given DFU file. */
+  static USBDeviceDescriptor descriptor(const QString &filename, const RadioInfo &radio,
+                                        const Settings &settings=Settings());
+  /** Creates the radio talking to the simulated device described by the given descriptor, like
+   * @c Radio::detect does for real devices. If @c force is valid, the device identifies as that
+   * radio. Returns @c nullptr if the radio cannot be simulated. */
+  static Radio *detect(const USBDeviceDescriptor &descr, const RadioInfo &force=RadioInfo(),
+                       const ErrorStack &err=ErrorStack());
+
+protected:
+  /** Delays and counts a request transferring the given number of bytes. Returns @c false if
+   * the request is chosen to fail. */
+  bool simulateRequest(int nbytes, const ErrorStack &err);
+  /** Returns a pointer to the memory of the given bank at the specified address, if the range
+   * of @c nbytes is backed by a single element of the image. Otherwise @c nullptr is returned. */
+  unsigned char *memory(uint32_t bank, uint32_t addr, int nbytes);
+
+protected:
+  /** If @c true, the device is open. */
+  bool _open;
+  /** The radio, the device identifies as. */
+  RadioInfo _radio;
+  /** The transfer characteristics. */
+  Settings _settings;
+  /** The memory of the simulated device. */
+  DFUFile _memory;
+  /** Maps memory banks to images. */
+  QHash<uint32_t, int> _banks;
+  /** Number of requests served. */
+  unsigned int _requests;
+  /** Random number generator for the error injection. */
+  QRandomGenerator _random;
+};
+
+#endif // SIMULATEDINTERFACE_HH
@@ -0,0 +1,365 @@
+#include "simulatedinterfacetest.hh"
+#include "simulatedinterface.hh"
+#include "simulatedanytonedevice.hh"
+#include "anytone_interface.hh"
+#include "gd77.hh"
+#include "rd5r.hh"
+#include "gd73.hh"
+#include "d878uv.hh"
+#include "errorstack.hh"
+#include <QTest>
+#include <QCoreApplication>
+#include <QPointer>
+
+SimulatedInterfaceTest::SimulatedInterfaceTest(QObject *parent)
+  : UnitTestBase(parent)
+{
+  // pass...
+}
+
+
+/** Creates the radio with the given ID talking to the simulated device. The memory of the
+ * device is initialized with the empty codeplug of the radio, if not present yet. */
+static Radio *
+simulate(int id, SimulatedInterface *sim) {
+  Radio *radio = nullptr;
+  switch (id) {
+  case RadioInfo::GD77: radio = new GD77(sim); break;
+  case RadioInfo::RD5R: radio = new RD5R(sim); break;
+  case RadioInfo::GD73: radio = new GD73(sim); break;
+  default: return nullptr;
+  }
+
+  if (0 == sim->memory().numImages()) {
+    radio->codeplug().clear();
+    sim->memory().addImage(radio->codeplug().image(0));
+  }
+
+  return radio;
+}
+
+/** Creates the radio with the given ID talking to a simulated device with the given transfer
+ * characteristics. AnyTone radios talk to a @c SimulatedAnytoneDevice, all others to a
+ * @c SimulatedInterface. Returns @c nullptr if the device cannot be simulated. */
+static Radio *
+simulate(int id, const SimulatedInterface::Settings &settings, const ErrorStack &err=ErrorStack()) {
+  RadioInfo info = RadioInfo::byID(RadioInfo::Radio(id));
+  if (SimulatedAnytoneDevice::simulates(info))
+    return SimulatedInterface::detect(SimulatedInterface::descriptor("", info, settings), RadioInfo(), err);
+  return simulate(id, new SimulatedInterface(info, settings));
+}
+
+/** Returns @c true if both images have the same layout and content. */
+static bool
+sameContent(const DFUFile::Image &a, const DFUFile::Image &b) {
+  if (a.numElements() != b.numElements())
+    return false;
+  for (int i=0; i<a.numElements(); i++) {
+    if ((a.element(i).address() != b.element(i).address()) ||
+        (a.element(i).data() != b.element(i).data()))
+      return false;
+  }
+  return true;
+}
+
+
+void
+SimulatedInterfaceTest::testMemory() {
+  SimulatedInterface sim(RadioInfo::byID(RadioInfo::GD77));
+  sim.memory().addImage("memory");
+  sim.memory().image(0).addElement(0x100, 0x40);
+  sim.memory().image(0).addElement(0x200, 0x40);
+  sim.memory().image(0).element(0).data().fill(0x55);
+
+  QVERIFY(sim.isOpen());
+  QCOMPARE(sim.identifier().id(), RadioInfo::GD77);
+
+  uint8_t buffer[0x20];
+  QVERIFY(sim.read(0, 0x110, buffer, sizeof(buffer)));
+  QCOMPARE(buffer[0], uint8_t(0x55));
+
+  memset(buffer, 0xaa, sizeof(buffer));
+  QVERIFY(sim.write(0, 0x200, buffer, sizeof(buffer)));
+  QCOMPARE(uint8_t(sim.memory().image(0).element(1).data().at(0x1f)), uint8_t(0xaa));
+  QCOMPARE(uint8_t(sim.memory().image(0).element(1).data().at(0x20)), uint8_t(0x00));
+
+  // Memory not present
+  QVERIFY(! sim.read(0, 0x000, buffer, sizeof(buffer)));
+  // Spanning two elements
+  QVERIFY(! sim.read(0, 0x130, buffer, sizeof(buffer)));
+  // Unmapped image
+  sim.mapBank(3, 1);
+  QVERIFY(! sim.write(3, 0x100, buffer, sizeof(buffer)));
+
+  QCOMPARE(sim.requests(), 5U);
+
+  sim.close();
+  QVERIFY(! sim.isOpen());
+}
+
+
+void
+SimulatedInterfaceTest::testErrorInjection() {
+  SimulatedInterface::Settings settings;
+  settings.failRequest = 3;
+  SimulatedInterface sim(RadioInfo::byID(RadioInfo::GD77), settings);
+  sim.memory().addImage("memory");
+  sim.memory().image(0).addElement(0, 0x100);
+
+  uint8_t buffer[0x10];
+  QVERIFY(sim.read(0, 0x00, buffer, sizeof(buffer)));
+  QVERIFY(sim.read(0, 0x10, buffer, sizeof(buffer)));
+  ErrorStack err;
+  QVERIFY(! sim.read(0, 0x20, buffer, sizeof(buffer), err));
+  QVERIFY(! err.isEmpty());
+  QVERIFY(sim.read(0, 0x30, buffer, sizeof(buffer)));
+
+  // Random errors are reproducible for the same seed
+  settings.failRequest = 0;
+  settings.errorRate = 0.5;
+  settings.seed = 42;
+  QList<bool> first, second;
+  sim.setSettings(settings);
+  for (int i=0; i<32; i++)
+    first.append(sim.read(0, 0, buffer, sizeof(buffer)));
+  sim.setSettings(settings);
+  for (int i=0; i<32; i++)
+    second.append(sim.read(0, 0, buffer, sizeof(buffer)));
+  QCOMPARE(first, second);
+  QVERIFY(first.contains(true));
+  QVERIFY(first.contains(false));
+}
+
+
+void
+SimulatedInterfaceTest::testDescriptor() {
+  SimulatedInterface::Settings settings;
+  settings.latency = 10;
+  settings.bandwidth = 1000000;
+  USBDeviceDescriptor descr = SimulatedInterface::descriptor(
+        "", RadioInfo::byID(RadioInfo::RD5R), settings);
+  QVERIFY(descr.isValid());
+  QVERIFY(SimulatedInterface::interfaceInfo() == descr);
+
+  SimulatedInterface sim(descr);
+  QVERIFY(sim.isOpen());
+  QCOMPARE(sim.identifier().id(), RadioInfo::RD5R);
+  QCOMPARE(sim.settings().latency, 10U);
+  QCOMPARE(sim.settings().bandwidth, 1000000U);
+
+  ErrorStack err;
+  Radio *radio = SimulatedInterface::detect(descr, RadioInfo(), err);
+  if (nullptr == radio)
+    QFAIL(err.format().toStdString().c_str());
+  QCOMPARE(radio->name(), QString("Baofeng/Radioddity RD-5R"));
+  delete radio;
+
+  // Radios talking a protocol that is not simulated cannot be detected
+  radio = SimulatedInterface::detect(descr, RadioInfo::byID(RadioInfo::MD390), err);
+  QVERIFY(nullptr == radio);
+  // The library itself does not know about simulated devices
+  QVERIFY(nullptr == Radio::detect(descr, RadioInfo(), err));
+}
+
+
+void
+SimulatedInterfaceTest::testRoundTrip_data() {
+  QTest::addColumn<int>("radio");
+  QTest::newRow("GD-77") << int(RadioInfo::GD77);
+  QTest::newRow("RD-5R") << int(RadioInfo::RD5R);
+  QTest::newRow("GD-73") << int(RadioInfo::GD73);
+}
+
+void
+SimulatedInterfaceTest::testRoundTrip() {
+  QFETCH(int, radio);
+  ErrorStack err;
+
+  // Upload the basic config
+  SimulatedInterface *sim = new SimulatedInterface(RadioInfo::byID(RadioInfo::Radio(radio)));
+  Radio *uploader = simulate(radio, sim);
+  Config *intermediate = uploader->codeplug().preprocess(&_basicConfig, err);
+  if (nullptr == intermediate)
+    QFAIL(err.format().toStdString().c_str());
+  Codeplug::Flags uploadFlags; uploadFlags.setBlocking(true);
+  if (! uploader->startUpload(intermediate, uploadFlags, err))
+    QFAIL(err.format().toStdString().c_str());
+  QVERIFY(sameContent(uploader->codeplug().image(0), sim->memory().image(0)));
+  QVERIFY(0 < uploader->stats().bytes(TransferStats::Direction::Write));
+
+  // Download into a fresh radio from a device holding the same memory
+  SimulatedInterface *copy = new SimulatedInterface(RadioInfo::byID(RadioInfo::Radio(radio)));
+  copy->memory().addImage(sim->memory().image(0));
+  delete uploader;
+
+  Radio *downloader = simulate(radio, copy);
+  TransferFlags downloadFlags; downloadFlags.setBlocking(true);
+  if (! downloader->startDownload(downloadFlags, err))
+    QFAIL(err.format().toStdString().c_str());
+  QVERIFY(sameContent(downloader->codeplug().image(0), copy->memory().image(0)));
+
+  Config config;
+  if (! downloader->codeplug().decode(&config, err))
+    QFAIL(err.format().toStdString().c_str());
+  QVERIFY(0 < config.channelList()->count());
+
+  // The radio owns the interface, it is deleted once the pending events are processed.
+  QPointer<SimulatedInterface> iface(copy);
+  delete downloader;
+  QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+  QVERIFY(iface.isNull());
+}
+
+
+void
+SimulatedInterfaceTest::testAnytoneDevice() {
+  SimulatedInterface::Settings settings;
+  settings.failRequest = 3;
+  ErrorStack err;
+  SimulatedAnytoneDevice device(RadioInfo::byID(RadioInfo::D878UV), settings, err);
+  if (! device.isOpen())
+    QSKIP("Cannot simulate AnyTone device.");
+
+  DFUFile::Image image;
+  image.addElement(0x02c00000, 0x20);
+  image.element(0).data().fill(0x55);
+  device.load(image);
+
+  AnytoneGD32Interface anytone(device.descriptor(), err);
+  if (! anytone.isOpen())
+    QFAIL(err.format().toStdString().c_str());
+  QCOMPARE(anytone.identifier().id(), RadioInfo::D878UV);
+
+  uint8_t buffer[0x20];
+  if (! anytone.read(0, 0x02c00000, buffer, sizeof(buffer), err))
+    QFAIL(err.format().toStdString().c_str());
+  QCOMPARE(buffer[0x1f], uint8_t(0x55));
+
+  // Third request fails
+  memset(buffer, 0xaa, sizeof(buffer));
+  QVERIFY(! anytone.write(0, 0x02c00020, buffer, sizeof(buffer)));
+  QCOMPARE(device.requests(), 3U);
+  // Memory never written reads as zero
+  QCOMPARE(device.memory(0x02c00030, 0x10), QByteArray(0x10, 0x00));
+
+  anytone.reboot();
+
+  // Select simulated AnyTone radio by descriptor
+  USBDeviceDescriptor descr = SimulatedInterface::descriptor("", RadioInfo::byID(RadioInfo::D878UV));
+  Radio *radio = SimulatedInterface::detect(descr, RadioInfo(), err);
+  if (nullptr == radio)
+    QFAIL(err.format().toStdString().c_str());
+  QCOMPARE(radio->name(), QString("Anytone AT-D878UV"));
+  delete radio;
+  // Stops the simulated device, owned by the interface deleted later
+  QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+}
+
+void
+SimulatedInterfaceTest::testAnytoneRoundTrip() {
+  ErrorStack err;
+  SimulatedAnytoneDevice device(RadioInfo::byID(RadioInfo::D878UV), SimulatedInterface::Settings(), err);
+  if (! device.isOpen())
+    QSKIP("Cannot simulate AnyTone device.");
+
+  // Upload the basic config
+  AnytoneGD32Interface *anytone = new AnytoneGD32Interface(device.descriptor(), err);
+  if (! anytone->isOpen())
+    QFAIL(err.format().toStdString().c_str());
+  Radio *uploader = new D878UV(anytone);
+  Config *intermediate = uploader->codeplug().preprocess(&_basicConfig, err);
+  if (nullptr == intermediate)
+    QFAIL(err.format().toStdString().c_str());
+  Codeplug::Flags uploadFlags; uploadFlags.setBlocking(true);
+  if (! uploader->startUpload(intermediate, uploadFlags, err))
+    QFAIL(err.format().toStdString().c_str());
+  QVERIFY(0 < uploader->stats().bytes(TransferStats::Direction::Write));
+  delete uploader;
+
+  // Download from the same device into a fresh radio
+  anytone = new AnytoneGD32Interface(device.descriptor(), err);
+  if (! anytone->isOpen())
+    QFAIL(err.format().toStdString().c_str());
+  Radio *downloader = new D878UV(anytone);
+  TransferFlags downloadFlags; downloadFlags.setBlocking(true); downloadFlags.setPipelined(true);
+  if (! downloader->startDownload(downloadFlags, err))
+    QFAIL(err.format().toStdString().c_str());
+  const DFUFile::Image &image = downloader->codeplug().image(0);
+  for (int i=0; i<image.numElements(); i++)
+    QCOMPARE(image.element(i).data(), device.memory(image.element(i).address(), image.element(i).data().size()));
+
+  Config config;
+  if (! downloader->codeplug().decode(&config, err))
+    QFAIL(err.format().toStdString().c_str());
+  QVERIFY(0 < config.channelList()->count());
+
+  delete downloader;
+}
+
+
+void
+SimulatedInterfaceTest::benchmarkDownload_data() {
+  QTest::addColumn<int>("radio");
+  QTest::addColumn<unsigned int>("latency");
+  QTest::newRow("GD-77") << int(RadioInfo::GD77) << 0U;
+  QTest::newRow("GD-77, 100us") << int(RadioInfo::GD77) << 100U;
+  QTest::newRow("RD-5R") << int(RadioInfo::RD5R) << 0U;
+  QTest::newRow("RD-5R, 100us") << int(RadioInfo::RD5R) << 100U;
+  QTest::newRow("GD-73") << int(RadioInfo::GD73) << 0U;
+  QTest::newRow("GD-73, 100us") << int(RadioInfo::GD73) << 100U;
+  QTest::newRow("D878UV") << int(RadioInfo::D878UV) << 0U;
+  QTest::newRow("D878UV, 100us") << int(RadioInfo::D878UV) << 100U;
+}
+
+void
+SimulatedInterfaceTest::benchmarkDownload() {
+  QFETCH(int, radio);
+  QFETCH(unsigned int, latency);
+
+  SimulatedInterface::Settings settings;
+  settings.latency = latency;
+
+  QBENCHMARK_ONCE {
+    ErrorStack err;
+    Radio *downloader = simulate(radio, settings, err);
+    if (nullptr == downloader)
+      QSKIP(err.format().toStdString().c_str());
+    TransferFlags flags; flags.setBlocking(true);
+    if (! downloader->startDownload(flags, err))
+      QFAIL(err.format().toStdString().c_str());
+    delete downloader;
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+  }
+}
+
+void
+SimulatedInterfaceTest::benchmarkUpload_data() {
+  benchmarkDownload_data();
+}
+
+void
+SimulatedInterfaceTest::benchmarkUpload() {
+  QFETCH(int, radio);
+  QFETCH(unsigned int, latency);
+
+  SimulatedInterface::Settings settings;
+  settings.latency = latency;
+
+  QBENCHMARK_ONCE {
+    ErrorStack err;
+    Radio *uploader = simulate(radio, settings, err);
+    if (nullptr == uploader)
+      QSKIP(err.format().toStdString().c_str());
+    Config *intermediate = uploader->codeplug().preprocess(&_basicConfig, err);
+    if (nullptr == intermediate)
+      QFAIL(err.format().toStdString().c_str());
+    Codeplug::Flags flags; flags.setBlocking(true);
+    if (! uploader->startUpload(intermediate, flags, err))
+      QFAIL(err.format().toStdString().c_str());
+    delete uploader;
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+  }
+}
+
+
+QTEST_GUILESS_MAIN(SimulatedInterfaceTest)
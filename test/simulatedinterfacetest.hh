@@ -0,0 +1,28 @@
+#ifndef SIMULATEDINTERFACETEST_HH
+#define SIMULATEDINTERFACETEST_HH
+
+#include "libdmrconfigtest.hh"
+
+class SimulatedInterfaceTest : public UnitTestBase
+{
+  Q_OBJECT
+
+public:
+  explicit SimulatedInterfaceTest(QObject *parent = nullptr);
+
+private slots:
+  void testMemory();
+  void testErrorInjection();
+  void testDescriptor();
+  void testRoundTrip_data();
+  void testRoundTrip();
+  void testAnytoneDevice();
+  void testAnytoneRoundTrip();
+
+  void benchmarkDownload_data();
+  void benchmarkDownload();
+  void benchmarkUpload_data();
+  void benchmarkUpload();
+};
+
+#endif // SIMULATEDINTERFACETEST_HH
@@ -0,0 +1,83 @@
+#include "transferstatstest.hh"
+#include "transferstats.hh"
+#include <QTest>
+#include <QJsonArray>
+
+TransferStatsTest::TransferStatsTest(QObject *parent)
+  : QObject(parent)
+{
+  // pass...
+}
+
+void
+TransferStatsTest::testPhases() {
+  TransferStats stats;
+  {
+    TransferStats::Session session(stats);
+    stats.beginPhase("read");
+    stats.addRequest(TransferStats::Direction::Read, 64, 100);
+    stats.addRequest(TransferStats::Direction::Read, 64, 300);
+    QCOMPARE(stats.currentPhase(), QString("read"));
+    stats.beginPhase("write");
+    stats.addRequest(TransferStats::Direction::Write, 32, 1000);
+    stats.addRetry();
+  }
+  // Session ended
+  QVERIFY(stats.currentPhase().isEmpty());
+
+  QCOMPARE(stats.bytes(TransferStats::Direction::Read), quint64(128));
+  QCOMPARE(stats.bytes(TransferStats::Direction::Write), quint64(32));
+  QCOMPARE(stats.requests(), quint64(3));
+  QCOMPARE(stats.retries(), quint64(1));
+
+  QJsonObject json = stats.toJson();
+  QJsonArray phases = json["phases"].toArray();
+  QCOMPARE(phases.size(), 2);
+  QCOMPARE(phases[0].toObject()["name"].toString(), QString("read"));
+  QCOMPARE(phases[0].toObject()["bytesRead"].toInt(), 128);
+  QCOMPARE(phases[0].toObject()["requests"].toInt(), 2);
+  QCOMPARE(phases[1].toObject()["name"].toString(), QString("write"));
+  QCOMPARE(phases[1].toObject()["bytesWritten"].toInt(), 32);
+  QCOMPARE(phases[1].toObject()["retries"].toInt(), 1);
+
+  // Restarting a session clears everything
+  TransferStats::Session session(stats);
+  QCOMPARE(stats.requests(), quint64(0));
+  QVERIFY(stats.toJson()["phases"].toArray().isEmpty());
+}
+
+void
+TransferStatsTest::testHistogram() {
+  TransferStats stats;
+  TransferStats::Session session(stats);
+  stats.addRequest(TransferStats::Direction::Read, 1, 0);
+  stats.addRequest(TransferStats::Direction::Read, 1, 127);
+  stats.addRequest(TransferStats::Direction::Read, 1, 128);
+  stats.addRequest(TransferStats::Direction::Read, 1, 1000000000);
+
+  QJsonObject read = stats.toJson()["latency"].toObject()["read"].toObject();
+  QCOMPARE(read["count"].toInt(), 4);
+  QCOMPARE(read["minUs"].toInteger(), qint64(0));
+  QCOMPARE(read["maxUs"].toInteger(), qint64(1000000000));
+
+  QJsonArray histogram = read["histogram"].toArray();
+  QCOMPARE(histogram.size(), int(TransferStats::HISTOGRAM_SIZE));
+  QCOMPARE(histogram[0].toObject()["belowUs"].toInt(), 128);
+  QCOMPARE(histogram[0].toObject()["count"].toInt(), 2);
+  QCOMPARE(histogram[1].toObject()["belowUs"].toInt(), 256);
+  QCOMPARE(histogram[1].toObject()["count"].toInt(), 1);
+  // Last bucket is open-ended
+  QVERIFY(! histogram.last().toObject().contains("belowUs"));
+  QCOMPARE(histogram.last().toObject()["count"].toInt(), 1);
+
+  // No write requests -> no write latency
+  QVERIFY(! stats.toJson()["latency"].toObject().contains("write"));
+}
+
+void
+TransferStatsTest::testNoStats() {
+  // Must not crash if no statistics are attached to the interface.
+  TransferStats::Request request(nullptr, TransferStats::Direction::Read, 64);
+}
+
+QTEST_GUILESS_MAIN(TransferStatsTest)
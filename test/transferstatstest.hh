@@ -0,0 +1,19 @@
+#ifndef TRANSFERSTATSTEST_HH
+#define TRANSFERSTATSTEST_HH
+
+#include <QObject>
+
+class TransferStatsTest : public QObject
+{
+  Q_OBJECT
+
+public:
+  explicit TransferStatsTest(QObject *parent = nullptr);
+
+private slots:
+  void testPhases();
+  void testHistogram();
+  void testNoStats();
+};
+
+#endif // TRANSFERSTATSTEST_HH
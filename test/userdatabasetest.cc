@@ -0,0 +1,259 @@
+#include "userdatabasetest.hh"
+#include "userdatabase.hh"
+#include <QTest>
+#include <QFile>
+#include <QDir>
+#include <QStandardPaths>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QDateTime>
+
+/** Number of users of the large synthetic database, roughly the size of the radioid.net dump. */
+#define LARGE_DB_SIZE 300000
+
+
+UserDatabaseTest::UserDatabaseTest(QObject *parent)
+  : QObject(parent), _dir()
+{
+  // pass...
+}
+
+void
+UserDatabaseTest::initTestCase() {
+  QVERIFY(_dir.isValid());
+
+  // Place a small database in the (test) app-data location, prevents the download.
+  QStandardPaths::setTestModeEnabled(true);
+  QString path = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+  QVERIFY(QDir().mkpath(path));
+
+  QFile file(path + "/user.json");
+  QVERIFY(file.open(QIODevice::WriteOnly));
+  file.write(
+        "{\"users\": ["
+        "{\"id\": 2621370, \"callsign\": \"DM3MAT\", \"fname\": \"Hannes\", \"surname\": \"M\\u00fcller\", "
+        " \"city\": \"Berlin\", \"state\": \"Berlin\", \"country\": \"Germany\", \"remarks\": \"\"},"
+        "{\"id\": 1234567, \"callsign\": \"W1AW\", \"fname\": \"Hiram\", \"surname\": \"Maxim\", "
+        " \"city\": \"Newington\", \"state\": \"Connecticut\", \"country\": \"United States\", \"remarks\": \"ARRL\"},"
+        "{\"id\": 0, \"callsign\": \"INVALID\"},"
+        "{\"id\": 2621001, \"callsign\": \"DL1ABC\", \"fname\": \"Erika\", \"surname\": \"\", "
+        " \"city\": \"Potsdam\", \"state\": \"Brandenburg\", \"country\": \"Germany\", \"remarks\": \"\"}"
+        "]}");
+  file.close();
+}
+
+void
+UserDatabaseTest::cleanupTestCase() {
+  QString path = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+  QFile::remove(path + "/user.json");
+  QFile::remove(path + "/user.snapshot");
+}
+
+void
+UserDatabaseTest::testLoad() {
+  UserDatabase db(false);
+  QVERIFY(db.ready());
+  QCOMPARE(db.count(), qint64(3));
+
+  // Users are sorted by ID
+  QCOMPARE(db.user(0).id(), 1234567U);
+  QCOMPARE(db.user(1).id(), 2621001U);
+  QCOMPARE(db.user(2).id(), 2621370U);
+
+  UserDatabase::User user = db.user(2);
+  QCOMPARE(user.call(), QString("DM3MAT"));
+  QCOMPARE(user.name(), QString("Hannes"));
+  QCOMPARE(user.surname(), QString("Müller"));
+  QCOMPARE(user.city(), QString("Berlin"));
+  QCOMPARE(user.state(), QString("Berlin"));
+  QCOMPARE(user.country(), QString("Germany"));
+  QVERIFY(user.comment().isEmpty());
+
+  QCOMPARE(db.user(0).comment(), QString("ARRL"));
+  QCOMPARE(db.user(1).country(), QString("Germany"));
+  QVERIFY(db.user(1).surname().isEmpty());
+}
+
+void
+UserDatabaseTest::testSort() {
+  UserDatabase db(false);
+  QVERIFY(db.ready());
+
+  db.sortUsers(2621370);
+  QCOMPARE(db.user(0).id(), 2621370U);
+  QCOMPARE(db.user(1).id(), 2621001U);
+  QCOMPARE(db.user(2).id(), 1234567U);
+}
+
+void
+UserDatabaseTest::testSnapshot() {
+  QString filename = _dir.filePath("snapshot.json");
+  QString snapshot = _dir.filePath("snapshot.snapshot");
+  QVERIFY(writeUsers(filename, 100));
+  QFile::remove(snapshot);
+
+  UserDatabase db(false);
+  // First load parses the JSON file and writes the snapshot
+  QVERIFY(db.load(filename));
+  QVERIFY(QFileInfo::exists(snapshot));
+  QCOMPARE(db.count(), qint64(100));
+  QString call = db.user(42).call(), country = db.user(42).country();
+
+  // Second load maps the snapshot
+  QVERIFY(db.load(filename));
+  QCOMPARE(db.count(), qint64(100));
+  QCOMPARE(db.user(42).call(), call);
+  QCOMPARE(db.user(42).country(), country);
+
+  // Modifying the source invalidates the snapshot
+  QVERIFY(writeUsers(filename, 50));
+  QFile source(filename);
+  QVERIFY(source.open(QIODevice::ReadWrite));
+  QVERIFY(source.setFileTime(QDateTime::currentDateTime().addSecs(60), QFileDevice::FileModificationTime));
+  source.close();
+  QVERIFY(db.load(filename));
+  QCOMPARE(db.count(), qint64(50));
+}
+
+void
+UserDatabaseTest::testCorruptSnapshot() {
+  QString filename = _dir.filePath("corrupt.json");
+  QString snapshot = _dir.filePath("corrupt.snapshot");
+  QVERIFY(writeUsers(filename, 100));
+  QFile::remove(snapshot);
+
+  QString call, state;
+  {
+    UserDatabase db(false);
+    QVERIFY(db.load(filename));
+    QVERIFY(QFileInfo::exists(snapshot));
+    call = db.user(42).call(); state = db.user(42).state();
+  }
+
+  // Overwrites a column of the snapshot, its offset is taken from the header at the given position
+  auto corrupt = [snapshot](qint64 header, qint64 size, char value) {
+    QFile file(snapshot);
+    if (! file.open(QIODevice::ReadWrite))
+      return false;
+    uint64_t offset = 0;
+    if ((! file.seek(header)) || (sizeof(offset) != file.read((char *)&offset, sizeof(offset))))
+      return false;
+    return file.seek(offset) && (size == file.write(QByteArray(size, value)));
+  };
+
+  // String references pointing outside of the arena reject the snapshot, the source gets parsed
+  // again and a valid snapshot is written.
+  QVERIFY(corrupt(56, 100*5*8, char(0xff)));
+  {
+    UserDatabase db(false);
+    QVERIFY(db.load(filename));
+    QCOMPARE(db.count(), qint64(100));
+    QCOMPARE(db.user(42).call(), call);
+  }
+
+  // The same holds for invalid state indices
+  QVERIFY(corrupt(64, 100*2, char(0xff)));
+  {
+    UserDatabase db(false);
+    QVERIFY(db.load(filename));
+    QCOMPARE(db.count(), qint64(100));
+    QCOMPARE(db.user(42).state(), state);
+  }
+}
+
+void
+UserDatabaseTest::testDistance() {
+  QCOMPARE(UserDatabase::distance(2621370, 2621370), 0U);
+  QCOMPARE(UserDatabase::distance(2621370, 262), 1370U);
+  QCOMPARE(UserDatabase::distance(262, 2621370), 1370U);
+  QCOMPARE(UserDatabase::distance(2621370, 2621001), 369U);
+  QCOMPARE(UserDatabase::distance(1000, 1), 0U);
+}
+
+void
+UserDatabaseTest::testNearest() {
+  QString filename = _dir.filePath("nearest.json");
+  QVERIFY(writeUsers(filename, 10000));
+  QSet<unsigned> ids = {1023456, 1050000};
+
+  UserDatabase full(false), partial(false);
+  QVERIFY(full.load(filename));
+  QVERIFY(partial.load(filename));
+  full.sortUsers(ids);
+  partial.sortUsers(ids, 100);
+  QVector<UserDatabase::User> nearest = full.nearest(ids, 100);
+  QCOMPARE(nearest.size(), 100);
+
+  // Partial sort must yield the same first entries as the full sort
+  for (int i=0; i<100; i++) {
+    QCOMPARE(partial.user(i).id(), full.user(i).id());
+    QCOMPARE(nearest[i].id(), full.user(i).id());
+  }
+}
+
+void
+UserDatabaseTest::benchmarkLoad() {
+  QString filename = _dir.filePath("large.json");
+  QVERIFY(writeUsers(filename, LARGE_DB_SIZE));
+  QFile::remove(_dir.filePath("large.snapshot"));
+
+  UserDatabase db(false);
+  qint64 rssBefore = residentSetSize();
+  QElapsedTimer timer; timer.start();
+  QVERIFY(db.load(filename));
+  qint64 elapsed = timer.elapsed();
+  qint64 rssAfter = residentSetSize();
+  QCOMPARE(db.count(), qint64(LARGE_DB_SIZE));
+
+  qInfo() << "Parsed" << db.count() << "users in" << elapsed << "ms.";
+  if ((0 <= rssBefore) && (0 <= rssAfter))
+    qInfo() << "Resident set size grew by" << (rssAfter-rssBefore) << "kB to" << rssAfter << "kB.";
+
+  timer.restart();
+  QVERIFY(db.load(filename));
+  qInfo() << "Mapped snapshot of" << db.count() << "users in" << timer.elapsed() << "ms.";
+
+  // Subsequent loads map the snapshot written by the first load.
+  QBENCHMARK {
+    db.load(filename);
+  }
+}
+
+bool
+UserDatabaseTest::writeUsers(const QString &filename, unsigned n) {
+  static const char *states[] = {"Berlin", "Bavaria", "Texas", "Ontario", "Queensland"};
+  static const char *countries[] = {"Germany", "Germany", "United States", "Canada", "Australia"};
+
+  QFile file(filename);
+  if (! file.open(QIODevice::WriteOnly))
+    return false;
+
+  file.write("{\"users\": [\n");
+  for (unsigned i=0; i<n; i++) {
+    unsigned id = 1000000 + i*7;
+    QByteArray entry = QString(
+          "{\"id\": %1, \"callsign\": \"XX%2\", \"fname\": \"Name%2\", \"surname\": \"Surname%2\", "
+          "\"city\": \"City%3\", \"state\": \"%4\", \"country\": \"%5\", \"remarks\": \"\"}%6\n")
+        .arg(id).arg(i, 0, 36).arg(i%1000).arg(states[i%5]).arg(countries[i%5])
+        .arg((i+1<n) ? "," : "").toUtf8();
+    file.write(entry);
+  }
+  file.write("]}\n");
+  file.close();
+  return true;
+}
+
+qint64
+UserDatabaseTest::residentSetSize() {
+  QFile status("/proc/self/status");
+  if (! status.open(QIODevice::ReadOnly | QIODevice::Text))
+    return -1;
+  while (! status.atEnd()) {
+    QByteArray line = status.readLine();
+    if (line.startsWith("VmRSS:"))
+      return line.mid(6).trimmed().split(' ').first().toLongLong();
+  }
+  return -1;
+}
+
+QTEST_GUILESS_MAIN(UserDatabaseTest)
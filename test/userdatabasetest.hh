@@ -0,0 +1,36 @@
+#ifndef USERDATABASETEST_HH
+#define USERDATABASETEST_HH
+
+#include <QObject>
+#include <QTemporaryDir>
+
+class UserDatabaseTest : public QObject
+{
+  Q_OBJECT
+
+public:
+  explicit UserDatabaseTest(QObject *parent = nullptr);
+
+private slots:
+  void initTestCase();
+  void cleanupTestCase();
+
+  void testLoad();
+  void testSort();
+  void testSnapshot();
+  void testCorruptSnapshot();
+  void testDistance();
+  void testNearest();
+  void benchmarkLoad();
+
+protected:
+  /** Writes a synthetic user database with @c n users into the given file. */
+  static bool writeUsers(const QString &filename, unsigned n);
+  /** Returns the resident set size of the process in kB or -1 if unknown. */
+  static qint64 residentSetSize();
+
+protected:
+  QTemporaryDir _dir;
+};
+
+#endif // USERDATABASETEST_HH